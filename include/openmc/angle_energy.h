@@ -16,6 +16,11 @@ class AngleEnergy {
 public:
   virtual void sample(
     double E_in, double& E_out, double& mu, uint64_t* seed) const = 0;
+
+  //! Move the tabulated data into memory shared by all processes on the
+  //! node. This is collective over the processes on a node.
+  virtual void share_data() {}
+
   virtual ~AngleEnergy() = default;
 };
 
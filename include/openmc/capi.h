@@ -158,6 +158,7 @@ int openmc_tally_get_id(int32_t index, int32_t* id);
 int openmc_tally_get_filters(int32_t index, const int32_t** indices, size_t* n);
 int openmc_tally_get_n_realizations(int32_t index, int32_t* n);
 int openmc_tally_get_nuclides(int32_t index, int** nuclides, int* n);
+int openmc_tally_get_reduce_time(int32_t index, double* time);
 int openmc_tally_get_scores(int32_t index, int** scores, int* n);
 int openmc_tally_get_type(int32_t index, int32_t* type);
 int openmc_tally_get_writable(int32_t index, bool* writable);
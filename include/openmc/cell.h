@@ -113,11 +113,13 @@ private:
 
   //! Determine if a particle is inside the cell for a complex cell.
   //!
-  //! Uses the comobination of half-spaces and binary operators to determine
-  //! if short circuiting can be used. Short cicuiting uses the relative and
-  //! absolute depth of parenthases in the expression.
+  //! Runs the compiled form of the expression, which only evaluates the
+  //! half-spaces that can still change the outcome.
   bool contains_complex(Position r, Direction u, int32_t on_surface) const;
 
+  //! Compile the expression of a complex cell into branches
+  void compile(int32_t cell_id);
+
   //! BoundingBox if the paritcle is in a simple cell.
   BoundingBox bounding_box_simple() const;
 
@@ -145,6 +147,21 @@ private:
   // TODO: Should this be a vector of some other type
   vector<int32_t> expression_;
   bool simple_; //!< Does the region contain only intersections?
+
+  //! Outcomes that end the evaluation of a compiled complex cell
+  static constexpr int32_t OUTSIDE {-1};
+  static constexpr int32_t INSIDE {-2};
+
+  //! Half-space test in the compiled form of a complex cell
+  //
+  //! Each half-space of the expression becomes one branch, in the order they
+  //! appear. Testing it selects either the next branch to test or an outcome,
+  //! so the operators never have to be interpreted at run time.
+  struct Branch {
+    int32_t token;   //!< Signed surface index (one-based)
+    int32_t next[2]; //!< Next branch or outcome if outside/inside half-space
+  };
+  vector<Branch> branches_; //!< Compiled complex cell, starting at the first
 };
 
 //==============================================================================
@@ -171,9 +188,9 @@ public:
   //! involving only the intersection of half-spaces) and one for complex cells.
   //! Simple cells can be evaluated with short circuit evaluation, i.e., as soon
   //! as we know that one half-space is not satisfied, we can exit. This
-  //! provides a performance benefit for the common case. In
-  //! contains_complex, we evaluate the RPN expression using a stack, similar to
-  //! how a RPN calculator would work.
+  //! provides a performance benefit for the common case. Complex cells are
+  //! compiled at initialization into branches that jump past half-spaces that
+  //! can no longer change the result.
   //! \param r The 3D Cartesian coordinate to check.
   //! \param u A direction used to "break ties" the coordinates are very
   //!   close to a surface.
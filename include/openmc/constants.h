@@ -27,13 +27,14 @@ constexpr int HDF5_VERSION[] {3, 0};
 // Version numbers for binary files
 constexpr array<int, 2> VERSION_STATEPOINT {18, 1};
 constexpr array<int, 2> VERSION_PARTICLE_RESTART {2, 0};
-constexpr array<int, 2> VERSION_TRACK {3, 0};
+constexpr array<int, 2> VERSION_TRACK {4, 0};
 constexpr array<int, 2> VERSION_SUMMARY {6, 0};
 constexpr array<int, 2> VERSION_VOLUME {1, 0};
 constexpr array<int, 2> VERSION_VOXEL {2, 0};
 constexpr array<int, 2> VERSION_MGXS_LIBRARY {1, 0};
 constexpr array<int, 2> VERSION_PROPERTIES {1, 0};
 constexpr array<int, 2> VERSION_WEIGHT_WINDOWS {1, 0};
+constexpr array<int, 2> VERSION_XS_CACHE {2, 0};
 
 // ============================================================================
 // ADJUSTABLE PARAMETERS
@@ -47,6 +48,14 @@ constexpr double CONFIDENCE_LEVEL {0.95};
 // Used for surface current tallies
 constexpr double TINY_BIT {1e-8};
 
+// Maximum number of boundary crossings of a ray populating neighbor lists
+constexpr int NEIGHBOR_LIST_MAX_CROSSINGS {10000};
+
+// Octrees partitioning universes subdivide nodes with more candidate cells than
+// this, up to a maximum depth
+constexpr int OCTREE_MAX_LEAF_CELLS {8};
+constexpr int OCTREE_MAX_DEPTH {10};
+
 // User for precision in geometry
 constexpr double FP_PRECISION {1e-14};
 constexpr double FP_REL_PRECISION {1e-5};
@@ -59,6 +68,9 @@ constexpr double RADIAL_MESH_TOL {1e-10};
 // Maximum number of random samples per history
 constexpr int MAX_SAMPLE {100000};
 
+// Number of particles per bank in banked cross section lookups
+constexpr int XS_LOOKUP_BANK_SIZE {128};
+
 // ============================================================================
 // MATH AND PHYSICAL CONSTANTS
 
@@ -103,6 +115,28 @@ constexpr int NUCLIDE_NONE {-1};
 // Temperature treatment method
 enum class TemperatureMethod { NEAREST, INTERPOLATION };
 
+// Method used to accelerate searches on nuclide energy grids
+enum class EnergyGridMethod { LOGARITHM, MATERIAL_UNION, HASH };
+
+// Target average number of energy grid points per bin for hashed energy grids
+constexpr int HASH_GRID_POINTS_PER_BIN {4};
+
+// Largest number of values (filter bins times scores) of a tally for which
+// thread-private tally buffers store every value
+constexpr int64_t TALLY_DENSE_BUFFER_MAX {1 << 16};
+
+// Number of values scored to filter bins of other processes that a thread
+// buffers for a decomposed tally before combining values of the same bin
+constexpr size_t TALLY_REMOTE_BUFFER_SIZE {1 << 16};
+
+// Minimum size in [bytes] of each block of memory that is shared by the
+// processes on a node, and alignment in [bytes] of arrays within the blocks
+constexpr size_t NODE_SHARED_BLOCK_SIZE {size_t(1) << 28};
+constexpr size_t NODE_SHARED_ALIGNMENT {64};
+
+// Number of hash table slots in sparse thread-private tally buffers
+constexpr int64_t TALLY_SPARSE_BUFFER_SLOTS {1 << 15};
+
 // Reaction types
 enum ReactionType {
   REACTION_NONE = 0,
@@ -347,6 +381,8 @@ enum class SolverType { MONTE_CARLO, RANDOM_RAY };
 
 enum class GeometryType { CSG, DAG };
 
+enum class PartitionerType { NONE, ZPLANE, OCTREE };
+
 } // namespace openmc
 
 #endif // OPENMC_CONSTANTS_H
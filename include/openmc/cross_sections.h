@@ -6,6 +6,7 @@
 #include <map>
 #include <string>
 
+#include "openmc/timer.h"
 #include "openmc/vector.h"
 
 namespace openmc {
@@ -36,6 +37,7 @@ public:
   Type type_;                     //!< Type of data library
   vector<std::string> materials_; //!< Materials contained in library
   std::string path_;              //!< File path to library
+  Timer timer_;                   //!< Time spent reading from the library
 };
 
 using LibraryKey = std::pair<Library::Type, std::string>;
@@ -12,6 +12,7 @@
 #include "openmc/constants.h"
 #include "openmc/memory.h" // for unique_ptr
 #include "openmc/vector.h" // for vector
+#include "openmc/xs_cache.h"
 
 namespace openmc {
 
@@ -222,12 +223,17 @@ public:
   explicit Tabular(pugi::xml_node node);
   Tabular(const double* x, const double* p, int n, Interpolation interp,
     const double* c = nullptr);
+  explicit Tabular(CacheReader& cache);
 
   //! Sample a value from the distribution
   //! \param seed Pseudorandom number seed pointer
   //! \return Sampled value
   double sample(uint64_t* seed) const override;
 
+  //! Write the distribution to the cross section cache
+  //! \param cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
   // properties
   vector<double>& x() { return x_; }
   const vector<double>& x() const { return x_; }
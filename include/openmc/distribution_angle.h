@@ -19,6 +19,7 @@ class AngleDistribution {
 public:
   AngleDistribution() = default;
   explicit AngleDistribution(hid_t group);
+  explicit AngleDistribution(CacheReader& cache);
 
   //! Sample an angle given an incident particle energy
   //! \param[in] E Particle energy in [eV]
@@ -26,6 +27,10 @@ public:
   //! \return Cosine of the angle in the range [-1,1]
   double sample(double E, uint64_t* seed) const;
 
+  //! Write the distribution to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
   //! Determine whether angle distribution is empty
   //! \return Whether distribution is empty
   bool empty() const { return energy_.empty(); }
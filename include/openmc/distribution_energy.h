@@ -9,7 +9,9 @@
 
 #include "openmc/constants.h"
 #include "openmc/endf.h"
+#include "openmc/outgoing_energy.h"
 #include "openmc/vector.h"
+#include "openmc/xs_cache.h"
 
 namespace openmc {
 
@@ -22,6 +24,11 @@ namespace openmc {
 class EnergyDistribution {
 public:
   virtual double sample(double E, uint64_t* seed) const = 0;
+
+  //! Move the tabulated data into memory shared by all processes on the
+  //! node. This is collective over the processes on a node.
+  virtual void share_data() {}
+
   virtual ~EnergyDistribution() = default;
 };
 
@@ -32,6 +39,7 @@ public:
 class DiscretePhoton : public EnergyDistribution {
 public:
   explicit DiscretePhoton(hid_t group);
+  explicit DiscretePhoton(CacheReader& cache);
 
   //! Sample energy distribution
   //! \param[in] E Incident particle energy in [eV]
@@ -39,6 +47,10 @@ public:
   //! \return Sampled energy in [eV]
   double sample(double E, uint64_t* seed) const override;
 
+  //! Write the distribution to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
 private:
   int primary_flag_; //!< Indicator of whether the photon is a primary or
                      //!< non-primary photon.
@@ -53,6 +65,7 @@ private:
 class LevelInelastic : public EnergyDistribution {
 public:
   explicit LevelInelastic(hid_t group);
+  explicit LevelInelastic(CacheReader& cache);
 
   //! Sample energy distribution
   //! \param[in] E Incident particle energy in [eV]
@@ -60,6 +73,10 @@ public:
   //! \return Sampled energy in [eV]
   double sample(double E, uint64_t* seed) const override;
 
+  //! Write the distribution to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
 private:
   double threshold_;  //!< Energy threshold in lab, (A + 1)/A * |Q|
   double mass_ratio_; //!< (A/(A+1))^2
@@ -74,6 +91,7 @@ private:
 class ContinuousTabular : public EnergyDistribution {
 public:
   explicit ContinuousTabular(hid_t group);
+  explicit ContinuousTabular(CacheReader& cache);
 
   //! Sample energy distribution
   //! \param[in] E Incident particle energy in [eV]
@@ -81,21 +99,18 @@ public:
   //! \return Sampled energy in [eV]
   double sample(double E, uint64_t* seed) const override;
 
-private:
-  //! Outgoing energy for a single incoming energy
-  struct CTTable {
-    Interpolation interpolation;  //!< Interpolation law
-    int n_discrete;               //!< Number of of discrete energies
-    xt::xtensor<double, 1> e_out; //!< Outgoing energies in [eV]
-    xt::xtensor<double, 1> p;     //!< Probability density
-    xt::xtensor<double, 1> c;     //!< Cumulative distribution
-  };
+  //! Write the distribution to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
 
+  void share_data() override;
+
+private:
   int n_region_;                        //!< Number of inteprolation regions
   vector<int> breakpoints_;             //!< Breakpoints between regions
   vector<Interpolation> interpolation_; //!< Interpolation laws
   vector<double> energy_;               //!< Incident energy in [eV]
-  vector<CTTable> distribution_; //!< Distributions for each incident energy
+  OutgoingEnergyTables distribution_;  //!< Distribution at each energy
 };
 
 //===============================================================================
@@ -105,6 +120,7 @@ private:
 class Evaporation : public EnergyDistribution {
 public:
   explicit Evaporation(hid_t group);
+  explicit Evaporation(CacheReader& cache);
 
   //! Sample energy distribution
   //! \param[in] E Incident particle energy in [eV]
@@ -112,6 +128,10 @@ public:
   //! \return Sampled energy in [eV]
   double sample(double E, uint64_t* seed) const override;
 
+  //! Write the distribution to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
 private:
   Tabulated1D theta_; //!< Incoming energy dependent parameter
   double u_;          //!< Restriction energy
@@ -125,6 +145,7 @@ private:
 class MaxwellEnergy : public EnergyDistribution {
 public:
   explicit MaxwellEnergy(hid_t group);
+  explicit MaxwellEnergy(CacheReader& cache);
 
   //! Sample energy distribution
   //! \param[in] E Incident particle energy in [eV]
@@ -132,6 +153,10 @@ public:
   //! \return Sampled energy in [eV]
   double sample(double E, uint64_t* seed) const override;
 
+  //! Write the distribution to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
 private:
   Tabulated1D theta_; //!< Incoming energy dependent parameter
   double u_;          //!< Restriction energy
@@ -145,6 +170,7 @@ private:
 class WattEnergy : public EnergyDistribution {
 public:
   explicit WattEnergy(hid_t group);
+  explicit WattEnergy(CacheReader& cache);
 
   //! Sample energy distribution
   //! \param[in] E Incident particle energy in [eV]
@@ -152,6 +178,10 @@ public:
   //! \return Sampled energy in [eV]
   double sample(double E, uint64_t* seed) const override;
 
+  //! Write the distribution to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
 private:
   Tabulated1D a_; //!< Energy-dependent 'a' parameter
   Tabulated1D b_; //!< Energy-dependent 'b' parameter
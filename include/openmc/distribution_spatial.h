@@ -127,6 +127,7 @@ public:
   // Accessors
   const Mesh* mesh() const { return model::meshes.at(mesh_idx_).get(); }
   int32_t n_sources() const { return this->mesh()->n_bins(); }
+  const DiscreteIndex& element_distribution() const { return elem_idx_dist_; }
 
   double total_strength() { return this->elem_idx_dist_.integral(); }
 
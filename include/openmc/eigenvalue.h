@@ -57,8 +57,39 @@ void calculate_average_keff();
 extern "C" int openmc_get_keff(double* k_combined);
 
 //! Sample/redistribute source sites from accumulated fission sites
+//!
+//! With MPI, sites that belong to other processes are sent asynchronously and
+//! only received in finish_bank_exchange().
 void synchronize_bank();
 
+//! Receive the source sites sent by synchronize_bank() from other processes
+//!
+//! This must be called before the source bank is used. It does nothing if
+//! there is no redistribution in progress.
+void finish_bank_exchange();
+
+//! Size in bytes of a source site as sent between processes
+//!
+//! This depends on settings::compact_source_sites.
+size_t site_wire_size();
+
+//! Pack source sites into their wire format
+//!
+//! \param[in] sites Source sites to pack
+//! \param[in] n Number of sites
+//! \param[out] buffer Buffer of at least n * site_wire_size() bytes
+void pack_sites(const SourceSite* sites, int64_t n, char* buffer);
+
+//! Unpack source sites from their wire format
+//!
+//! Surface, parent and progeny IDs are not sent and are set to zero. With
+//! compact source sites, directions are renormalized after being unpacked.
+//!
+//! \param[in] buffer Buffer of n packed sites
+//! \param[in] n Number of sites
+//! \param[out] sites Unpacked source sites
+void unpack_sites(const char* buffer, int64_t n, SourceSite* sites);
+
 //! Calculates the Shannon entropy of the fission source distribution to assess
 //! source convergence
 void shannon_entropy();
@@ -9,6 +9,7 @@
 #include "openmc/constants.h"
 #include "openmc/memory.h"
 #include "openmc/vector.h"
+#include "openmc/xs_cache.h"
 
 namespace openmc {
 
@@ -53,11 +54,19 @@ public:
   //! \param[in] dset Dataset containing coefficients
   explicit Polynomial(hid_t dset);
 
+  //! Construct polynomial from the cross section cache
+  //! \param[in] cache Reader of the cross section cache
+  explicit Polynomial(CacheReader& cache);
+
   //! Evaluate the polynomials
   //! \param[in] x independent variable
   //! \return Polynomial evaluated at x
   double operator()(double x) const override;
 
+  //! Write the polynomial to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
 private:
   vector<double> coef_; //!< Polynomial coefficients
 };
@@ -74,11 +83,19 @@ public:
   //! \param[in] dset Dataset containing tabulated data
   explicit Tabulated1D(hid_t dset);
 
+  //! Construct function from the cross section cache
+  //! \param[in] cache Reader of the cross section cache
+  explicit Tabulated1D(CacheReader& cache);
+
   //! Evaluate the tabulated function
   //! \param[in] x independent variable
   //! \return Function evaluated at x
   double operator()(double x) const override;
 
+  //! Write the function to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
   // Accessors
   const vector<double>& x() const { return x_; }
   const vector<double>& y() const { return y_; }
@@ -134,12 +151,17 @@ class Sum1D : public Function1D {
 public:
   // Constructors
   explicit Sum1D(hid_t group);
+  explicit Sum1D(CacheReader& cache);
 
   //! Evaluate each function and sum results
   //! \param[in] x independent variable
   //! \return Function evaluated at x
   double operator()(double E) const override;
 
+  //! Write each function to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
   const unique_ptr<Function1D>& functions(int i) const { return functions_[i]; }
 
 private:
@@ -152,6 +174,17 @@ private:
 //! \return Unique pointer to 1D function
 unique_ptr<Function1D> read_function(hid_t group, const char* name);
 
+//! Read 1D function from the cross section cache
+//! \param[in] cache Reader of the cross section cache
+//! \return Unique pointer to 1D function, or nullptr if none was written
+unique_ptr<Function1D> read_function(CacheReader& cache);
+
+//! Write 1D function, preceded by its type, to the cross section cache. Throws
+//! std::runtime_error for types of functions that cannot be cached.
+//! \param[in] cache Writer of the cross section cache
+//! \param[in] func Function to write, which may be null
+void write_function(CacheWriter& cache, const Function1D* func);
+
 } // namespace openmc
 
 #endif // OPENMC_ENDF_H
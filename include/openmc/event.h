@@ -65,9 +65,17 @@ extern SharedArray<EventQueueItem> advance_particle_queue;
 extern SharedArray<EventQueueItem> surface_crossing_queue;
 extern SharedArray<EventQueueItem> collision_queue;
 
+// Neutrons that need a cross section lookup when using banked lookups
+extern SharedArray<EventQueueItem> xs_lookup_bank;
+
 // Particle buffer
 extern vector<Particle> particles;
 
+// Scratch storage used when sorting the cross section lookup queues
+extern vector<EventQueueItem> sorted_queue_buffer;
+extern vector<uint64_t> sort_keys;
+extern vector<uint64_t> sorted_keys_buffer;
+
 } // namespace simulation
 
 //==============================================================================
@@ -87,6 +95,22 @@ void free_event_queues(void);
 //! \param buffer_idx The particle's actual index in the particle buffer
 void dispatch_xs_event(int64_t buffer_idx);
 
+//! Compute the radix sort key for an item in a cross section lookup queue
+//
+//! The key orders items by particle type, then by material, and then by the
+//! bin of the logarithmic energy grid that the particle's energy falls in.
+//! Particles that are adjacent after sorting will therefore perform their
+//! nuclide energy grid searches over the same region of memory.
+//
+//! \param item The queue item to compute a key for
+//! \return The sort key
+uint64_t event_sort_key(const EventQueueItem& item);
+
+//! Sort a cross section lookup queue using a parallel LSD radix sort
+//
+//! \param queue A reference to the queue to sort
+void sort_xs_queue(SharedArray<EventQueueItem>& queue);
+
 //! Execute the initialization event for all particles
 //
 //! \param n_particles The number of particles in the particle buffer
@@ -98,6 +122,13 @@ void process_init_events(int64_t n_particles, int64_t source_offset);
 //! \param queue A reference to the desired XS lookup queue
 void process_calculate_xs_events(SharedArray<EventQueueItem>& queue);
 
+//! Calculate neutron cross sections for all particles in the lookup bank
+//
+//! The bank is sorted so that neutrons in the same material are adjacent and
+//! then split into groups of at most XS_LOOKUP_BANK_SIZE neutrons in the same
+//! material, which are passed to Material::calculate_neutron_xs_banked.
+void process_xs_lookup_bank();
+
 //! Execute the advance particle event for all particles in this event's buffer
 void process_advance_particle_events();
 
@@ -77,6 +77,13 @@ void cross_lattice(
 
 BoundaryInfo distance_to_boundary(GeometryState& p);
 
+//==============================================================================
+//! Populate the neighbor lists of cells by tracing rays from the external
+//! source before transport, so that the lists do not grow during transport.
+//==============================================================================
+
+void prepopulate_neighbor_lists();
+
 } // namespace openmc
 
 #endif // OPENMC_GEOMETRY_H
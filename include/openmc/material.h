@@ -56,6 +56,15 @@ public:
 
   void calculate_xs(Particle& p) const;
 
+  //! Calculate neutron cross sections for a bank of particles in this material
+  //
+  //! The loop over nuclides is the outer loop so that each nuclide's energy
+  //! grid and cross sections are traversed for the whole bank at once.
+  //
+  //! \param[in,out] bank Neutrons to calculate cross sections for, at most
+  //!   XS_LOOKUP_BANK_SIZE of them
+  void calculate_neutron_xs_banked(gsl::span<Particle*> bank) const;
+
   //! Assign thermal scattering tables to specific nuclides within the material
   //! so the code knows when to apply bound thermal scattering data
   void init_thermal();
@@ -63,6 +72,18 @@ public:
   //! Set up mapping between global nuclides vector and indices in nuclide_
   void init_nuclide_index();
 
+  //! Build a unionized energy grid over all nuclides in the material with the
+  //! grid index of each nuclide resolved at every union point
+  void init_union_grid();
+
+  //! Rebuild the unionized energy grid after the nuclides have changed
+  void update_union_grid();
+
+  //! Determine the memory used by the unionized energy grid
+  //
+  //! \return Size of the unionized grid data in [bytes]
+  size_t union_grid_memory() const;
+
   //! Finalize the material, assigning tables, normalize density, etc.
   void finalize();
 
@@ -208,10 +229,36 @@ private:
   void calculate_neutron_xs(Particle& p) const;
   void calculate_photon_xs(Particle& p) const;
 
+  //! Find the nuclide grid indices for an energy on the unionized grid
+  //
+  //! \param[in] E Energy in [eV]
+  //! \param[in] i_log_union Log-grid search index
+  //! \return Pointer to the row of union_nuclide_index_ for the energy, or
+  //!   nullptr if no unionized grid exists
+  const int* union_grid_row(double E, int i_log_union) const;
+
+  //! Position of each nuclide of the problem in this material
+  //
+  //! \return Pointer to mat_nuclide_index_, or nullptr if it has not been set
+  //!   up by init_nuclide_index()
+  const int* nuclide_index() const
+  {
+    return mat_nuclide_index_.empty() ? nullptr : mat_nuclide_index_.data();
+  }
+
   //----------------------------------------------------------------------------
   // Private data members
   gsl::index index_;
 
+  // Unionized energy grid. For each union point, union_nuclide_index_ stores
+  // a row of union_row_size_ grid indices; the indices of nuclide i at each of
+  // its temperatures start at union_offset_[i] within the row.
+  vector<double> union_energy_;     //!< Unionized energy points in [eV]
+  vector<int> union_log_index_;     //!< Union index at each log grid point
+  vector<int> union_nuclide_index_; //!< Nuclide grid indices per union point
+  vector<int> union_offset_;        //!< Offset of each nuclide within a row
+  int union_row_size_ {0};          //!< Number of indices per union point
+
   bool depletable_ {false}; //!< Is the material depletable?
   bool fissionable_ {
     false}; //!< Does this material contain fissionable nuclides
@@ -106,7 +106,8 @@ public:
   //! \param[out] bins Bins that were crossed
   //! \param[out] lengths Fraction of tracklength in each bin
   virtual void bins_crossed(Position r0, Position r1, const Direction& u,
-    vector<int>& bins, vector<double>& lengths) const = 0;
+    FilterMatchVector<int>& bins,
+    FilterMatchVector<double>& lengths) const = 0;
 
   //! Determine which surface bins were crossed by a particle
   //
@@ -114,8 +115,21 @@ public:
   //! \param[in] r1 Current position of the particle
   //! \param[in] u Particle direction
   //! \param[out] bins Surface bins that were crossed
-  virtual void surface_bins_crossed(
-    Position r0, Position r1, const Direction& u, vector<int>& bins) const = 0;
+  virtual void surface_bins_crossed(Position r0, Position r1,
+    const Direction& u, FilterMatchVector<int>& bins) const = 0;
+
+  //! Determine which bins and surface bins were crossed by a particle. Meshes
+  //! that can find both in a single traversal override this method.
+  //
+  //! \param[in] r0 Previous position of the particle
+  //! \param[in] r1 Current position of the particle
+  //! \param[in] u Particle direction
+  //! \param[out] bins Bins that were crossed
+  //! \param[out] lengths Fraction of tracklength in each bin
+  //! \param[out] surfaces Surface bins that were crossed
+  virtual void bins_and_surfaces_crossed(Position r0, Position r1,
+    const Direction& u, FilterMatchVector<int>& bins,
+    FilterMatchVector<double>& lengths, FilterMatchVector<int>& surfaces) const;
 
   //! Get bin at a given position in space
   //
@@ -226,10 +240,15 @@ public:
   int n_surface_bins() const override;
 
   void bins_crossed(Position r0, Position r1, const Direction& u,
-    vector<int>& bins, vector<double>& lengths) const override;
+    FilterMatchVector<int>& bins,
+    FilterMatchVector<double>& lengths) const override;
 
   void surface_bins_crossed(Position r0, Position r1, const Direction& u,
-    vector<int>& bins) const override;
+    FilterMatchVector<int>& bins) const override;
+
+  void bins_and_surfaces_crossed(Position r0, Position r1, const Direction& u,
+    FilterMatchVector<int>& bins, FilterMatchVector<double>& lengths,
+    FilterMatchVector<int>& surfaces) const override;
 
   //! Determine which cell or surface bins were crossed by a particle
   //
@@ -368,6 +387,17 @@ public:
   // Overridden methods
   int get_index_in_direction(double r, int i) const override;
 
+  void bins_crossed(Position r0, Position r1, const Direction& u,
+    FilterMatchVector<int>& bins,
+    FilterMatchVector<double>& lengths) const override;
+
+  void surface_bins_crossed(Position r0, Position r1, const Direction& u,
+    FilterMatchVector<int>& bins) const override;
+
+  void bins_and_surfaces_crossed(Position r0, Position r1, const Direction& u,
+    FilterMatchVector<int>& bins, FilterMatchVector<double>& lengths,
+    FilterMatchVector<int>& surfaces) const override;
+
   virtual std::string get_mesh_type() const override;
 
   static const std::string mesh_type;
@@ -418,6 +448,17 @@ public:
   // Overridden methods
   int get_index_in_direction(double r, int i) const override;
 
+  void bins_crossed(Position r0, Position r1, const Direction& u,
+    FilterMatchVector<int>& bins,
+    FilterMatchVector<double>& lengths) const override;
+
+  void surface_bins_crossed(Position r0, Position r1, const Direction& u,
+    FilterMatchVector<int>& bins) const override;
+
+  void bins_and_surfaces_crossed(Position r0, Position r1, const Direction& u,
+    FilterMatchVector<int>& bins, FilterMatchVector<double>& lengths,
+    FilterMatchVector<int>& surfaces) const override;
+
   virtual std::string get_mesh_type() const override;
 
   static const std::string mesh_type;
@@ -598,7 +639,7 @@ public:
   // Overridden Methods
 
   void surface_bins_crossed(Position r0, Position r1, const Direction& u,
-    vector<int>& bins) const override;
+    FilterMatchVector<int>& bins) const override;
 
   void to_hdf5(hid_t group) const override;
 
@@ -698,7 +739,8 @@ public:
   Position sample_element(int32_t bin, uint64_t* seed) const override;
 
   void bins_crossed(Position r0, Position r1, const Direction& u,
-    vector<int>& bins, vector<double>& lengths) const override;
+    FilterMatchVector<int>& bins,
+    FilterMatchVector<double>& lengths) const override;
 
   int get_bin(Position r) const override;
 
@@ -861,7 +903,8 @@ public:
 
   // Overridden Methods
   void bins_crossed(Position r0, Position r1, const Direction& u,
-    vector<int>& bins, vector<double>& lengths) const override;
+    FilterMatchVector<int>& bins,
+    FilterMatchVector<double>& lengths) const override;
 
   Position sample_element(int32_t bin, uint64_t* seed) const override;
 
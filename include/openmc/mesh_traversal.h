@@ -0,0 +1,142 @@
+//! \file mesh_traversal.h
+//! \brief Per-particle cache of mesh traversals shared by mesh tallies and
+//! weight windows
+
+#ifndef OPENMC_MESH_TRAVERSAL_H
+#define OPENMC_MESH_TRAVERSAL_H
+
+#include <cstdint> // for int32_t, int64_t
+
+#include "openmc/position.h"
+#include "openmc/tallies/filter_match.h"
+#include "openmc/vector.h"
+
+namespace openmc {
+
+//==============================================================================
+// Global variables
+//==============================================================================
+
+//! Lookups of a mesh that are cached because more than one mesh filter or
+//! weight window makes them
+struct MeshTraversalUse {
+  int32_t mesh;  //!< Index of the mesh
+  bool tracks;   //!< Whether the bins crossed by segments are cached
+  bool surfaces; //!< Whether the surface bins crossed by segments are cached
+  bool points;   //!< Whether the bins at positions are cached
+};
+
+namespace model {
+
+//! Meshes whose traversals are cached, each with one slot in the cache of
+//! every particle
+extern vector<MeshTraversalUse> cached_meshes;
+
+//! Index in cached_meshes of each mesh, or C_NONE if it is not cached
+extern vector<int> mesh_traversal_slots;
+
+} // namespace model
+
+namespace simulation {
+
+extern int64_t mesh_traversal_hits;   //!< Lookups answered from the cache
+extern int64_t mesh_traversal_misses; //!< Lookups that traced the mesh
+
+} // namespace simulation
+
+//==============================================================================
+//! Traversals of the meshes used by more than one mesh filter or weight window
+//! for the track segment and position of a particle.
+//
+//! When several consumers use the same mesh, such as a mesh filter, a mesh
+//! surface filter, and weight windows, each would otherwise trace the mesh
+//! for the same segment. The first lookup for a segment traces the mesh once
+//! for the bins and the surface bins needed by all of them, and the following
+//! lookups copy the stored results. Entries are keyed by the segment rather
+//! than by the event so that a track-length tally scored when the particle
+//! advances shares the traversal with the mesh surface tallies scored at the
+//! next collision, which use the same segment unless a surface was crossed in
+//! between. Lookups for meshes without a slot are passed to the mesh.
+//==============================================================================
+
+class MeshTraversalCache {
+public:
+  //! Determine which bins of a mesh were crossed by a particle
+  //
+  //! \param[in] mesh Index of the mesh
+  //! \param[in] r0 Previous position of the particle
+  //! \param[in] r1 Current position of the particle
+  //! \param[in] u Particle direction
+  //! \param[out] bins Bins that were crossed
+  //! \param[out] lengths Fraction of tracklength in each bin
+  void bins_crossed(int32_t mesh, Position r0, Position r1, const Direction& u,
+    FilterMatchVector<int>& bins, FilterMatchVector<double>& lengths);
+
+  //! Determine which surface bins of a mesh were crossed by a particle
+  //
+  //! \param[in] mesh Index of the mesh
+  //! \param[in] r0 Previous position of the particle
+  //! \param[in] r1 Current position of the particle
+  //! \param[in] u Particle direction
+  //! \param[out] bins Surface bins that were crossed
+  void surface_bins_crossed(int32_t mesh, Position r0, Position r1,
+    const Direction& u, FilterMatchVector<int>& bins);
+
+  //! Get the bin of a mesh at a given position
+  //
+  //! \param[in] mesh Index of the mesh
+  //! \param[in] r Position to get the bin for
+  //! \return Mesh bin
+  int get_bin(int32_t mesh, Position r);
+
+  //! Invalidate all entries, e.g., when a new history starts
+  void clear();
+
+  //! Add the numbers of hits and misses to the global counters and reset them
+  void accumulate();
+
+  int64_t n_hits() const { return n_hits_; }
+  int64_t n_misses() const { return n_misses_; }
+
+private:
+  //! Traversal of one mesh
+  struct Entry {
+    Position r0;               //!< Start of the traced segment
+    Position r1;               //!< End of the traced segment
+    Direction u;               //!< Direction of the traced segment
+    bool has_tracks {false};   //!< Whether bins and lengths are valid
+    bool has_surfaces {false}; //!< Whether surfaces are valid
+    vector<int> bins;          //!< Bins crossed by the segment
+    vector<double> lengths;    //!< Fraction of the segment in each bin
+    vector<int> surfaces;      //!< Surface bins crossed by the segment
+
+    Position r;           //!< Position of the last point lookup
+    int bin;              //!< Bin at the position of the last point lookup
+    bool located {false}; //!< Whether the point lookup is valid
+  };
+
+  //! Get the entry of a mesh, tracing the segment if it is not cached
+  //
+  //! \param[in] slot Slot of the mesh in the cache
+  //! \param[in] tracks Whether the bins and lengths are needed
+  //! \param[in] surfaces Whether the surface bins are needed
+  const Entry& traverse(int slot, Position r0, Position r1, const Direction& u,
+    bool tracks, bool surfaces);
+
+  vector<Entry> entries_; //!< Traversal of each cached mesh
+  int64_t n_hits_ {0};    //!< Lookups answered from the cache
+  int64_t n_misses_ {0};  //!< Lookups that traced or searched the mesh
+};
+
+//==============================================================================
+// Non-member functions
+//==============================================================================
+
+//! Determine which lookups of each mesh are made by more than one mesh filter
+//! or weight window and give the meshes with such lookups a slot in the
+//! traversal caches
+void prepare_mesh_traversal_caches();
+
+} // namespace openmc
+
+#endif // OPENMC_MESH_TRAVERSAL_H
@@ -19,6 +19,9 @@ extern bool master;
 #ifdef OPENMC_MPI
 extern MPI_Datatype source_site;
 extern MPI_Comm intracomm;
+extern MPI_Comm node_comm;   //!< Processes that can share memory
+extern MPI_Comm leader_comm; //!< First process on each node (null on others)
+extern MPI_Comm bank_comm;   //!< Duplicate of intracomm for source sites
 #endif
 
 // Calculates global indices of the bank particles
@@ -1,64 +1,181 @@
 #ifndef OPENMC_NEIGHBOR_LIST_H
 #define OPENMC_NEIGHBOR_LIST_H
 
-#include <algorithm>
+#include <atomic>
 #include <cstdint>
-#include <forward_list>
-#include <mutex>
+#include <iterator> // for forward_iterator_tag
 
-#include "openmc/openmp_interface.h"
+#include "openmc/memory.h" // for unique_ptr
 
 namespace openmc {
 
 //==============================================================================
 //! A threadsafe, dynamic container for listing neighboring cells.
 //
-//! This container is a reduced interface for a linked list with an added OpenMP
-//! lock for write operations.  It allows for threadsafe dynamic growth; any
-//! number of threads can safely read data without locks or reference counting.
+//! Elements are stored contiguously in a chain of fixed-capacity blocks, each
+//! twice the size of the previous one. Appending claims the first empty slot
+//! with an atomic compare-and-swap, so writers never block and an element is
+//! never stored twice. Readers take no locks and visit at most one slot per
+//! element plus one, regardless of concurrent appends.
 //==============================================================================
 
 class NeighborList {
 public:
   using value_type = int32_t;
-  using const_iterator = std::forward_list<value_type>::const_iterator;
 
-  // Attempt to add an element.
+private:
+  //! Value of a slot that has not been claimed yet
+  static constexpr value_type EMPTY {-1};
+
+  //! Number of slots in the first block
+  static constexpr int FIRST_BLOCK_SIZE {8};
+
+  struct Block {
+    explicit Block(int n)
+      : size {n}, slots {make_unique<std::atomic<value_type>[]>(n)}
+    {
+      for (int i = 0; i < n; ++i)
+        slots[i].store(EMPTY, std::memory_order_relaxed);
+    }
+
+    const int size;                              //!< Number of slots
+    unique_ptr<std::atomic<value_type>[]> slots; //!< Elements
+    std::atomic<Block*> next {nullptr};          //!< Following block
+  };
+
+public:
+  //! Iterator over the elements that were present when each was reached
+  class const_iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = NeighborList::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    explicit const_iterator(const Block* block) : block_ {block}
+    {
+      this->load();
+    }
+
+    reference operator*() const { return value_; }
+
+    const_iterator& operator++()
+    {
+      if (++i_ == block_->size) {
+        block_ = block_->next.load(std::memory_order_acquire);
+        i_ = 0;
+      }
+      this->load();
+      return *this;
+    }
+
+    //! Iterators compare equal when both have reached the end of the list
+    bool operator==(const const_iterator& other) const
+    {
+      if (value_ == EMPTY || other.value_ == EMPTY)
+        return value_ == other.value_;
+      return block_ == other.block_ && i_ == other.i_;
+    }
+
+    bool operator!=(const const_iterator& other) const
+    {
+      return !(*this == other);
+    }
+
+  private:
+    void load()
+    {
+      value_ = EMPTY;
+      if (block_)
+        value_ = block_->slots[i_].load(std::memory_order_acquire);
+    }
+
+    const Block* block_; //!< Block containing the current element
+    int i_ {0};          //!< Slot of the current element within the block
+    value_type value_;   //!< Current element, or EMPTY at the end
+  };
+
+  NeighborList() = default;
+
+  NeighborList(const NeighborList& other) { this->copy(other); }
+
+  NeighborList& operator=(const NeighborList& other)
+  {
+    if (this != &other) {
+      this->clear();
+      this->copy(other);
+    }
+    return *this;
+  }
+
+  ~NeighborList() { this->clear(); }
+
+  //! Add an element if it is not already present
   //
-  // If the relevant OpenMP lock is currently owned by another thread, this
-  // function will return without actually modifying the data.  It has been
-  // found that returning the transport calculation and possibly re-adding the
-  // element later is slightly faster than waiting on the lock to be released.
-  void push_back(int new_elem)
+  //! Threads appending concurrently contend for the same first empty slot, so
+  //! a thread that loses the race sees the winning element before moving on.
+  void push_back(value_type new_elem)
   {
-    // Try to acquire the lock.
-    std::unique_lock<OpenMPMutex> lock(mutex_, std::try_to_lock);
-    if (lock) {
-      // It is possible another thread already added this element to the list
-      // while this thread was searching for a cell so make sure the given
-      // element isn't a duplicate before adding it.
-      if (std::find(list_.cbegin(), list_.cend(), new_elem) == list_.cend()) {
-        // Find the end of the list and add the the new element there.
-        if (!list_.empty()) {
-          auto it1 = list_.cbegin();
-          auto it2 = ++list_.cbegin();
-          while (it2 != list_.cend())
-            it1 = it2++;
-          list_.insert_after(it1, new_elem);
+    std::atomic<Block*>* link = &head_;
+    int block_size = FIRST_BLOCK_SIZE;
+    while (true) {
+      Block* block = link->load(std::memory_order_acquire);
+      if (!block) {
+        // Append a new block, discarding it if another thread got there first
+        Block* new_block = new Block(block_size);
+        if (link->compare_exchange_strong(
+              block, new_block, std::memory_order_acq_rel)) {
+          block = new_block;
         } else {
-          list_.push_front(new_elem);
+          delete new_block;
+        }
+      }
+
+      for (int i = 0; i < block->size; ++i) {
+        value_type elem = block->slots[i].load(std::memory_order_acquire);
+        if (elem == EMPTY &&
+            block->slots[i].compare_exchange_strong(
+              elem, new_elem, std::memory_order_acq_rel)) {
+          return;
         }
+        // The slot is now claimed and elem holds its value
+        if (elem == new_elem)
+          return;
       }
+
+      link = &block->next;
+      block_size = 2 * block->size;
     }
   }
 
-  const_iterator cbegin() const { return list_.cbegin(); }
+  const_iterator cbegin() const
+  {
+    return const_iterator(head_.load(std::memory_order_acquire));
+  }
 
-  const_iterator cend() const { return list_.cend(); }
+  const_iterator cend() const { return const_iterator(nullptr); }
 
 private:
-  std::forward_list<value_type> list_;
-  OpenMPMutex mutex_;
+  //! Append the elements of another list. Not threadsafe.
+  void copy(const NeighborList& other)
+  {
+    for (auto it = other.cbegin(); it != other.cend(); ++it)
+      this->push_back(*it);
+  }
+
+  //! Remove all elements. Not threadsafe.
+  void clear()
+  {
+    Block* block = head_.exchange(nullptr, std::memory_order_relaxed);
+    while (block) {
+      Block* next = block->next.load(std::memory_order_relaxed);
+      delete block;
+      block = next;
+    }
+  }
+
+  std::atomic<Block*> head_ {nullptr}; //!< First block, allocated on demand
 };
 
 } // namespace openmc
@@ -0,0 +1,171 @@
+#ifndef OPENMC_NODE_SHARED_H
+#define OPENMC_NODE_SHARED_H
+
+//! \file node_shared.h
+//! \brief Arrays that can be stored once for all processes on a node
+
+#include <algorithm> // for copy
+#include <cstddef>   // for size_t
+#include <type_traits>
+#include <utility> // for move
+
+#include "xtensor/xtensor.hpp"
+#include <gsl/gsl-lite.hpp>
+
+#include "openmc/array.h"
+#include "openmc/vector.h"
+
+namespace openmc {
+
+//==============================================================================
+// Non-member functions
+//==============================================================================
+
+//! Allocate memory that is shared by all processes on a node
+//
+//! This is collective over the processes on a node, which must all request
+//! the same sizes in the same order. Only the process for which
+//! node_shared_writer() is true may write to the memory, and no process may
+//! read from it until node_shared_fence() has been called.
+//
+//! \param bytes  Number of bytes to allocate
+//! \return Pointer to the memory, or nullptr if there are no other processes
+//!   on the node to share memory with
+void* node_shared_allocate(size_t bytes);
+
+//! Determine whether this process writes the contents of node-shared memory
+//
+//! \return Whether this is the first process on its node
+bool node_shared_writer();
+
+//! Make the contents of node-shared memory visible to all processes on the
+//! node. This is collective over the processes on a node.
+void node_shared_fence();
+
+//! Determine the amount of node-shared memory that has been allocated
+//
+//! \return Size of the allocations in [bytes]
+size_t node_shared_memory();
+
+//! Free all node-shared memory. This is collective over the processes on a
+//! node, and no array that refers to node-shared memory may be used afterwards.
+void free_memory_node_shared();
+
+//==============================================================================
+//! Read-only array whose elements are either owned by this process or, once
+//! share() has been called, stored once in memory shared by all processes on
+//! the same node. Two-dimensional arrays are stored in row-major order.
+//==============================================================================
+
+template<typename T>
+class NodeSharedArray {
+  static_assert(std::is_trivially_copyable<T>::value,
+    "Node-shared arrays can only hold trivially copyable types");
+
+public:
+  //============================================================================
+  // Constructors
+
+  NodeSharedArray() = default;
+
+  //! Take ownership of the elements of a vector
+  NodeSharedArray(vector<T>&& values)
+    : owned_ {std::move(values)}, shape_ {owned_.size(), 1}
+  {
+    data_ = owned_.data();
+  }
+
+  //! Copy the elements of a two-dimensional tensor
+  explicit NodeSharedArray(const xt::xtensor<T, 2>& values)
+    : owned_(values.data(), values.data() + values.size()),
+      shape_ {values.shape()[0], values.shape()[1]}
+  {
+    data_ = owned_.data();
+  }
+
+  NodeSharedArray(const NodeSharedArray& other)
+    : owned_ {other.owned_}, shape_ {other.shape_}, shared_ {other.shared_}
+  {
+    data_ = shared_ ? other.data_ : owned_.data();
+  }
+
+  NodeSharedArray(NodeSharedArray&& other) noexcept
+    : owned_ {std::move(other.owned_)}, data_ {other.data_},
+      shape_ {other.shape_}, shared_ {other.shared_}
+  {
+    other.data_ = nullptr;
+    other.shape_ = {0, 1};
+    other.shared_ = false;
+  }
+
+  NodeSharedArray& operator=(NodeSharedArray other) noexcept
+  {
+    std::swap(owned_, other.owned_);
+    std::swap(data_, other.data_);
+    std::swap(shape_, other.shape_);
+    std::swap(shared_, other.shared_);
+    return *this;
+  }
+
+  //============================================================================
+  // Methods
+
+  //! Move the elements into node-shared memory and release the memory owned by
+  //! this process. This is collective over the processes on a node, and the
+  //! elements may not be read until node_shared_fence() has been called. If
+  //! there is nothing to share memory with, the elements remain owned.
+  void share()
+  {
+    if (shared_ || owned_.empty())
+      return;
+    T* p = static_cast<T*>(node_shared_allocate(owned_.size() * sizeof(T)));
+    if (!p)
+      return;
+    if (node_shared_writer())
+      std::copy(owned_.begin(), owned_.end(), p);
+    data_ = p;
+    shared_ = true;
+    vector<T>().swap(owned_);
+  }
+
+  //! Whether the elements are stored in node-shared memory
+  bool shared() const { return shared_; }
+
+  //============================================================================
+  // Accessors
+
+  const T* data() const { return data_; }
+  size_t size() const { return shape_[0] * shape_[1]; }
+  bool empty() const { return size() == 0; }
+
+  //! Number of rows and columns
+  const array<size_t, 2>& shape() const { return shape_; }
+
+  const T& operator[](size_t i) const { return data_[i]; }
+  const T& operator()(size_t i, size_t j) const
+  {
+    return data_[i * shape_[1] + j];
+  }
+
+  const T& front() const { return data_[0]; }
+  const T& back() const { return data_[size() - 1]; }
+  const T* begin() const { return data_; }
+  const T* end() const { return data_ + size(); }
+  const T* cbegin() const { return begin(); }
+  const T* cend() const { return end(); }
+
+  operator gsl::span<const T>() const { return {data_, size()}; }
+
+private:
+  //============================================================================
+  // Data members
+
+  vector<T> owned_;               //!< Elements owned by this process
+  const T* data_ {nullptr};       //!< Pointer to the elements
+  array<size_t, 2> shape_ {0, 1}; //!< Number of rows and columns
+  bool shared_ {false};           //!< Whether elements are node-shared
+};
+
+} // namespace openmc
+
+#endif // OPENMC_NODE_SHARED_H
@@ -4,6 +4,8 @@
 #ifndef OPENMC_NUCLIDE_H
 #define OPENMC_NUCLIDE_H
 
+#include <cstdint> // for uint64_t
+#include <cstring> // for memcpy
 #include <unordered_map>
 #include <utility> // for pair
 
@@ -14,12 +16,14 @@
 #include "openmc/constants.h"
 #include "openmc/endf.h"
 #include "openmc/memory.h" // for unique_ptr
+#include "openmc/node_shared.h"
 #include "openmc/particle.h"
 #include "openmc/reaction.h"
 #include "openmc/reaction_product.h"
 #include "openmc/urr.h"
 #include "openmc/vector.h"
 #include "openmc/wmp.h"
+#include "openmc/xs_cache.h"
 
 namespace openmc {
 
@@ -33,28 +37,93 @@ public:
   // Types, aliases
   using EmissionMode = ReactionProduct::EmissionMode;
   struct EnergyGrid {
-    vector<int> grid_index;
-    vector<double> energy;
+    vector<int> grid_index;         //!< Grid index at each log grid point
+    NodeSharedArray<double> energy; //!< Energy points in [eV]
+    vector<int> hash_index;         //!< Grid index at each hash bin edge
+    uint64_t hash_key_min;          //!< Hash key of the lowest energy point
+    int hash_shift;                 //!< Low bits dropped to form hash keys
   };
 
   //============================================================================
   // Constructors/destructors
+
+  //! Read a nuclide from HDF5 or the cross section cache. Data derived from
+  //! the reactions are not available until create_derived() has been called.
+  //
+  //! \param[in] group HDF5 group of the nuclide
+  //! \param[in] temperature Temperatures in [K]
   Nuclide(hid_t group, const vector<double>& temperature);
+
+  //! Create an empty nuclide whose data are set by the caller, e.g., with
+  //! synthetic cross sections for benchmarks
+  Nuclide() = default;
   ~Nuclide();
 
   //============================================================================
   // Methods
 
-  //! Initialize logarithmic grid for energy searches
+  //! Compute the total, absorption, fission, nu-fission, and photon
+  //! production cross sections and other data derived from the reactions. This
+  //! only accesses data of the nuclide itself, so it can be called for
+  //! different nuclides concurrently.
+  void create_derived();
+
+  //! Initialize logarithmic or hashed grid for energy searches
   void init_grid();
 
+  //! Move the energy grids and the nuclide and reaction cross sections into
+  //! memory that is shared by all processes on the node. This is collective
+  //! over the processes on a node.
+  void share_data();
+
+  //! Determine the memory used by data that accelerates energy grid searches
+  //
+  //! \return Size of the search data in [bytes]
+  size_t grid_search_memory() const;
+
+  //! Determine the index on the energy grid at a given temperature
+  //
+  //! \param[in] i_temp  Temperature index
+  //! \param[in] i_log_union  Log-grid search index
+  //! \param[in] i_union  Grid index at each temperature on a material
+  //!   unionized grid, or nullptr if a unionized grid is not used
+  //! \param[in] E  Energy in [eV]
+  //! \return Index of the lower bounding point on the energy grid
+  int find_grid_index(
+    int i_temp, int i_log_union, const int* i_union, double E) const;
+
   //! Calculate microscopic cross sections
   //
   //! \param[in] i_sab  Index in data::thermal_scatt
   //! \param[in] i_log_union  Log-grid search index
   //! \param[in] sab_frac  S(a,b) table fraction
   //! \param[in,out] p  Particle object
-  void calculate_xs(int i_sab, int i_log_union, double sab_frac, Particle& p);
+  //! \param[in] i_union  Grid index at each temperature on a material
+  //!   unionized grid, or nullptr if a unionized grid is not used
+  void calculate_xs(int i_sab, int i_log_union, double sab_frac, Particle& p,
+    const int* i_union = nullptr);
+
+  //! Calculate microscopic cross sections for a bank of particles
+  //
+  //! Particles whose cross sections require S(a,b) tables or NCrystal are
+  //! handled individually by calculate_xs. Windowed multipole cross sections
+  //! are evaluated for all remaining particles in the resolved resonance range
+  //! at once. For the other particles, the energy grid search and the
+  //! interpolation of the cross sections are performed in separate passes over
+  //! the whole bank.
+  //
+  //! \param[in] i_sab  Index in data::thermal_scatt for each particle
+  //! \param[in] i_log_union  Log-grid search index for each particle
+  //! \param[in] sab_frac  S(a,b) table fraction
+  //! \param[in] ncrystal_xs  Thermal scattering xs from NCrystal for each
+  //!   particle
+  //! \param[in] i_union  Grid indices on a material unionized grid for each
+  //!   particle, or nullptr if a unionized grid is not used
+  //! \param[in,out] bank  Particles to calculate cross sections for, at most
+  //!   XS_LOOKUP_BANK_SIZE of them
+  void calculate_xs_banked(const int* i_sab, const int* i_log_union,
+    double sab_frac, const double* ncrystal_xs, const int* const* i_union,
+    gsl::span<Particle*> bank);
 
   //! Calculate thermal scattering cross section
   //
@@ -86,6 +155,14 @@ public:
 
   //============================================================================
   // Data members
+
+  // Columns of the cross sections in xs_
+  static int XS_TOTAL;
+  static int XS_ABSORPTION;
+  static int XS_FISSION;
+  static int XS_NU_FISSION;
+  static int XS_PHOTON_PROD;
+
   std::string name_; //!< Name of nuclide, e.g. "U235"
   int Z_;            //!< Atomic number
   int A_;            //!< Mass number
@@ -94,9 +171,10 @@ public:
   gsl::index index_; //!< Index in the nuclides array
 
   // Temperature dependent cross section data
-  vector<double> kTs_;                //!< temperatures in eV (k*T)
-  vector<EnergyGrid> grid_;           //!< Energy grid at each temperature
-  vector<xt::xtensor<double, 2>> xs_; //!< Cross sections at each temperature
+  vector<double> kTs_;                 //!< temperatures in eV (k*T)
+  bool single_temperature_ {false};    //!< Data available at one temperature?
+  vector<EnergyGrid> grid_;            //!< Energy grid at each temperature
+  vector<NodeSharedArray<double>> xs_; //!< Cross sections at each temperature
 
   // Multipole data
   unique_ptr<WindowedMultipole> multipole_;
@@ -131,8 +209,21 @@ public:
   vector<int> index_inelastic_scatter_;
 
 private:
-  void create_derived(
-    const Function1D* prompt_photons, const Function1D* delayed_photons);
+  //! Read data at the given temperatures from HDF5, apart from the kT values
+  //
+  //! \param[in] group HDF5 group of the nuclide
+  //! \param[in] temps_to_read Temperatures in [K] to read
+  void read_data(hid_t group, const vector<int>& temps_to_read);
+
+  //! Write the data read by read_data() to the cross section cache
+  //
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
+  //! Read the data written by serialize() from the cross section cache
+  //
+  //! \param[in] cache Reader of the cross section cache
+  void deserialize(CacheReader& cache);
 
   //! Determine temperature index and interpolation factor
   //
@@ -140,11 +231,31 @@ private:
   //! \return Temperature index and interpolation factor
   std::pair<gsl::index, double> find_temperature(double T) const;
 
-  static int XS_TOTAL;
-  static int XS_ABSORPTION;
-  static int XS_FISSION;
-  static int XS_NU_FISSION;
-  static int XS_PHOTON_PROD;
+  //! Determine temperature index for a cross section lookup
+  //
+  //! \param[in] kT Temperature in [eV]
+  //! \param[inout] seed Pseudorandom seed pointer, used when interpolating
+  //! \return Temperature index
+  int temperature_index(double kT, uint64_t* seed) const;
+
+  //! Calculate cross sections for reactions needed for depletion
+  //
+  //! \param[in] i_temp Temperature index
+  //! \param[in] i_grid Energy grid index
+  //! \param[in] f Interpolation factor on the energy grid
+  //! \param[out] micro Microscopic cross sections to update
+  void calculate_depletion_xs(
+    int i_temp, int i_grid, double f, NuclideMicroXS& micro) const;
+
+  //! Store cross sections evaluated from windowed multipole data
+  //
+  //! \param[in] E Energy in [eV]
+  //! \param[in] sig_s Elastic scattering cross section in [b]
+  //! \param[in] sig_a Absorption cross section in [b]
+  //! \param[in] sig_f Fission cross section in [b]
+  //! \param[out] micro Microscopic cross sections to update
+  void set_multipole_xs(double E, double sig_s, double sig_a, double sig_f,
+    NuclideMicroXS& micro) const;
 };
 
 //==============================================================================
@@ -154,6 +265,52 @@ private:
 //! Checks for the right version of nuclear data within HDF5 files
 void check_data_version(hid_t file_id);
 
+//! Read a nuclide along with its windowed multipole data and the photon
+//! interaction data of its element, as needed
+//
+//! This works like openmc_load_nuclide() except that Nuclide::create_derived()
+//! is not called, so that the derived data can be computed while further
+//! libraries are read.
+//
+//! \param[in] name Name of the nuclide
+//! \param[in] temps Temperatures in [K]
+//! \param[in] n Number of temperatures
+//! \param[out] nuc Nuclide that was read, or nullptr if it was already loaded
+//! \return Error code
+int read_nuclide(const char* name, const double* temps, int n, Nuclide*& nuc);
+
+//! Revert to the nearest temperature method if a nuclide only has cross
+//! sections at one temperature and interpolation was requested
+//
+//! This changes settings::temperature_method, so it must not be called while
+//! other threads may be reading the settings.
+//
+//! \param[in] nuc Nuclide that was read
+void revert_temperature_method(const Nuclide& nuc);
+
+//! Determine the index on an energy grid of each point on the logarithmic grid
+//! used to accelerate energy grid searches
+//
+//! \param[in] energy Energy grid in [eV]
+//! \return Index of the lower bounding point at each logarithmic grid point
+vector<int> log_grid_index(gsl::span<const double> energy);
+
+//! Determine the hash key of an energy
+//
+//! Hash keys are formed from the bits of the IEEE 754 representation of the
+//! energy, which increase monotonically with the energy and are approximately
+//! logarithmic in it. Dropping low mantissa bits widens the hash bins.
+//
+//! \param[in] E Energy in [eV]
+//! \param[in] shift Number of low bits to drop
+//! \return Hash key
+inline uint64_t energy_hash_key(double E, int shift)
+{
+  uint64_t bits;
+  std::memcpy(&bits, &E, sizeof(double));
+  return bits >> shift;
+}
+
 bool multipole_in_range(const Nuclide& nuc, double E);
 
 //==============================================================================
@@ -0,0 +1,130 @@
+//! \file outgoing_energy.h
+//! Tabulated outgoing energy distributions of secondary particles
+
+#ifndef OPENMC_OUTGOING_ENERGY_H
+#define OPENMC_OUTGOING_ENERGY_H
+
+#include <cstddef> // for size_t
+
+#include "xtensor/xarray.hpp"
+
+#include "openmc/constants.h"
+#include "openmc/node_shared.h"
+#include "openmc/vector.h"
+#include "openmc/xs_cache.h"
+
+namespace openmc {
+
+//==============================================================================
+//! Outgoing energy distributions tabulated at each incoming energy of a
+//! secondary distribution (ACE laws 4, 44, and 61). Each table gives a number
+//! of fields, such as the outgoing energy, PDF, and CDF, at its outgoing
+//! energies, of which the first few are discrete lines. The fields of all
+//! tables are stored in a single contiguous buffer, one table after the other.
+//!
+//! Each table has a guide table that gives, for equal-probability bins of the
+//! CDF, the first bin of the continuous distribution that can hold a sampled
+//! CDF value in the bin. This replaces the linear search of the CDF with a
+//! search of a few bins while selecting exactly the same bin.
+//==============================================================================
+
+class OutgoingEnergyTables {
+public:
+  //! Fields stored for every table
+  enum Field { E_OUT, PDF, CDF };
+
+  //! Bin of a table in which a sampled CDF value lies
+  struct Bin {
+    int k;       //!< Index of the outgoing energy at the lower bound
+    double c_k;  //!< CDF value at the lower bound
+    double c_k1; //!< CDF value at the upper bound
+  };
+
+  //============================================================================
+  // Constructors
+
+  OutgoingEnergyTables() = default;
+
+  //! Create tables from a distribution read from HDF5
+  //
+  //! \param[in] eout  Outgoing energy data with one row per field and the
+  //!   tables one after the other in each row
+  //! \param[in] offsets  Index of the start of each table in eout
+  //! \param[in] interpolation  Interpolation law of each table
+  //! \param[in] n_discrete  Number of discrete lines of each table
+  //! \param[in] n_fields  Number of rows of eout to store
+  OutgoingEnergyTables(const xt::xarray<double>& eout,
+    const vector<int>& offsets, const vector<int>& interpolation,
+    const vector<int>& n_discrete, int n_fields);
+
+  explicit OutgoingEnergyTables(CacheReader& cache);
+
+  //============================================================================
+  // Methods
+
+  //! Find the bin of a table in which a sampled CDF value lies. The discrete
+  //! lines are searched first, followed by the continuous distribution.
+  //
+  //! \param[in] i  Index of the table
+  //! \param[in] xi  Sampled CDF value in [0, 1)
+  //! \return Bin in which the value lies
+  Bin find_bin(int i, double xi) const;
+
+  //! Write the tables to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
+  //! Move the fields and guide tables into memory shared by all processes on
+  //! the node. This is collective over the processes on a node.
+  void share_data();
+
+  //============================================================================
+  // Accessors
+
+  //! Number of tables
+  size_t size() const { return tables_.size(); }
+
+  //! Number of outgoing energies of a table
+  int n(int i) const { return tables_[i].n; }
+
+  //! Number of discrete lines of a table
+  int n_discrete(int i) const { return tables_[i].n_discrete; }
+
+  //! Interpolation law of a table
+  Interpolation interpolation(int i) const { return tables_[i].interpolation; }
+
+  //! Index of the first outgoing energy of a table among those of all tables
+  int start(int i) const { return tables_[i].start; }
+
+  //! Values of a field of a table at each outgoing energy
+  const double* field(int i, int f) const
+  {
+    const auto& t = tables_[i];
+    return values_.data() + static_cast<size_t>(t.start) * n_fields_ +
+           f * t.n;
+  }
+
+  const double* e_out(int i) const { return field(i, E_OUT); }
+  const double* p(int i) const { return field(i, PDF); }
+  const double* c(int i) const { return field(i, CDF); }
+
+private:
+  //! Layout of a single table
+  struct Table {
+    int start;                   //!< Index of the first outgoing energy
+    int n;                       //!< Number of outgoing energies
+    int n_discrete;              //!< Number of discrete lines
+    Interpolation interpolation; //!< Interpolation law
+    int guide;                   //!< Index of the first guide table entry
+    int n_guide;                 //!< Number of guide table entries
+  };
+
+  int n_fields_ {0};               //!< Number of fields of each table
+  vector<Table> tables_;           //!< Layout of each table
+  NodeSharedArray<double> values_; //!< Fields of all tables
+  NodeSharedArray<int> guide_;     //!< Guide tables of all tables
+};
+
+} // namespace openmc
+
+#endif // OPENMC_OUTGOING_ENERGY_H
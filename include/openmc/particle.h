@@ -69,6 +69,13 @@ public:
   void event_revive_from_secondary();
   void event_death();
 
+  //! Execute the calculate XS event up to the continuous-energy cross section
+  //! lookup in the particle's material
+  //
+  //! \return Whether the cross sections of the particle's material need to be
+  //!   calculated
+  bool event_calculate_xs_prepare();
+
   //! pulse-height recording
   void pht_collision_energy();
   void pht_secondary_particles();
@@ -115,8 +122,11 @@ public:
   //! \param[in] i_sab Index in data::thermal_scatt
   //! \param[in] sab_frac  S(a,b) table fraction
   //! \param[in] ncrystal_xs Thermal scattering xs from NCrystal
+  //! \param[in] i_union Nuclide grid indices (one per temperature) resolved on
+  //!   a material unionized grid, or nullptr
   void update_neutron_xs(int i_nuclide, int i_grid = C_NONE, int i_sab = C_NONE,
-    double sab_frac = 0.0, double ncrystal_xs = -1.0);
+    double sab_frac = 0.0, double ncrystal_xs = -1.0,
+    const int* i_union = nullptr);
 };
 
 //============================================================================
@@ -1,8 +1,12 @@
 #ifndef OPENMC_PARTICLE_DATA_H
 #define OPENMC_PARTICLE_DATA_H
 
+#include <stdexcept> // for out_of_range
+#include <string>    // for to_string
+
 #include "openmc/array.h"
 #include "openmc/constants.h"
+#include "openmc/mesh_traversal.h"
 #include "openmc/position.h"
 #include "openmc/random_lcg.h"
 #include "openmc/tallies/filter_match.h"
@@ -27,6 +31,10 @@ constexpr int MAX_DELAYED_GROUPS {8};
 
 constexpr double CACHE_INVALID {-1.0};
 
+// Number of microscopic cross section cache entries for nuclides outside of the
+// material a particle is in, e.g., for tallies that do not multiply by density
+constexpr int NEUTRON_XS_EXTRA_SLOTS {4};
+
 //==========================================================================
 // Aliases and type definitions
 
@@ -130,6 +138,7 @@ struct NuclideMicroXS {
   double last_E {0.0};      //!< Last evaluated energy
   double last_sqrtkT {0.0}; //!< Last temperature in sqrt(Boltzmann constant
                             //!< * temperature (eV))
+  int index_nuclide {-1};   //!< Nuclide the cross sections belong to
 };
 
 //==============================================================================
@@ -388,6 +397,9 @@ private:
   // Data members -- see public: below for descriptions
 
   vector<NuclideMicroXS> neutron_xs_;
+  int neutron_xs_material_ {-1};
+  const int* neutron_xs_index_ {nullptr};
+  int neutron_xs_next_extra_ {0};
   vector<ElementMicroXS> photon_xs_;
   MacroXS macro_xs_;
   CacheDataMG mg_xs_cache_;
@@ -433,6 +445,8 @@ private:
 
   vector<FilterMatch> filter_matches_;
 
+  mutable MeshTraversalCache mesh_traversals_;
+
   vector<TrackStateHistory> tracks_;
 
   vector<NuBank> nu_bank_;
@@ -464,11 +478,59 @@ public:
   // Methods and accessors
 
   // Cross section caches
+
+  //! Microscopic neutron cross sections of a nuclide
+  //
+  //! Only the nuclides of the material set by set_neutron_xs_material() and a
+  //! few others have entries, so that the cache does not grow with the number
+  //! of nuclides in the problem. Entries for other nuclides are reused in turn.
+  //! An entry taken over from another nuclide is marked as needing to be
+  //! recalculated.
+  //! \param[in] i Index of the nuclide in data::nuclides
   NuclideMicroXS& neutron_xs(int i)
   {
-    return neutron_xs_[i];
-  } // Microscopic neutron cross sections
-  const NuclideMicroXS& neutron_xs(int i) const { return neutron_xs_[i]; }
+    int slot = this->neutron_xs_slot(i);
+    if (slot < 0) {
+      slot = neutron_xs_next_extra_;
+      neutron_xs_next_extra_ =
+        (neutron_xs_next_extra_ + 1) % NEUTRON_XS_EXTRA_SLOTS;
+    }
+    auto& micro = neutron_xs_[slot];
+    if (micro.index_nuclide != i) {
+      micro.index_nuclide = i;
+      micro.last_E = 0.0;
+    }
+    return micro;
+  }
+
+  //! Microscopic neutron cross sections of a nuclide that were calculated
+  //
+  //! \param[in] i Index of the nuclide in data::nuclides
+  //! \throw std::out_of_range if the cache has no entry for the nuclide
+  const NuclideMicroXS& neutron_xs(int i) const
+  {
+    int slot = this->neutron_xs_slot(i);
+    if (slot < 0 || neutron_xs_[slot].index_nuclide != i)
+      throw std::out_of_range {"No cross sections cached for nuclide " +
+                               std::to_string(i) + " on this particle."};
+    return neutron_xs_[slot];
+  }
+
+  //! Lay out the microscopic neutron cross section cache for a material
+  //
+  //! \param[in] i_material Index of the material in model::materials
+  //! \param[in] n_nuclides Number of nuclides in the material
+  //! \param[in] index Position of each nuclide in the material, or C_NONE if
+  //!   it is not present. May be nullptr if the mapping is not available.
+  void set_neutron_xs_material(int i_material, int n_nuclides, const int* index)
+  {
+    // The size is checked even if the material is unchanged since nuclides
+    // may have been added to it without moving its index array
+    neutron_xs_material_ = i_material;
+    neutron_xs_index_ = index;
+    if (index && neutron_xs_.size() < NEUTRON_XS_EXTRA_SLOTS + n_nuclides)
+      neutron_xs_.resize(NEUTRON_XS_EXTRA_SLOTS + n_nuclides);
+  }
 
   // Microscopic photon cross sections
   ElementMicroXS& photon_xs(int i) { return photon_xs_[i]; }
@@ -574,6 +636,11 @@ public:
   decltype(filter_matches_)& filter_matches() { return filter_matches_; }
   FilterMatch& filter_matches(int i) { return filter_matches_[i]; }
 
+  // Mesh traversals shared by mesh filters and weight windows. The cache can
+  // be used through a const particle since it does not change the results of
+  // any lookup.
+  MeshTraversalCache& mesh_traversals() const { return mesh_traversals_; }
+
   // Tracks to output to file
   decltype(tracks_)& tracks() { return tracks_; }
 
@@ -619,6 +686,8 @@ public:
   {
     for (auto& micro : neutron_xs_)
       micro.last_E = 0.0;
+    neutron_xs_material_ = C_NONE;
+    neutron_xs_index_ = nullptr;
   }
 
   //! Get track information based on particle's current state
@@ -637,6 +706,22 @@ public:
       d = 0;
     }
   }
+
+private:
+  //! Position of a nuclide in the microscopic neutron cross section cache
+  //
+  //! \param[in] i Index of the nuclide in data::nuclides
+  //! \return Position of the entry, or C_NONE if there is none
+  int neutron_xs_slot(int i) const
+  {
+    if (neutron_xs_index_ && neutron_xs_index_[i] != C_NONE)
+      return NEUTRON_XS_EXTRA_SLOTS + neutron_xs_index_[i];
+    for (int slot = 0; slot < NEUTRON_XS_EXTRA_SLOTS; ++slot) {
+      if (neutron_xs_[slot].index_nuclide == i)
+        return slot;
+    }
+    return C_NONE;
+  }
 };
 
 } // namespace openmc
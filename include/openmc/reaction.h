@@ -9,9 +9,11 @@
 #include "hdf5.h"
 #include <gsl/gsl-lite.hpp>
 
+#include "openmc/node_shared.h"
 #include "openmc/particle_data.h"
 #include "openmc/reaction_product.h"
 #include "openmc/vector.h"
+#include "openmc/xs_cache.h"
 
 namespace openmc {
 
@@ -28,6 +30,10 @@ public:
   //! \param[in] temperatures Desired temperatures for cross sections
   explicit Reaction(hid_t group, const vector<int>& temperatures);
 
+  //! Construct reaction from the cross section cache
+  //! \param[in] cache Reader of the cross section cache
+  explicit Reaction(CacheReader& cache);
+
   //! Calculate cross section given temperautre/grid index, interpolation factor
   //
   //! \param[in] i_temp Temperature index
@@ -48,12 +54,16 @@ public:
   //! \param[in] grid Nuclide energy grid
   //! \return Reaction rate
   double collapse_rate(gsl::index i_temp, gsl::span<const double> energy,
-    gsl::span<const double> flux, const vector<double>& grid) const;
+    gsl::span<const double> flux, gsl::span<const double> grid) const;
+
+  //! Write the reaction to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
 
   //! Cross section at a single temperature
   struct TemperatureXS {
     int threshold;
-    vector<double> value;
+    NodeSharedArray<double> value;
   };
 
   int mt_;                           //!< ENDF MT value
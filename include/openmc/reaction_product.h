@@ -11,6 +11,7 @@
 #include "openmc/memory.h" // for unique_ptr
 #include "openmc/particle.h"
 #include "openmc/vector.h" // for vector
+#include "openmc/xs_cache.h"
 
 namespace openmc {
 
@@ -37,6 +38,10 @@ public:
   //! \param[in] group HDF5 group containing data
   explicit ReactionProduct(hid_t group);
 
+  //! Construct reaction product from the cross section cache
+  //! \param[in] cache Reader of the cross section cache
+  explicit ReactionProduct(CacheReader& cache);
+
   //! Sample an outgoing angle and energy
   //! \param[in] E_in Incoming energy in [eV]
   //! \param[out] E_out Outgoing energy in [eV]
@@ -44,6 +49,14 @@ public:
   //! \param[inout] seed Pseudorandom seed pointer
   void sample(double E_in, double& E_out, double& mu, uint64_t* seed) const;
 
+  //! Write the reaction product to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
+  //! Move the secondary distributions into memory shared by all processes on
+  //! the node. This is collective over the processes on a node.
+  void share_data();
+
   ParticleType particle_;      //!< Particle type
   EmissionMode emission_mode_; //!< Emission mode
   double decay_rate_; //!< Decay rate (for delayed neutron precursors) in [1/s]
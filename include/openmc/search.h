@@ -5,6 +5,7 @@
 #define OPENMC_SEARCH_H
 
 #include <algorithm> // for lower_bound, upper_bound
+#include <cstddef>   // for ptrdiff_t
 
 namespace openmc {
 
@@ -19,6 +20,29 @@ typename std::iterator_traits<It>::difference_type lower_bound_index(
   return std::lower_bound(first, last, value) - first - 1;
 }
 
+//! Perform binary search without data-dependent branches
+//
+//! Returns the same index as lower_bound_index but replaces the branch at
+//! each bisection step with a conditional move, which avoids branch
+//! mispredictions when searching for many unrelated values in a row. The
+//! range must not be empty. As with lower_bound_index, a value equal to the
+//! first element gives 0 rather than -1, which is what the final term
+//! accounts for, and a value below the first element gives -1.
+
+template<class T>
+std::ptrdiff_t lower_bound_index_branchless(
+  const T* first, const T* last, const T& value)
+{
+  const T* base = first;
+  std::ptrdiff_t n = last - first;
+  while (n > 1) {
+    std::ptrdiff_t half = n / 2;
+    base = (base[half] < value) ? base + half : base;
+    n -= half;
+  }
+  return (base - first) + (*base < value) - (*first != value);
+}
+
 template<class It, class T>
 typename std::iterator_traits<It>::difference_type upper_bound_index(
   It first, It last, const T& value)
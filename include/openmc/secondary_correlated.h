@@ -10,7 +10,9 @@
 #include "openmc/angle_energy.h"
 #include "openmc/distribution.h"
 #include "openmc/endf.h"
+#include "openmc/outgoing_energy.h"
 #include "openmc/vector.h"
+#include "openmc/xs_cache.h"
 
 namespace openmc {
 
@@ -21,17 +23,8 @@ namespace openmc {
 
 class CorrelatedAngleEnergy : public AngleEnergy {
 public:
-  //! Outgoing energy/angle at a single incoming energy
-  struct CorrTable {
-    int n_discrete;                    //!< Number of discrete lines
-    Interpolation interpolation;       //!< Interpolation law
-    xt::xtensor<double, 1> e_out;      //!< Outgoing energies [eV]
-    xt::xtensor<double, 1> p;          //!< Probability density
-    xt::xtensor<double, 1> c;          //!< Cumulative distribution
-    vector<unique_ptr<Tabular>> angle; //!< Angle distribution
-  };
-
   explicit CorrelatedAngleEnergy(hid_t group);
+  explicit CorrelatedAngleEnergy(CacheReader& cache);
 
   //! Sample distribution for an angle and energy
   //! \param[in] E_in Incoming energy in [eV]
@@ -41,21 +34,37 @@ public:
   void sample(
     double E_in, double& E_out, double& mu, uint64_t* seed) const override;
 
+  //! Write the distribution to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
+  void share_data() override;
+
   // energy property
   vector<double>& energy() { return energy_; }
   const vector<double>& energy() const { return energy_; }
 
   // distribution property
-  vector<CorrTable>& distribution() { return distribution_; }
-  const vector<CorrTable>& distribution() const { return distribution_; }
+  const OutgoingEnergyTables& distribution() const { return distribution_; }
+
+  //! Angle distribution at an outgoing energy
+  //! \param[in] i Index of the incoming energy
+  //! \param[in] k Index of the outgoing energy
+  //! \return Angle distribution
+  const Tabular& angle(int i, int k) const
+  {
+    return angle_[distribution_.start(i) + k];
+  }
 
 private:
   int n_region_;                        //!< Number of interpolation regions
   vector<int> breakpoints_;             //!< Breakpoints between regions
   vector<Interpolation> interpolation_; //!< Interpolation laws
-  vector<double> energy_;          //!< Energies [eV] at which distributions
-                                   //!< are tabulated
-  vector<CorrTable> distribution_; //!< Distribution at each energy
+  vector<double> energy_;             //!< Energies [eV] at which distributions
+                                      //!< are tabulated
+  OutgoingEnergyTables distribution_; //!< Distribution at each energy
+  vector<Tabular> angle_; //!< Angle distribution at each outgoing energy of
+                          //!< each incoming energy
 };
 
 } // namespace openmc
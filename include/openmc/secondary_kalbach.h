@@ -10,7 +10,9 @@
 #include "openmc/angle_energy.h"
 #include "openmc/constants.h"
 #include "openmc/endf.h"
+#include "openmc/outgoing_energy.h"
 #include "openmc/vector.h"
+#include "openmc/xs_cache.h"
 
 namespace openmc {
 
@@ -23,6 +25,7 @@ namespace openmc {
 class KalbachMann : public AngleEnergy {
 public:
   explicit KalbachMann(hid_t group);
+  explicit KalbachMann(CacheReader& cache);
 
   //! Sample distribution for an angle and energy
   //! \param[in] E_in Incoming energy in [eV]
@@ -32,24 +35,27 @@ public:
   void sample(
     double E_in, double& E_out, double& mu, uint64_t* seed) const override;
 
+  //! Write the distribution to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
+  void share_data() override;
+
 private:
-  //! Outgoing energy/angle at a single incoming energy
-  struct KMTable {
-    int n_discrete;               //!< Number of discrete lines
-    Interpolation interpolation;  //!< Interpolation law
-    xt::xtensor<double, 1> e_out; //!< Outgoing energies [eV]
-    xt::xtensor<double, 1> p;     //!< Probability density
-    xt::xtensor<double, 1> c;     //!< Cumulative distribution
-    xt::xtensor<double, 1> r;     //!< Pre-compound fraction
-    xt::xtensor<double, 1> a;     //!< Parameterized function
+  //! Fields of the outgoing energy tables in addition to the outgoing energy,
+  //! PDF, and CDF
+  enum Field {
+    R = OutgoingEnergyTables::CDF + 1, //!< Pre-compound fraction
+    A,                                 //!< Parameterized function
+    N_FIELDS
   };
 
   int n_region_;                        //!< Number of interpolation regions
   vector<int> breakpoints_;             //!< Breakpoints between regions
   vector<Interpolation> interpolation_; //!< Interpolation laws
-  vector<double> energy_;        //!< Energies [eV] at which distributions
-                                 //!< are tabulated
-  vector<KMTable> distribution_; //!< Distribution at each energy
+  vector<double> energy_;             //!< Energies [eV] at which distributions
+                                      //!< are tabulated
+  OutgoingEnergyTables distribution_; //!< Distribution at each energy
 };
 
 } // namespace openmc
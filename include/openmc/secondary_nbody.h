@@ -7,6 +7,7 @@
 #include "hdf5.h"
 
 #include "openmc/angle_energy.h"
+#include "openmc/xs_cache.h"
 
 namespace openmc {
 
@@ -19,6 +20,7 @@ namespace openmc {
 class NBodyPhaseSpace : public AngleEnergy {
 public:
   explicit NBodyPhaseSpace(hid_t group);
+  explicit NBodyPhaseSpace(CacheReader& cache);
 
   //! Sample distribution for an angle and energy
   //! \param[in] E_in Incoming energy in [eV]
@@ -28,6 +30,10 @@ public:
   void sample(
     double E_in, double& E_out, double& mu, uint64_t* seed) const override;
 
+  //! Write the distribution to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
 private:
   int n_bodies_;      //!< Number of particles distributed
   double mass_ratio_; //!< Total mass of particles [neutron mass]
@@ -11,6 +11,7 @@
 #include "openmc/distribution_energy.h"
 #include "openmc/memory.h"
 #include "openmc/vector.h"
+#include "openmc/xs_cache.h"
 
 namespace openmc {
 
@@ -23,6 +24,7 @@ namespace openmc {
 class UncorrelatedAngleEnergy : public AngleEnergy {
 public:
   explicit UncorrelatedAngleEnergy(hid_t group);
+  explicit UncorrelatedAngleEnergy(CacheReader& cache);
 
   //! Sample distribution for an angle and energy
   //! \param[in] E_in Incoming energy in [eV]
@@ -32,6 +34,12 @@ public:
   void sample(
     double E_in, double& E_out, double& mu, uint64_t* seed) const override;
 
+  //! Write the distribution to the cross section cache
+  //! \param[in] cache Writer of the cross section cache
+  void serialize(CacheWriter& cache) const;
+
+  void share_data() override;
+
   // Accessors
   AngleDistribution& angle() { return angle_; }
 
@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "pugixml.hpp"
@@ -24,7 +25,9 @@ namespace settings {
 
 // Boolean flags
 extern bool assume_separate;      //!< assume tallies are spatially separate?
+extern bool banked_xs_lookup;     //!< use banked XS lookups in event mode?
 extern bool check_overlaps;       //!< check overlaps in geometry?
+extern bool compact_source_sites; //!< send sites in single precision?
 extern bool confidence_intervals; //!< use confidence intervals for results?
 extern bool
   create_fission_neutrons; //!< create fission neutrons (fixed source)?
@@ -41,6 +44,7 @@ extern "C" bool output_summary;    //!< write summary.h5?
 extern bool output_tallies;        //!< write tallies.out?
 extern bool particle_restart_run;  //!< particle restart run?
 extern "C" bool photon_transport;  //!< photon transport turned on?
+extern bool private_tally_buffers; //!< use thread-private tally buffers?
 extern "C" bool reduce_tallies;    //!< reduce tallies at end of batch?
 extern bool res_scat_on;           //!< use resonance upscattering method?
 extern "C" bool restart_run;       //!< restart run?
@@ -48,7 +52,10 @@ extern "C" bool run_CE;            //!< run with continuous-energy data?
 extern bool source_latest;         //!< write latest source at each batch?
 extern bool source_separate;       //!< write source to separate file?
 extern bool source_write;          //!< write source in HDF5 files?
+extern bool shared_nuclear_data;   //!< share nuclear data on each node?
+extern bool sort_xs_queues;        //!< sort event-based XS lookup queues?
 extern bool source_mcpl_write;     //!< write source in mcpl files?
+extern bool statepoint_async;      //!< write state points in the background?
 extern bool surf_source_write;     //!< write surface source file?
 extern bool surf_mcpl_write;       //!< write surface mcpl file?
 extern bool surf_source_read;      //!< read surface source file?
@@ -73,6 +80,7 @@ extern std::string path_output; //!< directory where output files are written
 extern std::string path_particle_restart; //!< path to a particle restart file
 extern std::string path_sourcepoint;      //!< path to a source file
 extern std::string path_statepoint;       //!< path to a statepoint file
+extern std::string path_xs_cache;         //!< directory of cross section cache
 extern std::string weight_windows_file;   //!< Location of weight window file to
                                           //!< load on simulation initialization
 
@@ -99,6 +107,8 @@ extern ElectronTreatment
   electron_treatment; //!< how to treat secondary electrons
 extern array<double, 4>
   energy_cutoff; //!< Energy cutoff in [eV] for each particle type
+extern EnergyGridMethod
+  energy_grid_method; //!< method for accelerating energy grid searches
 extern array<double, 4>
   time_cutoff; //!< Time cutoff in [s] for each particle type
 extern int
@@ -108,6 +118,13 @@ extern int n_log_bins;        //!< number of bins for logarithmic energy grid
 extern int n_batches;         //!< number of (inactive+active) batches
 extern int n_max_batches;     //!< Maximum number of batches
 extern int max_tracks; //!< Maximum number of particle tracks written to file
+extern int track_compression; //!< gzip level for particle track datasets
+extern int64_t
+  neighbor_list_rays; //!< Rays traced to populate neighbor lists up front
+extern PartitionerType
+  partitioner_type; //!< Default method for partitioning universes
+extern std::unordered_map<int32_t, PartitionerType>
+  universe_partitioners; //!< Partitioning methods by universe ID
 extern ResScatMethod res_scat_method; //!< resonance upscattering method
 extern double res_scat_energy_min; //!< Min energy in [eV] for res. upscattering
 extern double res_scat_energy_max; //!< Max energy in [eV] for res. upscattering
@@ -140,6 +157,8 @@ extern int trigger_batch_interval; //!< Batch interval for triggers
 extern "C" int verbosity;          //!< How verbose to make output
 extern double weight_cutoff;       //!< Weight cutoff for Russian roulette
 extern double weight_survive;      //!< Survival weight after Russian roulette
+extern double
+  tally_buffer_memory; //!< Memory limit in [MB] for private tally buffers
 
 } // namespace settings
 
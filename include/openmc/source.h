@@ -197,7 +197,9 @@ private:
 typedef unique_ptr<Source> create_compiled_source_t(std::string parameters);
 
 //==============================================================================
-//! Mesh-based source with different distributions for each element
+//! Mesh-based source with different distributions for each element. Elements
+//! whose sources differ only in their strength, or by a constant factor in the
+//! probabilities of their distributions, share a single source object.
 //==============================================================================
 
 class MeshSource : public Source {
@@ -216,7 +218,7 @@ public:
   // Accessors
   const std::unique_ptr<Source>& source(int32_t i) const
   {
-    return sources_.size() == 1 ? sources_[0] : sources_[i];
+    return sources_.size() == 1 ? sources_[0] : sources_[source_index_[i]];
   }
 
 protected:
@@ -225,7 +227,8 @@ protected:
 private:
   // Data members
   unique_ptr<MeshSpatial> space_;           //!< Mesh spatial
-  vector<std::unique_ptr<Source>> sources_; //!< Source distributions
+  vector<std::unique_ptr<Source>> sources_; //!< Distinct source distributions
+  vector<int32_t> source_index_; //!< Index in sources_ for each element
 };
 
 //==============================================================================
@@ -14,8 +14,24 @@
 
 namespace openmc {
 
+class Tally;
+
 void load_state_point();
 
+//! Write a state point file
+//
+//! \param[in] filename  Name of the file, or nullptr to use the default name
+//!   for the current batch
+//! \param[in] write_source  Whether to include the source bank
+//! \param[in] background  Whether to assemble the file in memory and write it
+//!   to disk on a background thread while the simulation continues
+void write_state_point(
+  const char* filename, bool write_source, bool background);
+
+//! Wait until state point and source point files being written in the
+//! background are on disk
+void flush_state_points();
+
 // By passing in a filename, source bank, and list of source indices
 // on each MPI rank, this writes an HDF5 file which contains that
 // information which can later be read in by read_source_bank
@@ -33,8 +49,11 @@ void load_state_point();
 // values on each rank, used to create global indexing. This vector
 // can be created by calling calculate_parallel_index_vector on
 // source_bank.size() if such a vector is not already available.
+//
+// If background is true, the file is assembled in memory and written to disk
+// by a background thread. This is not supported with parallel HDF5.
 void write_source_point(const char* filename, gsl::span<SourceSite> source_bank,
-  const vector<int64_t>& bank_index);
+  const vector<int64_t>& bank_index, bool background = false);
 
 // This appends a source bank specification to an HDF5 file
 // that's already open. It is used internally by write_source_point.
@@ -44,6 +63,21 @@ void write_source_bank(hid_t group_id, gsl::span<SourceSite> source_bank,
 void read_source_bank(
   hid_t group_id, vector<SourceSite>& sites, bool distribute);
 void write_tally_results_nr(hid_t file_id);
+
+//! Write the results of a decomposed tally. Each process writes its own
+//! block of filter bins, or sends it to the master process one at a time
+//! without parallel HDF5.
+//
+//! \param[in] group_id  Group of the tally; only used on processes that have
+//!   the file open
+//! \param[in] tally  Tally whose results are written
+void write_tally_results_decomposed(hid_t group_id, const Tally& tally);
+
+//! Read this process's block of filter bins of a decomposed tally
+//
+//! \param[in] group_id  Group of the tally
+//! \param[in] tally  Tally whose results are read
+void read_tally_results_decomposed(hid_t group_id, Tally& tally);
 void restart_set_keff();
 void write_unstructured_mesh_results();
 
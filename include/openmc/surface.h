@@ -1,6 +1,7 @@
 #ifndef OPENMC_SURFACE_H
 #define OPENMC_SURFACE_H
 
+#include <cstdint>
 #include <limits> // For numeric_limits
 #include <string>
 #include <unordered_map>
@@ -420,6 +421,73 @@ public:
   double x0_, y0_, z0_, A_, B_, C_;
 };
 
+//==============================================================================
+//! Per-thread cache of the senses of surfaces at a single location.
+//
+//! Searching for the cell containing a particle tests the cells of a universe
+//! one after another, and neighboring cells share most of their surfaces. The
+//! cache remembers each sense computed for the current coordinates so that it
+//! is only evaluated once per search. Moving to new coordinates invalidates all
+//! entries at once by advancing a stamp.
+//==============================================================================
+
+class SurfaceSenseCache {
+public:
+  //! Get the cache belonging to the calling thread
+  static SurfaceSenseCache& thread_cache()
+  {
+    static thread_local SurfaceSenseCache cache;
+    return cache;
+  }
+
+  //! Invalidate the caches of all threads, e.g., when surfaces are replaced
+  static void invalidate() { ++generation_; }
+
+  //! Prepare the cache for evaluating senses at the given coordinates
+  //
+  //! \param[in] r Coordinates
+  //! \param[in] u Direction used to break ties on surfaces
+  void set_position(Position r, Direction u)
+  {
+    bool current = (generation_ == cache_generation_ &&
+                    stamps_.size() == model::surfaces.size());
+    if (current && r == r_ && u == u_)
+      return;
+    if (!current)
+      this->resize();
+    r_ = r;
+    u_ = u;
+    if (++stamp_ == 0)
+      this->resize();
+  }
+
+  //! Get the sense of a surface at the coordinates set by set_position
+  //
+  //! \param[in] i_surf Index of the surface in model::surfaces
+  //! \return Whether the coordinates are on the positive side of the surface
+  bool sense(int32_t i_surf)
+  {
+    if (stamps_[i_surf] != stamp_) {
+      senses_[i_surf] = model::surfaces[i_surf]->sense(r_, u_);
+      stamps_[i_surf] = stamp_;
+    }
+    return senses_[i_surf];
+  }
+
+private:
+  //! Discard all entries and match the current surfaces
+  void resize();
+
+  static int generation_; //!< Incremented whenever surfaces change
+
+  Position r_ {INFTY, INFTY, INFTY}; //!< Coordinates of the cached senses
+  Direction u_ {0.0, 0.0, 0.0};     //!< Direction of the cached senses
+  int cache_generation_ {-1};        //!< Value of generation_ for the entries
+  uint32_t stamp_ {1};               //!< Stamp of entries that are current
+  vector<uint32_t> stamps_;          //!< Stamp of each entry
+  vector<char> senses_;              //!< Sense of each surface
+};
+
 //==============================================================================
 // Non-member functions
 //==============================================================================
@@ -1,17 +1,156 @@
 #ifndef OPENMC_TALLIES_FILTERMATCH_H
 #define OPENMC_TALLIES_FILTERMATCH_H
 
+#include <algorithm> // for copy, max
+#include <cstddef>   // for size_t
+
+#include "openmc/vector.h"
+
 namespace openmc {
 
+//==============================================================================
+//! Per-thread bump allocator for the bins and weights of filter matches.
+//
+//! Storage is handed out from chunks that are kept for the lifetime of the
+//! thread, so releasing everything allocated during a tally event only
+//! requires rewinding to the start of the first chunk.
+//==============================================================================
+
+template<typename T>
+class FilterMatchArena {
+public:
+  //! Number of elements in each newly allocated chunk
+  static constexpr size_t CHUNK_SIZE {4096};
+
+  //! Get the arena belonging to the calling thread
+  static FilterMatchArena& thread_arena()
+  {
+    static thread_local FilterMatchArena arena;
+    return arena;
+  }
+
+  //! Grow an allocation, extending it in place if it is the most recent one
+  //
+  //! \param[in] data Start of the current allocation (may be nullptr)
+  //! \param[in] size Number of elements in use
+  //! \param[in] capacity Number of elements in the current allocation
+  //! \param[in] new_capacity Number of elements needed
+  //! \return Start of an allocation holding the first size elements of data
+  T* grow(T* data, size_t size, size_t capacity, size_t new_capacity)
+  {
+    if (data && i_chunk_ < chunks_.size()) {
+      auto& chunk {chunks_[i_chunk_]};
+      if (data + capacity == chunk.data() + offset_ &&
+          offset_ - capacity + new_capacity <= chunk.size()) {
+        offset_ += new_capacity - capacity;
+        return data;
+      }
+    }
+
+    // Move on to the first chunk with enough room, allocating one if needed
+    while (i_chunk_ < chunks_.size() &&
+           offset_ + new_capacity > chunks_[i_chunk_].size()) {
+      ++i_chunk_;
+      offset_ = 0;
+    }
+    if (i_chunk_ == chunks_.size()) {
+      chunks_.emplace_back(std::max(CHUNK_SIZE, new_capacity));
+    }
+
+    T* new_data = chunks_[i_chunk_].data() + offset_;
+    offset_ += new_capacity;
+    std::copy(data, data + size, new_data);
+    return new_data;
+  }
+
+  //! Release all allocations
+  void reset()
+  {
+    i_chunk_ = 0;
+    offset_ = 0;
+  }
+
+private:
+  vector<vector<T>> chunks_; //!< Storage, never freed until the thread exits
+  size_t i_chunk_ {0};       //!< Index of the chunk being allocated from
+  size_t offset_ {0};        //!< First unused element in the current chunk
+};
+
+template<typename T>
+constexpr size_t FilterMatchArena<T>::CHUNK_SIZE;
+
+//==============================================================================
+//! Growable array whose storage lives in the calling thread's
+//! FilterMatchArena. Contents are only valid until the arena is reset.
+//==============================================================================
+
+template<typename T>
+class FilterMatchVector {
+public:
+  void push_back(T value)
+  {
+    if (size_ == capacity_) {
+      size_t n = (capacity_ == 0) ? 16 : 2 * capacity_;
+      data_ = FilterMatchArena<T>::thread_arena().grow(
+        data_, size_, capacity_, n);
+      capacity_ = n;
+    }
+    data_[size_++] = value;
+  }
+
+  //! Remove all elements. The storage is reclaimed when the arena is reset.
+  void clear()
+  {
+    data_ = nullptr;
+    size_ = 0;
+    capacity_ = 0;
+  }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  T& operator[](size_t i) { return data_[i]; }
+  const T& operator[](size_t i) const { return data_[i]; }
+  T& back() { return data_[size_ - 1]; }
+
+  T* begin() { return data_; }
+  T* end() { return data_ + size_; }
+  const T* begin() const { return data_; }
+  const T* end() const { return data_ + size_; }
+
+private:
+  T* data_ {nullptr};
+  size_t size_ {0};
+  size_t capacity_ {0};
+};
+
+//! Release the bins and weights of all filter matches found on this thread
+inline void reset_filter_match_arena()
+{
+  FilterMatchArena<int>::thread_arena().reset();
+  FilterMatchArena<double>::thread_arena().reset();
+}
+
 //==============================================================================
 //! Stores bins and weights for filtered tally events.
 //==============================================================================
 
 class FilterMatch {
 public:
-  vector<int> bins_;
-  vector<double> weights_;
+  //! Number of matching bins
+  int size() const { return all_bins_ ? n_all_bins_ : bins_.size(); }
+
+  //! Filter bin of the i-th match
+  int bin(int i) const { return all_bins_ ? i : bins_[i]; }
+
+  //! Weight of the i-th match
+  double weight(int i) const { return all_bins_ ? 1.0 : weights_[i]; }
+
+  FilterMatchVector<int> bins_;
+  FilterMatchVector<double> weights_;
   int i_bin_;
+  int n_all_bins_ {0};    //!< Number of bins when all bins match
+  bool all_bins_ {false}; //!< Whether every bin matches with unit weight
   bool bins_present_ {false};
 };
 
@@ -3,8 +3,11 @@
 
 #include "openmc/constants.h"
 #include "openmc/memory.h" // for unique_ptr
+#include "openmc/openmp_interface.h"
 #include "openmc/tallies/filter.h"
+#include "openmc/tallies/tally_buffer.h"
 #include "openmc/tallies/trigger.h"
+#include "openmc/timer.h"
 #include "openmc/vector.h"
 
 #include "pugixml.hpp"
@@ -106,6 +109,10 @@ public:
 
   bool writable() const { return writable_; }
 
+  //! First filter bin combination stored on each process followed by the
+  //! total number of combinations; only set up for decomposed tallies
+  const vector<int64_t>& bin_index() const { return bin_index_; }
+
   //----------------------------------------------------------------------------
   // Other methods.
 
@@ -119,6 +126,60 @@ public:
 
   void accumulate();
 
+  //! Add to a value of the tally for the current realization
+  //
+  //! The value goes to the calling thread's private buffer if there is one
+  //! and is otherwise added to the results atomically.
+  //
+  //! \param[in] filter_index Index of the filter bin combination
+  //! \param[in] score_index Index of the score
+  //! \param[in] value Value to add
+  void add_value(int filter_index, int score_index, double value)
+  {
+    if (decompose_) {
+      // Values of filter bins stored on other processes are sent to them at
+      // the end of the batch
+      int local_index = filter_index - first_bin_;
+      if (local_index < 0 ||
+          local_index >= static_cast<int>(results_.shape(0))) {
+        this->add_remote_value(
+          static_cast<int64_t>(filter_index) * results_.shape(1) + score_index,
+          value);
+        return;
+      }
+      filter_index = local_index;
+    }
+
+    int t = thread_num();
+    if (t < thread_buffers_.size()) {
+      auto& buffer {*thread_buffers_[t]};
+      int64_t i =
+        static_cast<int64_t>(filter_index) * results_.shape(1) + score_index;
+      if (!buffer.add(i, value)) {
+        this->flush_buffer(buffer);
+        buffer.add(i, value);
+      }
+      return;
+    }
+#pragma omp atomic
+    results_(filter_index, score_index, TallyResult::VALUE) += value;
+  }
+
+  //! Set up a private buffer for each thread to accumulate results in
+  //
+  //! \param[in] max_memory Memory available for the buffers in [bytes]
+  //! \return Memory used by the buffers in [bytes], zero if they did not fit
+  size_t init_thread_buffers(size_t max_memory);
+
+  //! Add the contents of the thread-private buffers to the results
+  void reduce_thread_buffers();
+
+#ifdef OPENMC_MPI
+  //! Send values scored to filter bins stored on other processes to them and
+  //! add the values received from other processes to the results
+  void exchange_remote_values();
+#endif
+
   //! return the index of a score specified by name
   int score_index(const std::string& score) const;
 
@@ -149,6 +210,9 @@ public:
   //! Number of realizations
   int n_realizations_ {0};
 
+  //! Time spent reducing results across processes
+  Timer time_reduce_;
+
   vector<int> scores_; //!< Filter integrands (e.g. flux, fission)
 
   //! Index of each nuclide to be tallied.  -1 indicates total material.
@@ -163,6 +227,10 @@ public:
   //! True if this tally should be written to statepoint files
   bool writable_ {true};
 
+  //! Whether the results are partitioned across processes by filter bin
+  //! combination. Each process only stores a contiguous block of results.
+  bool decompose_ {false};
+
   //----------------------------------------------------------------------------
   // Miscellaneous public members.
 
@@ -192,7 +260,46 @@ private:
   //! Whether to multiply by atom density for reaction rates
   bool multiply_density_ {true};
 
+  //! Thread-private buffers for accumulating results during a batch
+  vector<unique_ptr<TallyBuffer>> thread_buffers_;
+
+  //! Value scored to a filter bin stored on another process
+  struct RemoteValue {
+    int64_t index; //!< Filter index * number of scores + score index
+    double value;
+  };
+
+  vector<int64_t> bin_index_; //!< Filter bins stored on each process
+  int first_bin_ {0};         //!< First filter bin stored on this process
+
+  //! Thread-private values scored to filter bins of other processes, each
+  //! holding at most TALLY_REMOTE_BUFFER_SIZE values
+  vector<vector<RemoteValue>> remote_values_;
+
+  //! Values scored to filter bins of other processes by all threads, sorted by
+  //! index with one value per index
+  vector<RemoteValue> remote_merged_;
+  OpenMPMutex remote_mutex_; //!< Protects remote_merged_
+
   gsl::index index_;
+
+  //----------------------------------------------------------------------------
+  // Private methods.
+
+  //! Atomically add the contents of a thread-private buffer to the results
+  void flush_buffer(TallyBuffer& buffer);
+
+  //! Buffer a value scored to a filter bin stored on another process
+  void add_remote_value(int64_t index, double value);
+
+  //! Move the values of a thread-private buffer to remote_merged_
+  void flush_remote_values(vector<RemoteValue>& values);
+
+  //! Sort values by index and combine values with the same index
+  static void merge_remote_values(vector<RemoteValue>& values);
+
+  //! Combine adjacent values with the same index in values sorted by index
+  static void combine_remote_values(vector<RemoteValue>& values);
 };
 
 //==============================================================================
@@ -244,6 +351,13 @@ void accumulate_tallies();
 //! Determine which tallies should be active
 void setup_active_tallies();
 
+//! Set up thread-private accumulation buffers for as many tallies as fit
+//! within the memory limit, starting from the first tally
+void init_tally_buffers();
+
+//! Add the contents of all thread-private tally buffers to the tally results
+void reduce_tally_buffers();
+
 // Alias for the type returned by xt::adapt(...). N is the dimension of the
 // multidimensional array
 template<std::size_t N>
@@ -252,9 +366,17 @@ using adaptor_type =
 
 #ifdef OPENMC_MPI
 //! Collect all tally results onto master process
+//
+//! Processes on the same node first sum their results in shared memory. The
+//! sums of all nodes are then reduced onto the master process without
+//! blocking; the affected tallies are accumulated by finish_tally_reduction().
 void reduce_tally_results();
 #endif
 
+//! Wait for tally results that are being reduced across nodes and accumulate
+//! them. This must be called before tally results are used.
+void finish_tally_reduction();
+
 void free_memory_tally();
 
 } // namespace openmc
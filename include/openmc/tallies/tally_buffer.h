@@ -0,0 +1,119 @@
+#ifndef OPENMC_TALLIES_TALLY_BUFFER_H
+#define OPENMC_TALLIES_TALLY_BUFFER_H
+
+#include <cstddef> // for size_t
+#include <cstdint>
+
+#include "openmc/vector.h"
+
+namespace openmc {
+
+//==============================================================================
+//! Thread-private accumulation buffer for the values of a tally.
+//
+//! A dense buffer has an entry for every bin of the tally and is meant for
+//! small tallies. A sparse buffer is a fixed-size open-addressing hash table
+//! holding only the bins that have been scored to; once it is full, its
+//! contents have to be flushed to the tally before more bins can be added.
+//==============================================================================
+
+class TallyBuffer {
+public:
+  //----------------------------------------------------------------------------
+  // Constructors
+
+  //! Create a buffer
+  //
+  //! \param[in] n_values Number of values (filter bins times scores) in the
+  //!   tally
+  //! \param[in] dense Whether to store every value of the tally
+  TallyBuffer(int64_t n_values, bool dense);
+
+  //----------------------------------------------------------------------------
+  // Methods
+
+  //! Add to a value of the tally
+  //
+  //! \param[in] i Index of the value (filter index * number of scores + score
+  //!   index)
+  //! \param[in] value Value to add
+  //! \return Whether the value was added; false if a sparse buffer is full
+  bool add(int64_t i, double value)
+  {
+    if (dense_) {
+      values_[i] += value;
+      return true;
+    }
+
+    // Linear probing starting from a Fibonacci hash of the index
+    size_t slot =
+      (static_cast<uint64_t>(i) * 11400714819323198485ull) >> shift_;
+    while (keys_[slot] != i) {
+      if (keys_[slot] == EMPTY) {
+        if (used_.size() == max_used_)
+          return false;
+        keys_[slot] = i;
+        used_.push_back(slot);
+        break;
+      }
+      slot = (slot + 1) & (keys_.size() - 1);
+    }
+    values_[slot] += value;
+    return true;
+  }
+
+  //! Pass every value stored in the buffer to a function and clear the buffer
+  //
+  //! \param[in] f Function called as f(index, value)
+  template<typename F>
+  void flush(F f)
+  {
+    if (dense_) {
+      for (int64_t i = 0; i < values_.size(); ++i) {
+        if (values_[i] != 0.0) {
+          f(i, values_[i]);
+          values_[i] = 0.0;
+        }
+      }
+    } else {
+      for (auto slot : used_) {
+        f(keys_[slot], values_[slot]);
+        keys_[slot] = EMPTY;
+        values_[slot] = 0.0;
+      }
+      used_.clear();
+    }
+  }
+
+  //! Whether the buffer stores every value of the tally
+  bool dense() const { return dense_; }
+
+  //! Values of a dense buffer, indexed like the argument of add()
+  double* data() { return values_.data(); }
+
+  //! Memory used by the buffer in [bytes]
+  size_t memory() const;
+
+  //! Memory a buffer would use in [bytes]
+  //
+  //! \param[in] n_values Number of values in the tally
+  //! \param[in] dense Whether the buffer would be dense
+  static size_t memory(int64_t n_values, bool dense);
+
+private:
+  //----------------------------------------------------------------------------
+  // Data members
+
+  static constexpr int64_t EMPTY {-1}; //!< Key of an unused hash table slot
+
+  bool dense_;            //!< Whether every value is stored
+  vector<double> values_; //!< Values, by index (dense) or slot (sparse)
+  vector<int64_t> keys_;  //!< Value index stored in each slot
+  vector<size_t> used_;   //!< Slots in use, in order of first use
+  size_t max_used_ {0};   //!< Number of slots that may be used
+  int shift_ {0};         //!< Right shift mapping hashes onto slots
+};
+
+} // namespace openmc
+
+#endif // OPENMC_TALLIES_TALLY_BUFFER_H
@@ -2,6 +2,7 @@
 #define OPENMC_TIMER_H
 
 #include <chrono>
+#include <cstdint> // for int64_t
 
 namespace openmc {
 
@@ -27,12 +28,17 @@ extern Timer time_total;
 extern Timer time_transport;
 extern Timer time_event_init;
 extern Timer time_event_calculate_xs;
+extern Timer time_event_sort_xs;
+extern Timer time_event_lookup_xs;
 extern Timer time_event_advance_particle;
 extern Timer time_event_surface_crossing;
 extern Timer time_event_collision;
 extern Timer time_event_death;
 extern Timer time_update_src;
 
+extern int64_t bank_bytes_sent;   //!< Source site data sent to other processes
+extern int64_t bank_bytes_copied; //!< Source site data kept on this process
+
 } // namespace simulation
 
 //==============================================================================
@@ -3,8 +3,18 @@
 
 #include "openmc/particle.h"
 
+#include <mutex>
+
 namespace openmc {
 
+//==============================================================================
+// Global variables
+//==============================================================================
+
+//! Serializes HDF5 calls made by the track writer thread with other HDF5 I/O
+//! performed while particles are being transported
+extern std::mutex track_hdf5_mutex;
+
 //==============================================================================
 // Non-member functions
 //==============================================================================
@@ -31,11 +41,17 @@ void add_particle_track(Particle& p);
 //! \param[in] p  Current particle
 void write_particle_track(Particle& p);
 
-//! Write full particle state history to HDF5 track file
+//! Add full particle state history to the buffer of the calling thread
 //
+//! Buffers are written to the HDF5 track file by a background thread once
+//! they fill up or when flush_particle_tracks() is called.
+//!
 //! \param[in] p  Current particle
 void finalize_particle_track(Particle& p);
 
+//! Write all buffered particle tracks and wait until they are in the file
+void flush_particle_tracks();
+
 } // namespace openmc
 
 #endif // OPENMC_TRACK_OUTPUT_H
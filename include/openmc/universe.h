@@ -1,6 +1,7 @@
 #ifndef OPENMC_UNIVERSE_H
 #define OPENMC_UNIVERSE_H
 
+#include "openmc/array.h"
 #include "openmc/cell.h"
 
 namespace openmc {
@@ -47,19 +48,38 @@ private:
 };
 
 //==============================================================================
-//! Speeds up geometry searches by grouping cells in a search tree.
+//! Speeds up geometry searches by restricting them to candidate cells.
+//==============================================================================
+
+class UniversePartitioner {
+public:
+  virtual ~UniversePartitioner() = default;
+
+  //! Return the list of cells that could contain the given coordinates.
+  virtual const vector<int32_t>& get_cells(Position r, Direction u) const = 0;
+
+  //! Average number of candidate cells returned by get_cells
+  //
+  //! \return Number of candidates averaged over the regions of space that the
+  //!   partitioner distinguishes
+  virtual double average_candidates() const = 0;
+};
+
+//==============================================================================
+//! Partitions a universe with the z-planes that bound its cells.
 //
 //! Currently this object only works with universes that are divided up by a
 //! bunch of z-planes.  It could be generalized to other planes, cylinders,
 //! and spheres.
 //==============================================================================
 
-class UniversePartitioner {
+class ZPlanePartitioner : public UniversePartitioner {
 public:
-  explicit UniversePartitioner(const Universe& univ);
+  explicit ZPlanePartitioner(const Universe& univ);
 
-  //! Return the list of cells that could contain the given coordinates.
-  const vector<int32_t>& get_cells(Position r, Direction u) const;
+  const vector<int32_t>& get_cells(Position r, Direction u) const override;
+
+  double average_candidates() const override;
 
 private:
   //! A sorted vector of indices to surfaces that partition the universe
@@ -75,5 +95,53 @@ private:
   vector<vector<int32_t>> partitions_;
 };
 
+//==============================================================================
+//! Partitions a universe with an adaptive octree over cell bounding boxes.
+//
+//! The octree covers the finite extent of the cells' bounding boxes and is
+//! only split along axes on which that extent is finite. Each leaf lists the
+//! cells whose bounding boxes overlap it. Points outside the octree are
+//! clamped onto it, which only ever adds candidates.
+//==============================================================================
+
+class OctreePartitioner : public UniversePartitioner {
+public:
+  explicit OctreePartitioner(const Universe& univ);
+
+  const vector<int32_t>& get_cells(Position r, Direction u) const override;
+
+  double average_candidates() const override;
+
+  //! Number of leaves in the octree
+  int n_leaves() const { return leaves_.size(); }
+
+private:
+  struct Node {
+    BoundingBox box;      //!< Extent of the node
+    Position mid;         //!< Center of the node, where it is split
+    int first_child {-1}; //!< Index of the first child, -1 for a leaf
+    int leaf {-1};        //!< Index in leaves_ for a leaf
+  };
+
+  //! Subdivide a node until its candidate cells fit in a leaf
+  //
+  //! \param[in] i_node Index of the node in nodes_
+  //! \param[in] candidates Positions in cells of the cells overlapping the node
+  //! \param[in] depth Depth of the node
+  //! \param[in] cells Cells of the universe
+  //! \param[in] boxes Bounding box of each cell of the universe
+  void build(int i_node, const vector<int>& candidates, int depth,
+    const vector<int32_t>& cells, const vector<BoundingBox>& boxes);
+
+  //! Whether a cell's bounding box overlaps a node, including its boundary
+  bool overlaps(const BoundingBox& cell_box, const BoundingBox& node_box) const;
+
+  vector<Node> nodes_;             //!< Nodes, root first
+  vector<vector<int32_t>> leaves_; //!< Candidate cells in each leaf
+  array<bool, 3> split_ {};        //!< Whether the octree splits each axis
+  int n_children_ {1};             //!< Number of children of each node
+  double padding_ {0.0};           //!< Padding of overlap tests in [cm]
+};
+
 } // namespace openmc
 #endif // OPENMC_UNIVERSE_H
@@ -8,6 +8,7 @@
 #include "openmc/constants.h"
 #include "openmc/hdf5_interface.h"
 #include "openmc/vector.h"
+#include "openmc/xs_cache.h"
 
 namespace openmc {
 
@@ -49,6 +50,12 @@ public:
   //! \brief Load the URR data from the provided HDF5 group
   explicit UrrData(hid_t group_id);
 
+  //! \brief Load the URR data from the cross section cache
+  explicit UrrData(CacheReader& cache);
+
+  //! \brief Write the URR data to the cross section cache
+  void serialize(CacheWriter& cache) const;
+
   // Checks if any negative CDF or XS values are present
   bool has_negative() const;
 
@@ -31,6 +31,17 @@ constexpr int FIT_F {2}; // Fission
 // Multipole HDF5 file version
 constexpr array<int, 2> WMP_VERSION {1, 1};
 
+// Poles that are closer to the evaluation point than this radius, in units of
+// the Doppler width, use the full Faddeeva function. All other poles use a
+// truncated continued fraction with WMP_CF_TERMS terms. Outside the radius,
+// it agrees with the full function to within ~1e-14 relative error and with
+// its second derivative to within ~1e-13.
+constexpr double WMP_CF_RADIUS {7.0};
+constexpr int WMP_CF_TERMS {16};
+
+// Number of poles processed at once by the vectorized pole kernel
+constexpr int WMP_POLE_CHUNK {64};
+
 //========================================================================
 // Windowed multipole data
 //========================================================================
@@ -45,6 +56,7 @@ public:
   };
 
   // Constructors, destructors
+  WindowedMultipole() = default;
   WindowedMultipole(hid_t group);
 
   // Methods
@@ -58,6 +70,21 @@ public:
   //! sections in [b]
   std::tuple<double, double, double> evaluate(double E, double sqrtkT) const;
 
+  //! \brief Evaluate the windowed multipole equations for a batch of energies
+  //! and temperatures
+  //!
+  //! Results are identical to calling the single-point version for each
+  //! entry. Entries sorted by energy benefit from reusing the same windows.
+  //!
+  //! \param n Number of evaluation points
+  //! \param E Incident neutron energies in [eV], each within [E_min_, E_max_]
+  //! \param sqrtkT Square roots of temperature times Boltzmann constant
+  //! \param[out] sig_s Elastic scattering cross sections in [b]
+  //! \param[out] sig_a Absorption cross sections in [b]
+  //! \param[out] sig_f Fission cross sections in [b]
+  void evaluate(int n, const double* E, const double* sqrtkT, double* sig_s,
+    double* sig_a, double* sig_f) const;
+
   //! \brief Evaluates the windowed multipole equations for the derivative of
   //! cross sections in the resolved resonance regions with respect to
   //! temperature.
@@ -80,11 +107,38 @@ public:
   vector<WindowInfo> window_info_; // Information about a window
   xt::xtensor<double, 3>
     curvefit_; // Curve fit coefficients (window, poly order, reaction)
-  xt::xtensor<std::complex<double>, 2> data_; //!< Poles and residues
+  //! Real and imaginary parts of the poles and residues, stored contiguously
+  //! for each quantity. Row 2*MP_XX holds the real parts and row 2*MP_XX + 1
+  //! the imaginary parts. Fission residues are zero if not fissionable.
+  xt::xtensor<double, 2> poles_;
 
   // Constant data
   static constexpr int MAX_POLY_COEFFICIENTS =
     11; //!< Max order of polynomial fit plus one
+
+private:
+  //! Determine the window containing a given energy
+  //
+  //! \param sqrtE Square root of incident neutron energy in [eV]
+  //! \return Index of the window
+  int window_index(double sqrtE) const;
+
+  //! Sum the contributions of the poles in a window at temperature
+  //
+  //! Each pole contributes Re[r * sqrt(pi) * w^(n)(z)] for its residue r and
+  //! z = (sqrt(E) - pole) * dopp, where w^(n) is the Faddeeva function (n = 0)
+  //! or its second derivative (n = 2).
+  //
+  //! \tparam DERIV Whether to use the second derivative
+  //! \param window Window whose poles are summed
+  //! \param sqrtE Square root of incident neutron energy in [eV]
+  //! \param dopp sqrt(atomic weight ratio / kT) with kT given in eV
+  //! \param[out] sum_s Sum over the scattering residues
+  //! \param[out] sum_a Sum over the absorption residues
+  //! \param[out] sum_f Sum over the fission residues
+  template<bool DERIV>
+  void sum_poles(const WindowInfo& window, double sqrtE, double dopp,
+    double& sum_s, double& sum_a, double& sum_f) const;
 };
 
 //========================================================================
@@ -102,6 +156,33 @@ void check_wmp_version(hid_t file);
 //! \param[in] i_nuclide  Index in global nuclides array
 void read_multipole_data(int i_nuclide);
 
+//! Evaluate sqrt(pi) * w(z) or sqrt(pi) * w''(z) at points with |z| >=
+//! WMP_CF_RADIUS, where w is the integral form of the Faddeeva function
+//! returned by faddeeva()
+//
+//! The Laplace continued fraction w(z) = i/sqrt(pi) / (z - 1/2 / (z - 1 / (z -
+//! 3/2 / ...))) is truncated after WMP_CF_TERMS terms and evaluated as a
+//! ratio of two polynomials in z, so that the only division happens at the
+//! end. It converges to the integral form in both half planes. Each term is
+//! applied to all points before moving on to the next one, so that every loop
+//! is vectorized over the points.
+//!
+//! If the numerator and denominator of the fraction starting at term k are
+//! q_k and p_k, then sqrt(pi) * w(z) = i q_0 / p_0. Applying the recurrences
+//! w'(z) = -2z w(z) + 2i/sqrt(pi) and w''(z) = -2z w'(z) - 2w(z) to the
+//! truncated fraction gives sqrt(pi) * w''(z) = 2i q_2 / p_0 exactly, which
+//! avoids the cancellation of evaluating the recurrences numerically.
+//
+//! \tparam DERIV Whether to evaluate the second derivative
+//! \param n Number of points, at most WMP_POLE_CHUNK
+//! \param x Real parts of z
+//! \param y Imaginary parts of z
+//! \param[out] wr Real parts of the result
+//! \param[out] wi Imaginary parts of the result
+template<bool DERIV>
+void faddeeva_cf(
+  int n, const double* x, const double* y, double* wr, double* wi);
+
 //==============================================================================
 //! Doppler broadens the windowed multipole curvefit.
 //!
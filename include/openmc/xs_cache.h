@@ -0,0 +1,217 @@
+//! \file xs_cache.h
+//! \brief Binary cache of nuclear data read from HDF5 libraries
+
+#ifndef OPENMC_XS_CACHE_H
+#define OPENMC_XS_CACHE_H
+
+#include <cstddef>   // for size_t
+#include <stdexcept> // for runtime_error
+#include <string>
+#include <type_traits>
+#include <utility> // for move
+
+#include "hdf5.h"
+#include "xtensor/xtensor.hpp"
+#include <gsl/gsl-lite.hpp>
+
+#include "openmc/array.h"
+#include "openmc/node_shared.h"
+#include "openmc/vector.h"
+
+namespace openmc {
+
+//==============================================================================
+//! Types of polymorphic objects stored in the cross section cache
+//==============================================================================
+
+enum class CacheType {
+  none,
+  polynomial,
+  tabulated_1d,
+  sum_1d,
+  discrete_photon,
+  level_inelastic,
+  continuous_tabular,
+  evaporation,
+  maxwell_energy,
+  watt_energy,
+  uncorrelated,
+  correlated,
+  nbody,
+  kalbach_mann
+};
+
+//==============================================================================
+//! Buffer into which objects are serialized for the cross section cache.
+//! Values are stored in the native binary representation, so a cache can only
+//! be read on the kind of machine that wrote it.
+//==============================================================================
+
+class CacheWriter {
+public:
+  //! Append a value of a trivially copyable type
+  template<typename T>
+  void write(const T& value)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+      "Only trivially copyable values can be written directly");
+    write_bytes(&value, sizeof(T));
+  }
+
+  //! Append the size and elements of a vector
+  template<typename T>
+  void write(const vector<T>& values)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+      "Only vectors of trivially copyable values can be written directly");
+    write(values.size());
+    write_bytes(values.data(), values.size() * sizeof(T));
+  }
+
+  //! Append the shape and elements of a tensor
+  template<typename T, size_t N>
+  void write(const xt::xtensor<T, N>& values)
+  {
+    for (auto n : values.shape()) {
+      write(static_cast<size_t>(n));
+    }
+    write_bytes(values.data(), values.size() * sizeof(T));
+  }
+
+  //! Append the size and elements of a one-dimensional node-shared array
+  template<typename T>
+  void write(const NodeSharedArray<T>& values)
+  {
+    write(values.size());
+    write_bytes(values.data(), values.size() * sizeof(T));
+  }
+
+  void write(const std::string& value);
+
+  const vector<char>& data() const { return data_; }
+
+private:
+  void write_bytes(const void* p, size_t n);
+
+  vector<char> data_; //!< Serialized objects
+};
+
+//==============================================================================
+//! Sequential reader of objects serialized with CacheWriter. Reading past the
+//! end of the data throws std::runtime_error.
+//==============================================================================
+
+class CacheReader {
+public:
+  CacheReader() = default;
+  explicit CacheReader(vector<char>&& data) : data_ {std::move(data)} {}
+
+  template<typename T>
+  void read(T& value)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+      "Only trivially copyable values can be read directly");
+    read_bytes(&value, sizeof(T));
+  }
+
+  template<typename T>
+  void read(vector<T>& values)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+      "Only vectors of trivially copyable values can be read directly");
+    size_t n = read<size_t>();
+    check_remaining(n, sizeof(T));
+    values.resize(n);
+    read_bytes(values.data(), n * sizeof(T));
+  }
+
+  template<typename T, size_t N>
+  void read(xt::xtensor<T, N>& values)
+  {
+    array<size_t, N> shape;
+    size_t n = 1;
+    for (auto& s : shape) {
+      read(s);
+      n *= s;
+    }
+    check_remaining(n, sizeof(T));
+    values.resize(shape);
+    read_bytes(values.data(), n * sizeof(T));
+  }
+
+  template<typename T>
+  void read(NodeSharedArray<T>& values)
+  {
+    vector<T> v;
+    read(v);
+    values = std::move(v);
+  }
+
+  void read(std::string& value);
+
+  //! Read a value of a default-constructible type
+  template<typename T>
+  T read()
+  {
+    T value;
+    read(value);
+    return value;
+  }
+
+  //! Bytes that have not been read yet
+  gsl::span<const char> unread() const
+  {
+    return {data_.data() + pos_, data_.size() - pos_};
+  }
+
+private:
+  void read_bytes(void* p, size_t n);
+
+  //! Make sure that n values of the given size can still be read, so that
+  //! corrupt sizes are detected before memory is allocated for them
+  void check_remaining(size_t n, size_t size) const;
+
+  vector<char> data_; //!< Serialized objects
+  size_t pos_ {0};    //!< Position of the next value to read
+};
+
+//==============================================================================
+//! Entry in the cross section cache holding the data of one nuclide. The entry
+//! is identified by the library file that the nuclide is read from, including
+//! its size, inode, and modification and status change times, and by the
+//! temperatures that are loaded. Only the data read from the library are
+//! cached; derived cross sections are computed again when an entry is loaded.
+//==============================================================================
+
+class XsCacheEntry {
+public:
+  //! Throws std::runtime_error if the status of the library file cannot be
+  //! determined.
+  //
+  //! \param[in] group  HDF5 group of the nuclide in its library
+  //! \param[in] temperatures  Temperatures in [K] that are loaded
+  XsCacheEntry(hid_t group, const vector<int>& temperatures);
+
+  //! Read the entry with a single read if it exists and is valid
+  //
+  //! \param[out] cache  Reader positioned at the start of the cached data
+  //! \return Whether a valid entry was found
+  bool load(CacheReader& cache) const;
+
+  //! Write the entry, replacing any existing one. The file is written under a
+  //! temporary name and then renamed so that concurrent runs never see a
+  //! partially written entry. Throws std::runtime_error on failure.
+  //
+  //! \param[in] cache  Serialized data of the nuclide
+  void store(const CacheWriter& cache) const;
+
+  const std::string& path() const { return path_; }
+
+private:
+  std::string path_; //!< Path of the cache file
+  CacheWriter key_;  //!< Key stored at the start of the file
+};
+
+} // namespace openmc
+
+#endif // OPENMC_XS_CACHE_H
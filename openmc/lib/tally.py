@@ -49,6 +49,9 @@ _dll.openmc_tally_get_nuclides.argtypes = [
     c_int32, POINTER(POINTER(c_int)), POINTER(c_int)]
 _dll.openmc_tally_get_nuclides.restype = c_int
 _dll.openmc_tally_get_nuclides.errcheck = _error_handler
+_dll.openmc_tally_get_reduce_time.argtypes = [c_int32, POINTER(c_double)]
+_dll.openmc_tally_get_reduce_time.restype = c_int
+_dll.openmc_tally_get_reduce_time.errcheck = _error_handler
 _dll.openmc_tally_get_scores.argtypes = [
     c_int32, POINTER(POINTER(c_int)), POINTER(c_int)]
 _dll.openmc_tally_get_scores.restype = c_int
@@ -188,6 +191,10 @@ class Tally(_FortranObjectWithID):
         List of nuclides to score results for
     num_realizations : int
         Number of realizations
+    reduce_time : float
+        Time in [s] spent reducing results across processes
+
+        .. versionadded:: 0.14.1
     results : numpy.ndarray
         Array of tally results
     std_dev : numpy.ndarray
@@ -333,6 +340,12 @@ class Tally(_FortranObjectWithID):
         _dll.openmc_tally_get_n_realizations(self._index, n)
         return n.value
 
+    @property
+    def reduce_time(self):
+        time = c_double()
+        _dll.openmc_tally_get_reduce_time(self._index, time)
+        return time.value
+
     @property
     def results(self):
         data = POINTER(c_double)()
@@ -39,8 +39,18 @@ class Settings:
 
     Attributes
     ----------
+    banked_xs_lookup : bool
+        Indicate whether to perform neutron cross section lookups in banks of
+        particles grouped by material when using event-based parallelism.
+
+        .. versionadded:: 0.14.1
     batches : int
         Number of batches to simulate
+    compact_source_sites : bool
+        If True, the direction and energy of source sites sent between MPI
+        processes when redistributing the fission bank are sent in single
+        precision. This reduces communication but results then depend on the
+        number of processes.
     confidence_intervals : bool
         If True, uncertainties on tally results will be reported as the
         half-width of the 95% two-sided confidence interval. If False,
@@ -48,6 +58,11 @@ class Settings:
         deviation.
     create_fission_neutrons : bool
         Indicate whether fission neutrons should be created or not.
+    cross_section_cache : PathLike
+        Directory in which the nuclide data read from cross section libraries is
+        cached in a binary format so that later runs start faster.
+
+        .. versionadded:: 0.14.1
     cutoff : dict
         Dictionary defining weight cutoff, energy cutoff and time cutoff. The
         dictionary may have ten keys, 'weight', 'weight_avg', 'energy_neutron',
@@ -68,6 +83,14 @@ class Settings:
     electron_treatment : {'led', 'ttb'}
         Whether to deposit all energy from electrons locally ('led') or create
         secondary bremsstrahlung photons ('ttb').
+    energy_grid : {'logarithm', 'material-union', 'hash'}
+        Method used to accelerate searches on nuclide energy grids. The
+        'logarithm' method searches within equal-logarithmic bins, the
+        'material-union' method uses a unionized grid for each material with
+        pre-resolved nuclide grid indices, and the 'hash' method uses hash
+        bins sized to the density of points on each nuclide energy grid.
+
+        .. versionadded:: 0.14.1
     energy_mode : {'continuous-energy', 'multi-group'}
         Set whether the calculation should be continuous-energy or multi-group.
     entropy_mesh : openmc.RegularMesh
@@ -129,6 +152,13 @@ class Settings:
         lost particles.
 
         .. versionadded:: 0.14.0
+    neighbor_list_rays : int
+        Number of rays traced from the external source before transport to
+        populate the lists of neighboring cells used when particles cross
+        surfaces. Populating the lists up front keeps them from growing
+        during transport.
+
+        .. versionadded:: 0.14.1
     no_reduce : bool
         Indicate that all user-defined and global tallies should not be reduced
         across processes in a parallel calculation.
@@ -145,6 +175,15 @@ class Settings:
         Whether to use photon transport.
     plot_seed : int
        Initial seed for randomly generated plot colors.
+    private_tally_buffers : bool
+        Indicate whether each thread should accumulate tally results in a
+        private buffer that is merged into the tally results at the end of
+        each batch. Small tallies use a buffer with an entry for every bin,
+        while large tallies use a fixed-size hash table. Tallies whose buffers
+        would exceed :attr:`Settings.tally_buffer_memory` are updated
+        atomically instead.
+
+        .. versionadded:: 0.14.1
     ptables : bool
         Determine whether probability tables are used.
     random_ray : dict
@@ -174,6 +213,18 @@ class Settings:
         The type of calculation to perform (default is 'eigenvalue')
     seed : int
         Seed for the linear congruential pseudorandom number generator
+    shared_nuclear_data : bool
+        Indicate whether to store nuclide energy grids, cross sections, and
+        secondary outgoing energy distributions once in memory shared by all
+        MPI processes on a node.
+
+        .. versionadded:: 0.14.1
+    sort_xs_queues : bool
+        Indicate whether to sort the cross section lookup queues by particle
+        type, material, and energy before processing them when using
+        event-based parallelism.
+
+        .. versionadded:: 0.14.1
     source : Iterable of openmc.SourceBase
         Distribution of source sites in space, angle, and energy
     sourcepoint : dict
@@ -189,6 +240,10 @@ class Settings:
         Options for writing state points. Acceptable keys are:
 
         :batches: list of batches at which to write statepoint files
+        :async: bool indicating whether statepoint files and HDF5 source
+                point files written during the simulation, including the
+                surface source file, are assembled in memory and written to
+                disk by a background thread while the simulation continues
     surf_source_read : dict
         Options for reading surface source points. Acceptable keys are:
 
@@ -210,6 +265,11 @@ class Settings:
         is a bool stating whether the conversion to tabular is performed; the
         value for 'num_points' sets the number of points to use in the tabular
         distribution, should 'enable' be True.
+    tally_buffer_memory : float
+        Maximum memory in [MB] used by thread-private tally buffers on each
+        process when :attr:`Settings.private_tally_buffers` is set.
+
+        .. versionadded:: 0.14.1
     temperature : dict
         Defines a default temperature and method for treating intermediate
         temperatures at which nuclear data doesn't exist. Accepted keys are
@@ -232,6 +292,9 @@ class Settings:
         Specify particles for which track files should be written. Each particle
         is identified by a tuple with the batch number, generation number, and
         particle number.
+    track_compression : int
+        Level of gzip compression, from 0 to 9, applied to the datasets in the
+        track file. A level of 0 disables compression.
     trigger_active : bool
         Indicate whether tally triggers are used
     trigger_batch_interval : int
@@ -243,6 +306,14 @@ class Settings:
     ufs_mesh : openmc.RegularMesh
         Mesh to be used for redistributing source sites via the uniform fission
         site (UFS) method.
+    universe_partitioners : dict
+        Methods for partitioning universes to speed up searches for the cell
+        containing a particle. Keys are universe IDs or 'default' for the method
+        used by universes not listed explicitly; values are 'none', 'z-plane'
+        or 'octree'. By default, universes with more than 10 cells and more
+        than 5 z-planes are partitioned by z-plane.
+
+        .. versionadded:: 0.14.1
     verbosity : int
         Verbosity during simulation between 1 and 10. Verbosity levels are
         described in :ref:`verbosity`.
@@ -292,11 +363,13 @@ class Settings:
 
         # Energy mode subelement
         self._energy_mode = None
+        self._energy_grid = None
         self._max_order = None
 
         # Source subelement
         self._source = cv.CheckedList(SourceBase, 'source distributions')
 
+        self._compact_source_sites = None
         self._confidence_intervals = None
         self._electron_treatment = None
         self._photon_transport = None
@@ -323,6 +396,8 @@ class Settings:
         self._surf_source_write = {}
 
         self._no_reduce = None
+        self._private_tally_buffers = None
+        self._tally_buffer_memory = None
 
         self._verbosity = None
 
@@ -352,6 +427,10 @@ class Settings:
         self._event_based = None
         self._max_particles_in_flight = None
         self._max_particle_events = None
+        self._sort_xs_queues = None
+        self._shared_nuclear_data = None
+        self._cross_section_cache = None
+        self._banked_xs_lookup = None
         self._write_initial_source = None
         self._weight_windows = cv.CheckedList(WeightWindows, 'weight windows')
         self._weight_window_generators = cv.CheckedList(WeightWindowGenerator, 'weight window generators')
@@ -360,6 +439,9 @@ class Settings:
         self._weight_window_checkpoints = {}
         self._max_splits = None
         self._max_tracks = None
+        self._track_compression = None
+        self._neighbor_list_rays = None
+        self._universe_partitioners = {}
 
         self._random_ray = {}
 
@@ -491,6 +573,16 @@ class Settings:
                     ['continuous-energy', 'multi-group'])
         self._energy_mode = energy_mode
 
+    @property
+    def energy_grid(self) -> str:
+        return self._energy_grid
+
+    @energy_grid.setter
+    def energy_grid(self, value: str):
+        cv.check_value('energy grid', value,
+                       ['logarithm', 'material-union', 'hash'])
+        self._energy_grid = value
+
     @property
     def max_order(self) -> int:
         return self._max_order
@@ -513,6 +605,15 @@ class Settings:
             source = [source]
         self._source = cv.CheckedList(SourceBase, 'source distributions', source)
 
+    @property
+    def compact_source_sites(self) -> bool:
+        return self._compact_source_sites
+
+    @compact_source_sites.setter
+    def compact_source_sites(self, value: bool):
+        cv.check_type('compact source sites', value, bool)
+        self._compact_source_sites = value
+
     @property
     def confidence_intervals(self) -> bool:
         return self._confidence_intervals
@@ -668,6 +769,8 @@ class Settings:
                 cv.check_type('statepoint batches', value, Iterable, Integral)
                 for batch in value:
                     cv.check_greater_than('statepoint batch', batch, 0)
+            elif key == 'async':
+                cv.check_type('statepoint async', value, bool)
             else:
                 raise ValueError(f"Unknown key '{key}' encountered when "
                                  "setting statepoint options.")
@@ -722,6 +825,25 @@ class Settings:
         cv.check_type('no reduction option', no_reduce, bool)
         self._no_reduce = no_reduce
 
+    @property
+    def private_tally_buffers(self) -> bool:
+        return self._private_tally_buffers
+
+    @private_tally_buffers.setter
+    def private_tally_buffers(self, value: bool):
+        cv.check_type('private tally buffers', value, bool)
+        self._private_tally_buffers = value
+
+    @property
+    def tally_buffer_memory(self) -> float:
+        return self._tally_buffer_memory
+
+    @tally_buffer_memory.setter
+    def tally_buffer_memory(self, value: float):
+        cv.check_type('tally buffer memory', value, Real)
+        cv.check_greater_than('tally buffer memory', value, 0.0, True)
+        self._tally_buffer_memory = value
+
     @property
     def verbosity(self) -> int:
         return self._verbosity
@@ -968,6 +1090,42 @@ class Settings:
         cv.check_greater_than('max particle events', value, 0)
         self._max_particle_events = value
 
+    @property
+    def sort_xs_queues(self) -> bool:
+        return self._sort_xs_queues
+
+    @sort_xs_queues.setter
+    def sort_xs_queues(self, value: bool):
+        cv.check_type('sort xs queues', value, bool)
+        self._sort_xs_queues = value
+
+    @property
+    def shared_nuclear_data(self) -> bool:
+        return self._shared_nuclear_data
+
+    @shared_nuclear_data.setter
+    def shared_nuclear_data(self, value: bool):
+        cv.check_type('shared nuclear data', value, bool)
+        self._shared_nuclear_data = value
+
+    @property
+    def cross_section_cache(self) -> Optional[PathLike]:
+        return self._cross_section_cache
+
+    @cross_section_cache.setter
+    def cross_section_cache(self, value: PathLike):
+        cv.check_type('cross section cache', value, (str, Path))
+        self._cross_section_cache = value
+
+    @property
+    def banked_xs_lookup(self) -> bool:
+        return self._banked_xs_lookup
+
+    @banked_xs_lookup.setter
+    def banked_xs_lookup(self, value: bool):
+        cv.check_type('banked xs lookup', value, bool)
+        self._banked_xs_lookup = value
+
     @property
     def write_initial_source(self) -> bool:
         return self._write_initial_source
@@ -1026,6 +1184,41 @@ class Settings:
         cv.check_greater_than('maximum particle tracks', value, 0, True)
         self._max_tracks = value
 
+    @property
+    def track_compression(self) -> int:
+        return self._track_compression
+
+    @track_compression.setter
+    def track_compression(self, value: int):
+        cv.check_type('track compression level', value, Integral)
+        cv.check_greater_than('track compression level', value, 0, True)
+        cv.check_less_than('track compression level', value, 9, True)
+        self._track_compression = value
+
+    @property
+    def neighbor_list_rays(self) -> int:
+        return self._neighbor_list_rays
+
+    @neighbor_list_rays.setter
+    def neighbor_list_rays(self, value: int):
+        cv.check_type('neighbor list rays', value, Integral)
+        cv.check_greater_than('neighbor list rays', value, 0, True)
+        self._neighbor_list_rays = value
+
+    @property
+    def universe_partitioners(self) -> dict:
+        return self._universe_partitioners
+
+    @universe_partitioners.setter
+    def universe_partitioners(self, partitioners: dict):
+        cv.check_type('universe partitioners', partitioners, Mapping)
+        for key, value in partitioners.items():
+            if key != 'default':
+                cv.check_type('universe partitioner key', key, Integral)
+            cv.check_value('universe partitioning method', value,
+                           ('none', 'z-plane', 'octree'))
+        self._universe_partitioners = dict(partitioners)
+
     @property
     def weight_windows_file(self) -> Optional[PathLike]:
         return self._weight_windows_file
@@ -1121,6 +1314,11 @@ class Settings:
             element = ET.SubElement(root, "energy_mode")
             element.text = str(self._energy_mode)
 
+    def _create_energy_grid_subelement(self, root):
+        if self._energy_grid is not None:
+            elem = ET.SubElement(root, "energy_grid")
+            elem.text = str(self._energy_grid)
+
     def _create_max_order_subelement(self, root):
         if self._max_order is not None:
             element = ET.SubElement(root, "max_order")
@@ -1166,6 +1364,9 @@ class Settings:
                 subelement = ET.SubElement(element, "batches")
                 subelement.text = ' '.join(
                     str(x) for x in self._statepoint['batches'])
+            if 'async' in self._statepoint:
+                subelement = ET.SubElement(element, "async")
+                subelement.text = str(self._statepoint['async']).lower()
 
     def _create_sourcepoint_subelement(self, root):
         if self._sourcepoint:
@@ -1214,6 +1415,11 @@ class Settings:
                 subelement = ET.SubElement(element, "mcpl")
                 subelement.text = str(self._surf_source_write['mcpl']).lower()
 
+    def _create_compact_source_sites_subelement(self, root):
+        if self._compact_source_sites is not None:
+            element = ET.SubElement(root, "compact_source_sites")
+            element.text = str(self._compact_source_sites).lower()
+
     def _create_confidence_intervals(self, root):
         if self._confidence_intervals is not None:
             element = ET.SubElement(root, "confidence_intervals")
@@ -1305,6 +1511,16 @@ class Settings:
             element = ET.SubElement(root, "no_reduce")
             element.text = str(self._no_reduce).lower()
 
+    def _create_private_tally_buffers_subelement(self, root):
+        if self._private_tally_buffers is not None:
+            elem = ET.SubElement(root, "private_tally_buffers")
+            elem.text = str(self._private_tally_buffers).lower()
+
+    def _create_tally_buffer_memory_subelement(self, root):
+        if self._tally_buffer_memory is not None:
+            elem = ET.SubElement(root, "tally_buffer_memory")
+            elem.text = str(self._tally_buffer_memory)
+
     def _create_tabular_legendre_subelements(self, root):
         if self.tabular_legendre:
             element = ET.SubElement(root, "tabular_legendre")
@@ -1401,6 +1617,26 @@ class Settings:
             elem = ET.SubElement(root, "max_particle_events")
             elem.text = str(self._max_particle_events).lower()
 
+    def _create_sort_xs_queues_subelement(self, root):
+        if self._sort_xs_queues is not None:
+            elem = ET.SubElement(root, "sort_xs_queues")
+            elem.text = str(self._sort_xs_queues).lower()
+
+    def _create_shared_nuclear_data_subelement(self, root):
+        if self._shared_nuclear_data is not None:
+            elem = ET.SubElement(root, "shared_nuclear_data")
+            elem.text = str(self._shared_nuclear_data).lower()
+
+    def _create_cross_section_cache_subelement(self, root):
+        if self._cross_section_cache is not None:
+            elem = ET.SubElement(root, "cross_section_cache")
+            elem.text = str(self._cross_section_cache)
+
+    def _create_banked_xs_lookup_subelement(self, root):
+        if self._banked_xs_lookup is not None:
+            elem = ET.SubElement(root, "banked_xs_lookup")
+            elem.text = str(self._banked_xs_lookup).lower()
+
     def _create_material_cell_offsets_subelement(self, root):
         if self._material_cell_offsets is not None:
             elem = ET.SubElement(root, "material_cell_offsets")
@@ -1482,6 +1718,23 @@ class Settings:
             elem = ET.SubElement(root, "max_tracks")
             elem.text = str(self._max_tracks)
 
+    def _create_track_compression_subelement(self, root):
+        if self._track_compression is not None:
+            elem = ET.SubElement(root, "track_compression")
+            elem.text = str(self._track_compression)
+
+    def _create_neighbor_list_rays_subelement(self, root):
+        if self._neighbor_list_rays is not None:
+            elem = ET.SubElement(root, "neighbor_list_rays")
+            elem.text = str(self._neighbor_list_rays)
+
+    def _create_universe_partitioners_subelement(self, root):
+        for key, value in self._universe_partitioners.items():
+            elem = ET.SubElement(root, "universe_partitioner")
+            if key != 'default':
+                elem.set("universe", str(key))
+            elem.set("method", value)
+
     def _create_random_ray_subelement(self, root):
         if self._random_ray:
             element = ET.SubElement(root, "random_ray")
@@ -1581,6 +1834,9 @@ class Settings:
             text = get_text(elem, 'batches')
             if text is not None:
                 self.statepoint['batches'] = [int(x) for x in text.split()]
+            text = get_text(elem, 'async')
+            if text is not None:
+                self.statepoint['async'] = text in ('true', '1')
 
     def _sourcepoint_from_xml_element(self, root):
         elem = root.find('source_point')
@@ -1618,6 +1874,11 @@ class Settings:
                         value = value in ('true', '1')
                     self.surf_source_write[key] = value
 
+    def _compact_source_sites_from_xml_element(self, root):
+        text = get_text(root, 'compact_source_sites')
+        if text is not None:
+            self.compact_source_sites = text in ('true', '1')
+
     def _confidence_intervals_from_xml_element(self, root):
         text = get_text(root, 'confidence_intervals')
         if text is not None:
@@ -1633,6 +1894,11 @@ class Settings:
         if text is not None:
             self.energy_mode = text
 
+    def _energy_grid_from_xml_element(self, root):
+        text = get_text(root, 'energy_grid')
+        if text is not None:
+            self.energy_grid = text
+
     def _max_order_from_xml_element(self, root):
         text = get_text(root, 'max_order')
         if text is not None:
@@ -1699,6 +1965,16 @@ class Settings:
         if text is not None:
             self.no_reduce = text in ('true', '1')
 
+    def _private_tally_buffers_from_xml_element(self, root):
+        text = get_text(root, 'private_tally_buffers')
+        if text is not None:
+            self.private_tally_buffers = text in ('true', '1')
+
+    def _tally_buffer_memory_from_xml_element(self, root):
+        text = get_text(root, 'tally_buffer_memory')
+        if text is not None:
+            self.tally_buffer_memory = float(text)
+
     def _verbosity_from_xml_element(self, root):
         text = get_text(root, 'verbosity')
         if text is not None:
@@ -1795,6 +2071,26 @@ class Settings:
         if text is not None:
             self.max_particle_events = int(text)
 
+    def _sort_xs_queues_from_xml_element(self, root):
+        text = get_text(root, 'sort_xs_queues')
+        if text is not None:
+            self.sort_xs_queues = text in ('true', '1')
+
+    def _shared_nuclear_data_from_xml_element(self, root):
+        text = get_text(root, 'shared_nuclear_data')
+        if text is not None:
+            self.shared_nuclear_data = text in ('true', '1')
+
+    def _cross_section_cache_from_xml_element(self, root):
+        text = get_text(root, 'cross_section_cache')
+        if text is not None:
+            self.cross_section_cache = text
+
+    def _banked_xs_lookup_from_xml_element(self, root):
+        text = get_text(root, 'banked_xs_lookup')
+        if text is not None:
+            self.banked_xs_lookup = text in ('true', '1')
+
     def _material_cell_offsets_from_xml_element(self, root):
         text = get_text(root, 'material_cell_offsets')
         if text is not None:
@@ -1844,6 +2140,25 @@ class Settings:
         if text is not None:
             self.max_tracks = int(text)
 
+    def _track_compression_from_xml_element(self, root):
+        text = get_text(root, 'track_compression')
+        if text is not None:
+            self.track_compression = int(text)
+
+    def _neighbor_list_rays_from_xml_element(self, root):
+        text = get_text(root, 'neighbor_list_rays')
+        if text is not None:
+            self.neighbor_list_rays = int(text)
+
+    def _universe_partitioners_from_xml_element(self, root):
+        partitioners = {}
+        for elem in root.findall('universe_partitioner'):
+            key = elem.get('universe')
+            key = 'default' if key is None else int(key)
+            partitioners[key] = elem.get('method')
+        if partitioners:
+            self.universe_partitioners = partitioners
+
     def _random_ray_from_xml_element(self, root):
         elem = root.find('random_ray')
         if elem is not None:
@@ -1881,9 +2196,11 @@ class Settings:
         self._create_sourcepoint_subelement(element)
         self._create_surf_source_read_subelement(element)
         self._create_surf_source_write_subelement(element)
+        self._create_compact_source_sites_subelement(element)
         self._create_confidence_intervals(element)
         self._create_electron_treatment_subelement(element)
         self._create_energy_mode_subelement(element)
+        self._create_energy_grid_subelement(element)
         self._create_max_order_subelement(element)
         self._create_photon_transport_subelement(element)
         self._create_plot_seed_subelement(element)
@@ -1894,6 +2211,8 @@ class Settings:
         self._create_entropy_mesh_subelement(element, mesh_memo)
         self._create_trigger_subelement(element)
         self._create_no_reduce_subelement(element)
+        self._create_private_tally_buffers_subelement(element)
+        self._create_tally_buffer_memory_subelement(element)
         self._create_verbosity_subelement(element)
         self._create_tabular_legendre_subelements(element)
         self._create_temperature_subelements(element)
@@ -1908,6 +2227,10 @@ class Settings:
         self._create_event_based_subelement(element)
         self._create_max_particles_in_flight_subelement(element)
         self._create_max_events_subelement(element)
+        self._create_sort_xs_queues_subelement(element)
+        self._create_banked_xs_lookup_subelement(element)
+        self._create_shared_nuclear_data_subelement(element)
+        self._create_cross_section_cache_subelement(element)
         self._create_material_cell_offsets_subelement(element)
         self._create_log_grid_bins_subelement(element)
         self._create_write_initial_source_subelement(element)
@@ -1917,6 +2240,9 @@ class Settings:
         self._create_weight_window_checkpoints_subelement(element)
         self._create_max_splits_subelement(element)
         self._create_max_tracks_subelement(element)
+        self._create_track_compression_subelement(element)
+        self._create_neighbor_list_rays_subelement(element)
+        self._create_universe_partitioners_subelement(element)
         self._create_random_ray_subelement(element)
 
         # Clean the indentation in the file to be user-readable
@@ -1987,9 +2313,11 @@ class Settings:
         settings._sourcepoint_from_xml_element(elem)
         settings._surf_source_read_from_xml_element(elem)
         settings._surf_source_write_from_xml_element(elem)
+        settings._compact_source_sites_from_xml_element(elem)
         settings._confidence_intervals_from_xml_element(elem)
         settings._electron_treatment_from_xml_element(elem)
         settings._energy_mode_from_xml_element(elem)
+        settings._energy_grid_from_xml_element(elem)
         settings._max_order_from_xml_element(elem)
         settings._photon_transport_from_xml_element(elem)
         settings._plot_seed_from_xml_element(elem)
@@ -2000,6 +2328,8 @@ class Settings:
         settings._entropy_mesh_from_xml_element(elem, meshes)
         settings._trigger_from_xml_element(elem)
         settings._no_reduce_from_xml_element(elem)
+        settings._private_tally_buffers_from_xml_element(elem)
+        settings._tally_buffer_memory_from_xml_element(elem)
         settings._verbosity_from_xml_element(elem)
         settings._tabular_legendre_from_xml_element(elem)
         settings._temperature_from_xml_element(elem)
@@ -2013,6 +2343,10 @@ class Settings:
         settings._event_based_from_xml_element(elem)
         settings._max_particles_in_flight_from_xml_element(elem)
         settings._max_particle_events_from_xml_element(elem)
+        settings._sort_xs_queues_from_xml_element(elem)
+        settings._banked_xs_lookup_from_xml_element(elem)
+        settings._shared_nuclear_data_from_xml_element(elem)
+        settings._cross_section_cache_from_xml_element(elem)
         settings._material_cell_offsets_from_xml_element(elem)
         settings._log_grid_bins_from_xml_element(elem)
         settings._write_initial_source_from_xml_element(elem)
@@ -2021,6 +2355,9 @@ class Settings:
         settings._weight_window_checkpoints_from_xml_element(elem)
         settings._max_splits_from_xml_element(elem)
         settings._max_tracks_from_xml_element(elem)
+        settings._track_compression_from_xml_element(elem)
+        settings._neighbor_list_rays_from_xml_element(elem)
+        settings._universe_partitioners_from_xml_element(elem)
         settings._random_ray_from_xml_element(elem)
 
         # TODO: Get volume calculations
@@ -58,6 +58,12 @@ class Tally(IDManagerMixin):
         Whether reaction rates should be multiplied by atom density
 
         .. versionadded:: 0.14.0
+    decompose : bool
+        Whether the results are partitioned across MPI processes by filter bin
+        during the simulation so that no process holds all of them. This is
+        meant for very large tallies and cannot be combined with triggers.
+
+        .. versionadded:: 0.14.1
     filters : list of openmc.Filter
         List of specified filters for the tally
     nuclides : list of str
@@ -116,6 +122,7 @@ class Tally(IDManagerMixin):
         self._triggers = cv.CheckedList(openmc.Trigger, 'tally triggers')
         self._derivative = None
         self._multiply_density = True
+        self._decompose = False
 
         self._num_realizations = 0
         self._with_summary = False
@@ -164,6 +171,15 @@ class Tally(IDManagerMixin):
         cv.check_type('multiply density', value, bool)
         self._multiply_density = value
 
+    @property
+    def decompose(self):
+        return self._decompose
+
+    @decompose.setter
+    def decompose(self, value):
+        cv.check_type('decompose', value, bool)
+        self._decompose = value
+
     @property
     def filters(self):
         return self._filters
@@ -848,6 +864,10 @@ class Tally(IDManagerMixin):
         if not self.multiply_density:
             element.set("multiply_density", str(self.multiply_density).lower())
 
+        # Partition results across processes
+        if self.decompose:
+            element.set("decompose", "true")
+
         # Optional Tally filters
         if len(self.filters) > 0:
             subelement = ET.SubElement(element, "filters")
@@ -908,6 +928,10 @@ class Tally(IDManagerMixin):
         if text is not None:
             tally.multiply_density = text in ('true', '1')
 
+        text = get_text(elem, 'decompose')
+        if text is not None:
+            tally.decompose = text in ('true', '1')
+
         # Read filters
         filters_elem = elem.find('filters')
         if filters_elem is not None:
@@ -2,6 +2,7 @@ from collections import namedtuple
 from collections.abc import Sequence
 
 import h5py
+import numpy as np
 
 from .checkvalue import check_filetype_version
 from .source import SourceParticle, ParticleType
@@ -29,7 +30,7 @@ def _particle_track_repr(self):
 ParticleTrack.__repr__ = _particle_track_repr
 
 
-_VERSION_TRACK = 3
+_VERSION_TRACK = 4
 
 
 def _identifier(dset_name):
@@ -38,6 +39,33 @@ def _identifier(dset_name):
     return (int(batch), int(gen), int(particle))
 
 
+def _batch_tracks(group):
+    """Yield a Track for each history stored in a batch group"""
+    batch = int(group.name.split('_')[-1])
+    states = group['states'][()]
+    tracks = group['tracks'][()]
+    histories = group['histories'][()]
+
+    # Each history/track extends up to the start of the next one
+    track_ends = np.append(histories['offset'][1:], len(tracks))
+    state_ends = np.append(tracks['offset'][1:], len(states))
+
+    for history, track_end in zip(histories, track_ends):
+        start = history['offset']
+        particle_tracks = [
+            ParticleTrack(ParticleType(particle), states[offset:state_end])
+            for particle, offset, state_end in zip(
+                tracks['particle'][start:track_end],
+                tracks['offset'][start:track_end],
+                state_ends[start:track_end])
+        ]
+        track = Track.__new__(Track)
+        track.identifier = (
+            batch, int(history['generation']), int(history['particle']))
+        track.particle_tracks = particle_tracks
+        yield track
+
+
 class Track(Sequence):
     """Tracks resulting from a single source particle
 
@@ -51,7 +79,8 @@ class Track(Sequence):
     Parameters
     ----------
     dset : h5py.Dataset
-        Dataset to read track data from
+        Dataset to read track data from, as written in version 3 of the track
+        file format
 
     Attributes
     ----------
@@ -214,12 +243,19 @@ class Tracks(list):
     def __init__(self, filepath='tracks.h5'):
         # Read data from track file
         with h5py.File(filepath, 'r') as fh:
-            # Check filetype and version
+            # Check filetype and version, allowing files written with one
+            # dataset per track
+            if fh.attrs['version'][0] == 3:
+                check_filetype_version(fh, 'track', 3)
+                for dset_name in sorted(fh, key=_identifier):
+                    self.append(Track(fh[dset_name]))
+                return
             check_filetype_version(fh, 'track', _VERSION_TRACK)
 
-            for dset_name in sorted(fh, key=_identifier):
-                dset = fh[dset_name]
-                self.append(Track(dset))
+            # Tracks within a batch are in the order they were completed
+            for group in fh.values():
+                self.extend(_batch_tracks(group))
+            self.sort(key=lambda track: track.identifier)
 
     def filter(self, particle=None, state_filter=None):
         """Filter tracks by given criteria
@@ -341,6 +377,31 @@ class Tracks(list):
                         h5_out.attrs['filetype'] = h5_in.attrs['filetype']
                         h5_out.attrs['version'] = h5_in.attrs['version']
 
-                    # Copy each 'track_*' dataset from input file
-                    for dset in h5_in:
-                        h5_in.copy(dset, h5_out)
+                    # Copy each 'track_*' dataset from version 3 files
+                    if h5_in.attrs['version'][0] == 3:
+                        for dset in h5_in:
+                            h5_in.copy(dset, h5_out)
+                        continue
+
+                    # Copy each 'batch_*' group that isn't in the output yet
+                    # and append the data from the rest
+                    for name, group in h5_in.items():
+                        if name not in h5_out:
+                            h5_in.copy(group, h5_out)
+                            continue
+                        out_group = h5_out[name]
+                        n_states = len(out_group['states'])
+                        n_tracks = len(out_group['tracks'])
+                        tracks = group['tracks'][()]
+                        tracks['offset'] += n_states
+                        histories = group['histories'][()]
+                        histories['offset'] += n_tracks
+                        for dset_name, data in [
+                            ('states', group['states'][()]),
+                            ('tracks', tracks),
+                            ('histories', histories)
+                        ]:
+                            dset = out_group[dset_name]
+                            size = len(dset)
+                            dset.resize((size + len(data),))
+                            dset[size:] = data
@@ -2,10 +2,12 @@
 #include "openmc/capi.h"
 #include "openmc/error.h"
 #include "openmc/message_passing.h"
+#include "openmc/openmp_interface.h"
 #include "openmc/simulation.h"
 #include "openmc/vector.h"
 
 #include <cstdint>
+#include <numeric> // for partial_sum
 
 namespace openmc {
 
@@ -65,17 +67,37 @@ void sort_fission_bank()
   }
 
   // Perform exclusive scan summation to determine starting indices in fission
-  // bank for each parent particle id
-  int64_t tmp = simulation::progeny_per_particle[0];
-  simulation::progeny_per_particle[0] = 0;
-  for (int64_t i = 1; i < simulation::progeny_per_particle.size(); i++) {
-    int64_t value = simulation::progeny_per_particle[i - 1] + tmp;
-    tmp = simulation::progeny_per_particle[i];
-    simulation::progeny_per_particle[i] = value;
+  // bank for each parent particle id. The scan is done in parallel by splitting
+  // the array into one chunk per thread: the chunks are summed, the chunk sums
+  // are scanned, and then each chunk is scanned starting from its offset.
+  auto& progeny = simulation::progeny_per_particle;
+  int64_t n_parents = progeny.size();
+  int n_chunks = num_threads();
+  vector<int64_t> chunk_offset(n_chunks + 1, 0);
+
+#pragma omp parallel for schedule(static)
+  for (int c = 0; c < n_chunks; c++) {
+    int64_t sum = 0;
+    for (int64_t i = n_parents * c / n_chunks;
+         i < n_parents * (c + 1) / n_chunks; i++) {
+      sum += progeny[i];
+    }
+    chunk_offset[c + 1] = sum;
   }
 
-  // TODO: C++17 introduces the exclusive_scan() function which could be
-  // used to replace everything above this point in this function.
+  std::partial_sum(
+    chunk_offset.begin(), chunk_offset.end(), chunk_offset.begin());
+
+#pragma omp parallel for schedule(static)
+  for (int c = 0; c < n_chunks; c++) {
+    int64_t sum = chunk_offset[c];
+    for (int64_t i = n_parents * c / n_chunks;
+         i < n_parents * (c + 1) / n_chunks; i++) {
+      int64_t value = progeny[i];
+      progeny[i] = sum;
+      sum += value;
+    }
+  }
 
   // We need a scratch vector to make permutation of the fission bank into
   // sorted order easy. Under normal usage conditions, the fission bank is
@@ -92,21 +114,31 @@ void sort_fission_bank()
     sorted_bank = &simulation::fission_bank[simulation::fission_bank.size()];
   }
 
-  // Use parent and progeny indices to sort fission bank
-  for (int64_t i = 0; i < simulation::fission_bank.size(); i++) {
+  // Use parent and progeny indices to sort fission bank. Every site has a
+  // distinct index, so the sites can be scattered in parallel.
+  int64_t n_bank = simulation::fission_bank.size();
+  bool mismatch = false;
+#pragma omp parallel for schedule(static) reduction(|| : mismatch)
+  for (int64_t i = 0; i < n_bank; i++) {
     const auto& site = simulation::fission_bank[i];
     int64_t offset = site.parent_id - 1 - simulation::work_index[mpi::rank];
-    int64_t idx = simulation::progeny_per_particle[offset] + site.progeny_id;
-    if (idx >= simulation::fission_bank.size()) {
-      fatal_error("Mismatch detected between sum of all particle progeny and "
-                  "shared fission bank size.");
+    int64_t idx = progeny[offset] + site.progeny_id;
+    if (idx >= n_bank) {
+      mismatch = true;
+      continue;
     }
     sorted_bank[idx] = site;
   }
+  if (mismatch) {
+    fatal_error("Mismatch detected between sum of all particle progeny and "
+                "shared fission bank size.");
+  }
 
   // Copy sorted bank into the fission bank
-  std::copy(sorted_bank, sorted_bank + simulation::fission_bank.size(),
-    simulation::fission_bank.data());
+#pragma omp parallel for schedule(static)
+  for (int64_t i = 0; i < n_bank; i++) {
+    simulation::fission_bank[i] = sorted_bank[i];
+  }
 }
 
 //==============================================================================
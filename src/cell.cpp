@@ -428,6 +428,9 @@ vector<int32_t>::iterator CSGCell::find_left_parenthesis(
 // Region implementation
 //==============================================================================
 
+constexpr int32_t Region::OUTSIDE;
+constexpr int32_t Region::INSIDE;
+
 Region::Region(std::string region_spec, int32_t cell_id)
 {
   // Check if region_spec is not empty.
@@ -551,6 +554,9 @@ Region::Region(std::string region_spec, int32_t cell_id)
     }
     expression_.shrink_to_fit();
 
+    if (!simple_)
+      compile(cell_id);
+
   } else {
     simple_ = true;
   }
@@ -826,6 +832,8 @@ bool Region::contains(Position r, Direction u, int32_t on_surface) const
 
 bool Region::contains_simple(Position r, Direction u, int32_t on_surface) const
 {
+  auto& cache = SurfaceSenseCache::thread_cache();
+  cache.set_position(r, u);
   for (int32_t token : expression_) {
     // Assume that no tokens are operators. Evaluate the sense of particle with
     // respect to the surface and see if the token matches the sense. If the
@@ -836,7 +844,7 @@ bool Region::contains_simple(Position r, Direction u, int32_t on_surface) const
       return false;
     } else {
       // Note the off-by-one indexing
-      bool sense = model::surfaces[abs(token) - 1]->sense(r, u);
+      bool sense = cache.sense(abs(token) - 1);
       if (sense != (token > 0)) {
         return false;
       }
@@ -849,59 +857,86 @@ bool Region::contains_simple(Position r, Direction u, int32_t on_surface) const
 
 bool Region::contains_complex(Position r, Direction u, int32_t on_surface) const
 {
-  bool in_cell = true;
-  int total_depth = 0;
+  auto& cache = SurfaceSenseCache::thread_cache();
+  cache.set_position(r, u);
+
+  // Follow the branches until reaching an outcome
+  int32_t i = 0;
+  while (i >= 0) {
+    const auto& branch {branches_[i]};
+    int32_t token = branch.token;
+    bool in_halfspace;
+    if (token == on_surface) {
+      in_halfspace = true;
+    } else if (-token == on_surface) {
+      in_halfspace = false;
+    } else {
+      // Note the off-by-one indexing
+      in_halfspace = (cache.sense(abs(token) - 1) == (token > 0));
+    }
+    i = branch.next[in_halfspace];
+  }
+  return i == INSIDE;
+}
 
-  // For each token
-  for (auto it = expression_.begin(); it != expression_.end(); it++) {
-    int32_t token = *it;
+//==============================================================================
 
-    // If the token is a surface evaluate the sense
-    // If the token is a union or intersection check to
-    // short circuit
+void Region::compile(int32_t cell_id)
+{
+  // Build the expression tree from the postfix form. Each half-space becomes a
+  // branch, numbered in the order they appear, so that every branch in the
+  // left operand of an operator comes before those in its right operand.
+  struct Node {
+    int32_t token; //!< Surface or operator
+    int left;      //!< Left operand of an operator
+    int right;     //!< Right operand of an operator
+    int first;     //!< First branch in the subtree
+  };
+  vector<Node> nodes;
+  vector<int> stack;
+  branches_.clear();
+  for (int32_t token : generate_postfix(cell_id)) {
     if (token < OP_UNION) {
-      if (token == on_surface) {
-        in_cell = true;
-      } else if (-token == on_surface) {
-        in_cell = false;
+      int first = branches_.size();
+      nodes.push_back({token, C_NONE, C_NONE, first});
+      branches_.push_back({token, {OUTSIDE, INSIDE}});
+    } else {
+      int right = stack.back();
+      stack.pop_back();
+      int left = stack.back();
+      stack.pop_back();
+      nodes.push_back({token, left, right, nodes[left].first});
+    }
+    stack.push_back(nodes.size() - 1);
+  }
+  Ensures(stack.size() == 1);
+
+  // Pass the outcomes of each operator down to its operands. The right operand
+  // of an intersection only needs to be tested if the left one is satisfied,
+  // and that of a union only if the left one is not.
+  struct Target {
+    int node;        //!< Subtree
+    int32_t next[2]; //!< Where to go if the subtree is false/true
+  };
+  vector<Target> targets {{stack.back(), {OUTSIDE, INSIDE}}};
+  while (!targets.empty()) {
+    Target t = targets.back();
+    targets.pop_back();
+    const Node& node {nodes[t.node]};
+    if (node.token < OP_UNION) {
+      branches_[node.first].next[0] = t.next[0];
+      branches_[node.first].next[1] = t.next[1];
+    } else {
+      int32_t right = nodes[node.right].first;
+      if (node.token == OP_INTERSECTION) {
+        targets.push_back({node.left, {t.next[0], right}});
       } else {
-        // Note the off-by-one indexing
-        bool sense = model::surfaces[abs(token) - 1]->sense(r, u);
-        in_cell = (sense == (token > 0));
-      }
-    } else if ((token == OP_UNION && in_cell == true) ||
-               (token == OP_INTERSECTION && in_cell == false)) {
-      // If the total depth is zero return
-      if (total_depth == 0) {
-        return in_cell;
+        targets.push_back({node.left, {right, t.next[1]}});
       }
-
-      total_depth--;
-
-      // While the iterator is within the bounds of the vector
-      int depth = 1;
-      do {
-        // Get next token
-        it++;
-        int32_t next_token = *it;
-
-        // If the token is an a parenthesis
-        if (next_token > OP_COMPLEMENT) {
-          // Adjust depth accordingly
-          if (next_token == OP_RIGHT_PAREN) {
-            depth--;
-          } else {
-            depth++;
-          }
-        }
-      } while (depth > 0);
-    } else if (token == OP_LEFT_PAREN) {
-      total_depth++;
-    } else if (token == OP_RIGHT_PAREN) {
-      total_depth--;
+      targets.push_back({node.right, {t.next[0], t.next[1]}});
     }
   }
-  return in_cell;
+  branches_.shrink_to_fit();
 }
 
 //==============================================================================
@@ -10,7 +10,9 @@
 #include "openmc/material.h"
 #include "openmc/message_passing.h"
 #include "openmc/mgxs_interface.h"
+#include "openmc/node_shared.h"
 #include "openmc/nuclide.h"
+#include "openmc/openmp_interface.h"
 #include "openmc/photon.h"
 #include "openmc/settings.h"
 #include "openmc/simulation.h"
@@ -195,60 +197,164 @@ void read_ce_cross_sections(const vector<vector<double>>& nuc_temps,
     thermal_names[kv.second] = kv.first;
   }
 
-  // Read cross sections
-  for (const auto& mat : model::materials) {
-    for (int i_nuc : mat->nuclide_) {
-      // Find name of corresponding nuclide. Because we haven't actually loaded
-      // data, we don't have the name available, so instead we search through
-      // all key/value pairs in nuclide_map
-      std::string& name = nuclide_names[i_nuc];
-
-      // If we've already read this nuclide, skip it
-      if (already_read.find(name) != already_read.end())
-        continue;
-
-      const auto& temps = nuc_temps[i_nuc];
-      int err = openmc_load_nuclide(name.c_str(), temps.data(), temps.size());
-      if (err < 0)
-        throw std::runtime_error {openmc_err_msg};
+#ifdef OPENMC_MPI
+  // Nuclear data is moved to node-shared memory by the master thread while
+  // the other threads are running, which MPI has to support
+  if (settings::shared_nuclear_data) {
+    int provided;
+    MPI_Query_thread(&provided);
+    if (provided < MPI_THREAD_FUNNELED) {
+      warning("The MPI library does not support calls while multiple threads "
+              "are running. Nuclear data will not be shared on each node.");
+      settings::shared_nuclear_data = false;
+    }
+  }
+#endif
+
+  // Read cross sections. The HDF5 library is not reentrant, so libraries are
+  // not read concurrently: all files are read by the master thread, which is
+  // also the only thread making MPI calls. The cross sections derived from the
+  // reactions of each nuclide are computed by the other threads in the
+  // meantime. Errors are collected and raised once all threads have left the
+  // parallel region.
+  int err = 0;
+  std::string err_msg;
+  auto set_error = [&err_msg](const char* msg) {
+#pragma omp critical(read_ce_cross_sections)
+    {
+      if (err_msg.empty())
+        err_msg = msg;
+    }
+  };
+
+#pragma omp parallel
+  {
+#pragma omp master
+    {
+      // Nuclides whose data have not been moved to node-shared memory yet
+      vector<Nuclide*> unshared;
+
+      try {
+        for (const auto& mat : model::materials) {
+          for (int i_nuc : mat->nuclide_) {
+            // Find name of corresponding nuclide. Because we haven't actually
+            // loaded data, we don't have the name available, so instead we
+            // search through all key/value pairs in nuclide_map
+            std::string& name = nuclide_names[i_nuc];
+
+            // If we've already read this nuclide or an error has occurred,
+            // skip it
+            if (err < 0 || already_read.find(name) != already_read.end())
+              continue;
+
+            const auto& temps = nuc_temps[i_nuc];
+            Nuclide* nuc;
+            err = read_nuclide(name.c_str(), temps.data(), temps.size(), nuc);
+            if (err < 0) {
+              set_error(openmc_err_msg);
+              continue;
+            }
+            already_read.insert(name);
+            if (!nuc)
+              continue;
+
+#pragma omp task firstprivate(nuc)
+            {
+              try {
+                nuc->create_derived();
+              } catch (const std::exception& e) {
+                set_error(e.what());
+              }
+            }
+
+            // Store the cross sections once for all processes on the node.
+            // Since every process reads nuclides in the same order, this is
+            // done as soon as one nuclide per thread has been read so that
+            // only a few nuclides are duplicated at a time.
+            if (settings::shared_nuclear_data) {
+              unshared.push_back(nuc);
+              if (unshared.size() == static_cast<size_t>(num_threads())) {
+#pragma omp taskwait
+                for (auto* u : unshared) {
+                  u->share_data();
+                }
+                unshared.clear();
+              }
+            }
+          }
+        }
+      } catch (const std::exception& e) {
+        set_error(e.what());
+      }
 
-      already_read.insert(name);
+#pragma omp taskwait
+      if (err_msg.empty()) {
+        for (auto* u : unshared) {
+          u->share_data();
+        }
+      }
     }
   }
+  if (!err_msg.empty())
+    throw std::runtime_error {err_msg};
+
+  // Revert the temperature method, if needed, now that no other thread is
+  // reading the settings. S(a,b) tables are read afterwards since they depend
+  // on the temperature method.
+  for (const auto& nuc : data::nuclides) {
+    revert_temperature_method(*nuc);
+  }
 
-  // Perform final tasks -- reading S(a,b) tables, normalizing densities
-  for (auto& mat : model::materials) {
+  for (const auto& mat : model::materials) {
     for (const auto& table : mat->thermal_tables_) {
       // Get name of S(a,b) table
       int i_table = table.index_table;
       std::string& name = thermal_names[i_table];
 
-      if (already_read.find(name) == already_read.end()) {
-        LibraryKey key {Library::Type::thermal, name};
-        int idx = data::library_map[key];
-        std::string& filename = data::libraries[idx].path_;
+      if (already_read.find(name) != already_read.end())
+        continue;
 
-        write_message(6, "Reading {} from {}", name, filename);
+      LibraryKey key {Library::Type::thermal, name};
+      auto& library = data::libraries[data::library_map[key]];
+      const auto& filename = library.path_;
 
-        // Open file and make sure version matches
-        hid_t file_id = file_open(filename, 'r');
-        check_data_version(file_id);
+      write_message(6, "Reading {} from {}", name, filename);
+      library.timer_.start();
 
-        // Read thermal scattering data from HDF5
-        hid_t group = open_group(file_id, name.c_str());
-        data::thermal_scatt.push_back(
-          make_unique<ThermalScattering>(group, thermal_temps[i_table]));
-        close_group(group);
-        file_close(file_id);
+      // Open file and make sure version matches
+      hid_t file_id = file_open(filename, 'r');
+      check_data_version(file_id);
 
-        // Add name to dictionary
-        already_read.insert(name);
-      }
-    } // thermal_tables_
+      // Read thermal scattering data from HDF5
+      hid_t group = open_group(file_id, name.c_str());
+      data::thermal_scatt.push_back(
+        make_unique<ThermalScattering>(group, thermal_temps[i_table]));
+      close_group(group);
+      file_close(file_id);
+      library.timer_.stop();
+
+      // Add name to dictionary
+      already_read.insert(name);
+    }
+  }
 
-    // Finish setting up materials (normalizing densities, etc.)
+  if (node_shared_memory() > 0) {
+    write_message(6, "Sharing {:.1f} MB of nuclear data on each node",
+      node_shared_memory() / 1.0e6);
+  }
+
+  // Show the time spent reading from each library
+  for (auto& library : data::libraries) {
+    if (library.timer_.elapsed() > 0.0) {
+      write_message(6, "Time reading {}: {:.3f} s", library.path_,
+        library.timer_.elapsed());
+    }
+  }
+
+  // Finish setting up materials (normalizing densities, etc.)
+  for (auto& mat : model::materials) {
     mat->finalize();
-  } // materials
+  }
 
   if (settings::photon_transport &&
       settings::electron_treatment == ElectronTreatment::TTB) {
@@ -273,6 +273,15 @@ Tabular::Tabular(const double* x, const double* p, int n, Interpolation interp,
   init(x, p, n, c);
 }
 
+Tabular::Tabular(CacheReader& cache)
+{
+  cache.read(x_);
+  cache.read(p_);
+  cache.read(c_);
+  cache.read(interp_);
+  cache.read(integral_);
+}
+
 void Tabular::init(
   const double* x, const double* p, std::size_t n, const double* c)
 {
@@ -312,6 +321,15 @@ void Tabular::init(
   }
 }
 
+void Tabular::serialize(CacheWriter& cache) const
+{
+  cache.write(x_);
+  cache.write(p_);
+  cache.write(c_);
+  cache.write(interp_);
+  cache.write(integral_);
+}
+
 double Tabular::sample(uint64_t* seed) const
 {
   // Sample value of CDF
@@ -62,6 +62,22 @@ AngleDistribution::AngleDistribution(hid_t group)
   }
 }
 
+AngleDistribution::AngleDistribution(CacheReader& cache)
+{
+  cache.read(energy_);
+  for (int i = 0; i < energy_.size(); ++i) {
+    distribution_.push_back(make_unique<Tabular>(cache));
+  }
+}
+
+void AngleDistribution::serialize(CacheWriter& cache) const
+{
+  cache.write(energy_);
+  for (const auto& mudist : distribution_) {
+    mudist->serialize(cache);
+  }
+}
+
 double AngleDistribution::sample(double E, uint64_t* seed) const
 {
   // Determine number of incoming energies
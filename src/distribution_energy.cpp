@@ -1,7 +1,6 @@
 #include "openmc/distribution_energy.h"
 
 #include <algorithm> // for max, min, copy, move
-#include <cstddef>   // for size_t
 #include <iterator>  // for back_inserter
 
 #include "xtensor/xview.hpp"
@@ -26,6 +25,20 @@ DiscretePhoton::DiscretePhoton(hid_t group)
   read_attribute(group, "atomic_weight_ratio", A_);
 }
 
+DiscretePhoton::DiscretePhoton(CacheReader& cache)
+{
+  cache.read(primary_flag_);
+  cache.read(energy_);
+  cache.read(A_);
+}
+
+void DiscretePhoton::serialize(CacheWriter& cache) const
+{
+  cache.write(primary_flag_);
+  cache.write(energy_);
+  cache.write(A_);
+}
+
 double DiscretePhoton::sample(double E, uint64_t* seed) const
 {
   if (primary_flag_ == 2) {
@@ -45,6 +58,18 @@ LevelInelastic::LevelInelastic(hid_t group)
   read_attribute(group, "mass_ratio", mass_ratio_);
 }
 
+LevelInelastic::LevelInelastic(CacheReader& cache)
+{
+  cache.read(threshold_);
+  cache.read(mass_ratio_);
+}
+
+void LevelInelastic::serialize(CacheWriter& cache) const
+{
+  cache.write(threshold_);
+  cache.write(mass_ratio_);
+}
+
 double LevelInelastic::sample(double E, uint64_t* seed) const
 {
   return mass_ratio_ * (E - threshold_);
@@ -73,7 +98,6 @@ ContinuousTabular::ContinuousTabular(hid_t group)
 
   // Get incoming energies
   read_dataset(dset, energy_);
-  std::size_t n_energy = energy_.size();
   close_dataset(dset);
 
   // Get outgoing energy distribution data
@@ -89,62 +113,29 @@ ContinuousTabular::ContinuousTabular(hid_t group)
   read_dataset(dset, eout);
   close_dataset(dset);
 
-  for (int i = 0; i < n_energy; ++i) {
-    // Determine number of outgoing energies
-    int j = offsets[i];
-    int n;
-    if (i < n_energy - 1) {
-      n = offsets[i + 1] - j;
-    } else {
-      n = eout.shape()[1] - j;
-    }
-
-    // Assign interpolation scheme and number of discrete lines
-    CTTable d;
-    d.interpolation = int2interp(interp[i]);
-    d.n_discrete = n_discrete[i];
-
-    // Copy data
-    d.e_out = xt::view(eout, 0, xt::range(j, j + n));
-    d.p = xt::view(eout, 1, xt::range(j, j + n));
-
-    // To get answers that match ACE data, for now we still use the tabulated
-    // CDF values that were passed through to the HDF5 library. At a later
-    // time, we can remove the CDF values from the HDF5 library and
-    // reconstruct them using the PDF
-    if (true) {
-      d.c = xt::view(eout, 2, xt::range(j, j + n));
-    } else {
-      // Calculate cumulative distribution function -- discrete portion
-      for (int k = 0; k < d.n_discrete; ++k) {
-        if (k == 0) {
-          d.c[k] = d.p[k];
-        } else {
-          d.c[k] = d.c[k - 1] + d.p[k];
-        }
-      }
+  distribution_ = OutgoingEnergyTables {eout, offsets, interp, n_discrete, 3};
+}
 
-      // Continuous portion
-      for (int k = d.n_discrete; k < n; ++k) {
-        if (k == d.n_discrete) {
-          d.c[k] = d.c[k - 1] + d.p[k];
-        } else {
-          if (d.interpolation == Interpolation::histogram) {
-            d.c[k] = d.c[k - 1] + d.p[k - 1] * (d.e_out[k] - d.e_out[k - 1]);
-          } else if (d.interpolation == Interpolation::lin_lin) {
-            d.c[k] = d.c[k - 1] + 0.5 * (d.p[k - 1] + d.p[k]) *
-                                    (d.e_out[k] - d.e_out[k - 1]);
-          }
-        }
-      }
+ContinuousTabular::ContinuousTabular(CacheReader& cache)
+{
+  cache.read(breakpoints_);
+  cache.read(interpolation_);
+  cache.read(energy_);
+  n_region_ = breakpoints_.size();
+  distribution_ = OutgoingEnergyTables {cache};
+}
 
-      // Normalize density and distribution functions
-      d.p /= d.c[n - 1];
-      d.c /= d.c[n - 1];
-    }
+void ContinuousTabular::serialize(CacheWriter& cache) const
+{
+  cache.write(breakpoints_);
+  cache.write(interpolation_);
+  cache.write(energy_);
+  distribution_.serialize(cache);
+}
 
-    distribution_.push_back(std::move(d));
-  } // incoming energies
+void ContinuousTabular::share_data()
+{
+  distribution_.share_data();
 }
 
 double ContinuousTabular::sample(double E, uint64_t* seed) const
@@ -182,47 +173,28 @@ double ContinuousTabular::sample(double E, uint64_t* seed) const
   }
 
   // Determine outgoing energy bin
-  int n_energy_out = distribution_[l].e_out.size();
-  int n_discrete = distribution_[l].n_discrete;
+  int n_energy_out = distribution_.n(l);
+  int n_discrete = distribution_.n_discrete(l);
+  const double* e_out = distribution_.e_out(l);
+  const double* p = distribution_.p(l);
   double r1 = prn(seed);
-  double c_k = distribution_[l].c[0];
-  int k = 0;
-  int end = n_energy_out - 2;
-
-  // Discrete portion
-  for (int j = 0; j < n_discrete; ++j) {
-    k = j;
-    c_k = distribution_[l].c[k];
-    if (r1 < c_k) {
-      end = j;
-      break;
-    }
-  }
-
-  // Continuous portion
-  double c_k1;
-  for (int j = n_discrete; j < end; ++j) {
-    k = j;
-    c_k1 = distribution_[l].c[k + 1];
-    if (r1 < c_k1)
-      break;
-    k = j + 1;
-    c_k = c_k1;
-  }
+  auto bin = distribution_.find_bin(l, r1);
+  int k = bin.k;
+  double c_k = bin.c_k;
 
-  double E_l_k = distribution_[l].e_out[k];
-  double p_l_k = distribution_[l].p[k];
+  double E_l_k = e_out[k];
+  double p_l_k = p[k];
   double E_out = E_l_k;
-  if (distribution_[l].interpolation == Interpolation::histogram) {
+  if (distribution_.interpolation(l) == Interpolation::histogram) {
     // Histogram interpolation
     if (p_l_k > 0.0 && k >= n_discrete) {
       E_out = E_l_k + (r1 - c_k) / p_l_k;
     }
 
-  } else if (distribution_[l].interpolation == Interpolation::lin_lin) {
+  } else if (distribution_.interpolation(l) == Interpolation::lin_lin) {
     // Linear-linear interpolation
-    double E_l_k1 = distribution_[l].e_out[k + 1];
-    double p_l_k1 = distribution_[l].p[k + 1];
+    double E_l_k1 = e_out[k + 1];
+    double p_l_k1 = p[k + 1];
 
     if (E_l_k != E_l_k1) {
       double frac = (p_l_k1 - p_l_k) / (E_l_k1 - E_l_k);
@@ -244,15 +216,13 @@ double ContinuousTabular::sample(double E, uint64_t* seed) const
   // Now interpolate between incident energy bins i and i + 1
   if (!histogram_interp && n_energy_out > 1 && k >= n_discrete) {
     // Interpolation for energy E1 and EK
-    n_energy_out = distribution_[i].e_out.size();
-    n_discrete = distribution_[i].n_discrete;
-    const double E_i_1 = distribution_[i].e_out[n_discrete];
-    const double E_i_K = distribution_[i].e_out[n_energy_out - 1];
+    e_out = distribution_.e_out(i);
+    const double E_i_1 = e_out[distribution_.n_discrete(i)];
+    const double E_i_K = e_out[distribution_.n(i) - 1];
 
-    n_energy_out = distribution_[i + 1].e_out.size();
-    n_discrete = distribution_[i + 1].n_discrete;
-    const double E_i1_1 = distribution_[i + 1].e_out[n_discrete];
-    const double E_i1_K = distribution_[i + 1].e_out[n_energy_out - 1];
+    e_out = distribution_.e_out(i + 1);
+    const double E_i1_1 = e_out[distribution_.n_discrete(i + 1)];
+    const double E_i1_K = e_out[distribution_.n(i + 1) - 1];
 
     const double E_1 = E_i_1 + r * (E_i1_1 - E_i_1);
     const double E_K = E_i_K + r * (E_i1_K - E_i_K);
@@ -279,6 +249,17 @@ MaxwellEnergy::MaxwellEnergy(hid_t group)
   close_dataset(dset);
 }
 
+MaxwellEnergy::MaxwellEnergy(CacheReader& cache) : theta_ {cache}
+{
+  cache.read(u_);
+}
+
+void MaxwellEnergy::serialize(CacheWriter& cache) const
+{
+  theta_.serialize(cache);
+  cache.write(u_);
+}
+
 double MaxwellEnergy::sample(double E, uint64_t* seed) const
 {
   // Get temperature corresponding to incoming energy
@@ -306,6 +287,17 @@ Evaporation::Evaporation(hid_t group)
   close_dataset(dset);
 }
 
+Evaporation::Evaporation(CacheReader& cache) : theta_ {cache}
+{
+  cache.read(u_);
+}
+
+void Evaporation::serialize(CacheWriter& cache) const
+{
+  theta_.serialize(cache);
+  cache.write(u_);
+}
+
 double Evaporation::sample(double E, uint64_t* seed) const
 {
   // Get temperature corresponding to incoming energy
@@ -344,6 +336,18 @@ WattEnergy::WattEnergy(hid_t group)
   close_dataset(dset);
 }
 
+WattEnergy::WattEnergy(CacheReader& cache) : a_ {cache}, b_ {cache}
+{
+  cache.read(u_);
+}
+
+void WattEnergy::serialize(CacheWriter& cache) const
+{
+  a_.serialize(cache);
+  b_.serialize(cache);
+  cache.write(u_);
+}
+
 double WattEnergy::sample(double E, uint64_t* seed) const
 {
   // Determine Watt parameters at incident energy
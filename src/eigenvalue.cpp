@@ -14,6 +14,7 @@
 #include "openmc/math_functions.h"
 #include "openmc/mesh.h"
 #include "openmc/message_passing.h"
+#include "openmc/openmp_interface.h"
 #include "openmc/random_lcg.h"
 #include "openmc/search.h"
 #include "openmc/settings.h"
@@ -23,8 +24,10 @@
 
 #include <algorithm> // for min
 #include <cmath>     // for sqrt, abs, pow
+#include <cstring>   // for memcpy
 #include <iterator>  // for back_inserter
 #include <limits>    //for infinity
+#include <numeric>   // for partial_sum
 #include <string>
 
 namespace openmc {
@@ -42,10 +45,119 @@ xt::xtensor<double, 1> source_frac;
 
 } // namespace simulation
 
+namespace {
+
+//==============================================================================
+// Source bank redistribution
+//==============================================================================
+
+//! Source site as sent between processes. Fields that are not needed for
+//! source sites (surface ID, parent and progeny IDs) are left out and reset
+//! to zero on every process.
+struct WireSite {
+  Position r;
+  Direction u;
+  double E;
+  double time;
+  double wgt;
+  int32_t delayed_group;
+  int32_t particle;
+};
+
+//! Source site as sent between processes when compact_source_sites is set
+struct CompactWireSite {
+  Position r;
+  float u[3];
+  float E;
+  double time;
+  double wgt;
+  int32_t delayed_group;
+  int32_t particle;
+};
+
+} // namespace
+
 //==============================================================================
 // Non-member functions
 //==============================================================================
 
+size_t site_wire_size()
+{
+  return settings::compact_source_sites ? sizeof(CompactWireSite)
+                                        : sizeof(WireSite);
+}
+
+void pack_sites(const SourceSite* sites, int64_t n, char* buffer)
+{
+  for (int64_t i = 0; i < n; ++i) {
+    const auto& site = sites[i];
+    if (settings::compact_source_sites) {
+      CompactWireSite w {site.r,
+        {static_cast<float>(site.u.x), static_cast<float>(site.u.y),
+          static_cast<float>(site.u.z)},
+        static_cast<float>(site.E), site.time, site.wgt, site.delayed_group,
+        static_cast<int32_t>(site.particle)};
+      std::memcpy(buffer + i * sizeof(w), &w, sizeof(w));
+    } else {
+      WireSite w {site.r, site.u, site.E, site.time, site.wgt,
+        site.delayed_group, static_cast<int32_t>(site.particle)};
+      std::memcpy(buffer + i * sizeof(w), &w, sizeof(w));
+    }
+  }
+}
+
+void unpack_sites(const char* buffer, int64_t n, SourceSite* sites)
+{
+  for (int64_t i = 0; i < n; ++i) {
+    auto& site = sites[i];
+    if (settings::compact_source_sites) {
+      CompactWireSite w;
+      std::memcpy(&w, buffer + i * sizeof(w), sizeof(w));
+      site.r = w.r;
+      site.u = {w.u[0], w.u[1], w.u[2]};
+      site.u /= site.u.norm();
+      site.E = w.E;
+      site.time = w.time;
+      site.wgt = w.wgt;
+      site.delayed_group = w.delayed_group;
+      site.particle = static_cast<ParticleType>(w.particle);
+    } else {
+      WireSite w;
+      std::memcpy(&w, buffer + i * sizeof(w), sizeof(w));
+      site.r = w.r;
+      site.u = w.u;
+      site.E = w.E;
+      site.time = w.time;
+      site.wgt = w.wgt;
+      site.delayed_group = w.delayed_group;
+      site.particle = static_cast<ParticleType>(w.particle);
+    }
+    site.surf_id = 0;
+    site.parent_id = 0;
+    site.progeny_id = 0;
+  }
+}
+
+#ifdef OPENMC_MPI
+namespace {
+
+//! Base tag of messages with source sites, which are sent on mpi::bank_comm.
+//! Consecutive generations alternate between two tags.
+constexpr int BANK_EXCHANGE_TAG {1000};
+
+//! State of a redistribution of source sites that has not been finished yet
+struct BankExchange {
+  bool active {false};          //!< Whether sites are still in flight
+  int tag;                      //!< Tag of this generation's messages
+  int64_t n_pending;            //!< Number of sites still to be received
+  MPI_Datatype record;          //!< One wire site, the unit of message sizes
+  vector<vector<char>> buffers; //!< Packed sites being sent
+  vector<MPI_Request> requests; //!< Requests of the sends
+} bank_exchange;
+
+} // namespace
+#endif
+
 void calculate_generation_keff()
 {
   const auto& gt = simulation::global_tallies;
@@ -150,48 +262,72 @@ void synchronize_bank()
   // ==========================================================================
   // SAMPLE N_PARTICLES FROM FISSION BANK AND PLACE IN TEMP_SITES
 
-  // Allocate temporary source bank -- we don't really know how many fission
-  // sites were created, so overallocate by a factor of 3
-  int64_t index_temp = 0;
-  vector<SourceSite> temp_sites(3 * simulation::work_per_rank);
-
-  for (int64_t i = 0; i < simulation::fission_bank.size(); i++) {
-    const auto& site = simulation::fission_bank[i];
-
-    // If there are less than n_particles particles banked, automatically add
-    // int(n_particles/total) sites to temp_sites. For example, if you need
-    // 1000 and 300 were banked, this would add 3 source sites per banked site
-    // and the remaining 100 would be randomly sampled.
-    if (total < settings::n_particles) {
-      for (int64_t j = 1; j <= settings::n_particles / total; ++j) {
-        temp_sites[index_temp] = site;
-        ++index_temp;
-      }
+  // If there are less than n_particles particles banked, automatically add
+  // int(n_particles/total) sites to temp_sites. For example, if you need
+  // 1000 and 300 were banked, this would add 3 source sites per banked site
+  // and the remaining 100 would be randomly sampled.
+  int64_t n_copies =
+    (total < settings::n_particles) ? settings::n_particles / total : 0;
+
+  // Sites are sampled in parallel over one chunk of the fission bank per
+  // thread. Each chunk skips ahead to the random number of its first site, so
+  // every site is sampled with the same random number regardless of the
+  // number of threads. The sites sampled from each chunk are counted first to
+  // determine where they are placed in temp_sites.
+  int64_t n_bank = simulation::fission_bank.size();
+  int n_chunks = num_threads();
+  vector<int64_t> chunk_start(n_chunks + 1, 0);
+
+#pragma omp parallel for schedule(static)
+  for (int c = 0; c < n_chunks; ++c) {
+    int64_t i_start = n_bank * c / n_chunks;
+    uint64_t chunk_seed = seed;
+    advance_prn_seed(i_start, &chunk_seed);
+
+    int64_t n_sampled = 0;
+    for (int64_t i = i_start; i < n_bank * (c + 1) / n_chunks; ++i) {
+      n_sampled += n_copies + (prn(&chunk_seed) < p_sample);
     }
+    chunk_start[c + 1] = n_sampled;
+  }
 
-    // Randomly sample sites needed
-    if (prn(&seed) < p_sample) {
-      temp_sites[index_temp] = site;
-      ++index_temp;
+  std::partial_sum(chunk_start.begin(), chunk_start.end(), chunk_start.begin());
+  int64_t index_temp = chunk_start[n_chunks];
+
+  // Allocate temporary source bank with exactly the number of sites sampled
+  // on this process. If too few were sampled overall, the last process grows
+  // it below by the number of missing sites.
+  vector<SourceSite> temp_sites(index_temp);
+
+#pragma omp parallel for schedule(static)
+  for (int c = 0; c < n_chunks; ++c) {
+    int64_t i_start = n_bank * c / n_chunks;
+    uint64_t chunk_seed = seed;
+    advance_prn_seed(i_start, &chunk_seed);
+
+    int64_t index = chunk_start[c];
+    for (int64_t i = i_start; i < n_bank * (c + 1) / n_chunks; ++i) {
+      const auto& site = simulation::fission_bank[i];
+      int64_t n_sampled = n_copies + (prn(&chunk_seed) < p_sample);
+      for (int64_t j = 0; j < n_sampled; ++j) {
+        temp_sites[index++] = site;
+      }
     }
   }
 
   // At this point, the sampling of source sites is done and now we need to
-  // figure out where to send source sites. Since it is possible that one
-  // processor's share of the source bank spans more than just the immediate
-  // neighboring processors, we have to perform an ALLGATHER to determine the
-  // indices for all processors
+  // figure out where to send source sites. Each process only needs to know
+  // where its own sites start in the 'global' source bank. Messages carry
+  // the global index of their first site, so receiving processes do not need
+  // to know the positions of all other processes.
 
 #ifdef OPENMC_MPI
-  // First do an exclusive scan to get the starting indices for
+  // Do an exclusive scan to get the starting index of the sampled sites
   start = 0;
   MPI_Exscan(&index_temp, &start, 1, MPI_INT64_T, MPI_SUM, mpi::intracomm);
+  if (mpi::rank == 0)
+    start = 0;
   finish = start + index_temp;
-
-  // Allocate space for bank_position if this hasn't been done yet
-  int64_t bank_position[mpi::n_procs];
-  MPI_Allgather(
-    &start, 1, MPI_INT64_T, bank_position, 1, MPI_INT64_T, mpi::intracomm);
 #else
   start = 0;
   finish = index_temp;
@@ -211,10 +347,10 @@ void synchronize_bank()
       // If we have too few sites, repeat sites from the very end of the
       // fission bank
       sites_needed = settings::n_particles - finish;
-      for (int i = 0; i < sites_needed; ++i) {
-        int i_bank = simulation::fission_bank.size() - sites_needed + i;
-        temp_sites[index_temp] = simulation::fission_bank[i_bank];
-        ++index_temp;
+      temp_sites.resize(index_temp + sites_needed);
+      for (int64_t i = 0; i < sites_needed; ++i) {
+        int64_t i_bank = simulation::fission_bank.size() - sites_needed + i;
+        temp_sites[index_temp++] = simulation::fission_bank[i_bank];
       }
     }
 
@@ -229,8 +365,19 @@ void synchronize_bank()
   // ==========================================================================
   // SEND BANK SITES TO NEIGHBORS
 
+  // Sites whose place in the source bank is on this process are copied
+  // directly. All others are packed into a message for the process that owns
+  // their place, which is usually a neighbor.
   int64_t index_local = 0;
-  vector<MPI_Request> requests;
+  int64_t n_local = 0;
+  bank_exchange.tag = BANK_EXCHANGE_TAG + overall_generation() % 2;
+
+  // Message sizes are counted in wire sites rather than bytes so that large
+  // banks do not overflow the int counts of MPI
+  size_t record_size = site_wire_size();
+  MPI_Type_contiguous(
+    static_cast<int>(record_size), MPI_BYTE, &bank_exchange.record);
+  MPI_Type_commit(&bank_exchange.record);
 
   if (start < settings::n_particles) {
     // Determine the index of the processor which has the first part of the
@@ -243,13 +390,32 @@ void synchronize_bank()
       int64_t n =
         std::min(simulation::work_index[neighbor + 1], finish) - start;
 
-      // Initiate an asynchronous send of source sites to the neighboring
-      // process
       if (neighbor != mpi::rank) {
-        requests.emplace_back();
-        MPI_Isend(&temp_sites[index_local], static_cast<int>(n),
-          mpi::source_site, neighbor, mpi::rank, mpi::intracomm,
-          &requests.back());
+        // Pack the sites after a leading record holding the global index of
+        // the first one and initiate an asynchronous send to the neighboring
+        // process
+        size_t n_bytes = (n + 1) * record_size;
+        bank_exchange.buffers.emplace_back(n_bytes);
+        char* buffer = bank_exchange.buffers.back().data();
+        std::memcpy(buffer, &start, sizeof(int64_t));
+        pack_sites(&temp_sites[index_local], n, buffer + record_size);
+
+        bank_exchange.requests.emplace_back();
+        MPI_Isend(buffer, static_cast<int>(n + 1), bank_exchange.record,
+          neighbor, bank_exchange.tag, mpi::bank_comm,
+          &bank_exchange.requests.back());
+        simulation::bank_bytes_sent += n_bytes;
+      } else {
+        auto* dest =
+          &simulation::source_bank[start - simulation::work_index[mpi::rank]];
+        std::copy(&temp_sites[index_local], &temp_sites[index_local + n], dest);
+        for (int64_t i = 0; i < n; ++i) {
+          dest[i].surf_id = 0;
+          dest[i].parent_id = 0;
+          dest[i].progeny_id = 0;
+        }
+        n_local = n;
+        simulation::bank_bytes_copied += n * sizeof(SourceSite);
       }
 
       // Increment all indices
@@ -265,71 +431,68 @@ void synchronize_bank()
     }
   }
 
-  // ==========================================================================
-  // RECEIVE BANK SITES FROM NEIGHBORS OR TEMPORARY BANK
-
-  start = simulation::work_index[mpi::rank];
-  index_local = 0;
-
-  // Determine what process has the source sites that will need to be stored at
-  // the beginning of this processor's source bank.
-
-  int neighbor;
-  if (start >= bank_position[mpi::n_procs - 1]) {
-    neighbor = mpi::n_procs - 1;
-  } else {
-    neighbor =
-      upper_bound_index(bank_position, bank_position + mpi::n_procs, start);
-  }
-
-  while (start < simulation::work_index[mpi::rank + 1]) {
-    // Determine how many sites need to be received
-    int64_t n;
-    if (neighbor == mpi::n_procs - 1) {
-      n = simulation::work_index[mpi::rank + 1] - start;
-    } else {
-      n = std::min(bank_position[neighbor + 1],
-            simulation::work_index[mpi::rank + 1]) -
-          start;
-    }
+  // The rest of the local source bank is received by finish_bank_exchange()
+  // so that communication overlaps with work done before the next generation
+  bank_exchange.n_pending = simulation::work_index[mpi::rank + 1] -
+                            simulation::work_index[mpi::rank] - n_local;
+  bank_exchange.active = true;
 
-    if (neighbor != mpi::rank) {
-      // If the source sites are not on this processor, initiate an
-      // asynchronous receive for the source sites
+#else
+  std::copy(temp_sites.data(), temp_sites.data() + settings::n_particles,
+    simulation::source_bank.begin());
+  simulation::bank_bytes_copied += settings::n_particles * sizeof(SourceSite);
+#endif
 
-      requests.emplace_back();
-      MPI_Irecv(&simulation::source_bank[index_local], static_cast<int>(n),
-        mpi::source_site, neighbor, neighbor, mpi::intracomm, &requests.back());
+  simulation::time_bank_sendrecv.stop();
+  simulation::time_bank.stop();
+}
 
-    } else {
-      // If the source sites are on this procesor, we can simply copy them
-      // from the temp_sites bank
+void finish_bank_exchange()
+{
+#ifdef OPENMC_MPI
+  if (!bank_exchange.active)
+    return;
 
-      index_temp = start - bank_position[mpi::rank];
-      std::copy(&temp_sites[index_temp], &temp_sites[index_temp + n],
-        &simulation::source_bank[index_local]);
-    }
+  simulation::time_bank.start();
+  simulation::time_bank_sendrecv.start();
 
-    // Increment all indices
-    start += n;
-    index_local += n;
-    ++neighbor;
+  // ==========================================================================
+  // RECEIVE BANK SITES FROM NEIGHBORS
+
+  // Messages may arrive from any process in any order; the global index in
+  // the leading record of each message determines where its sites belong
+  size_t record_size = site_wire_size();
+  vector<char> buffer;
+  while (bank_exchange.n_pending > 0) {
+    MPI_Status status;
+    MPI_Probe(MPI_ANY_SOURCE, bank_exchange.tag, mpi::bank_comm, &status);
+    int n_records;
+    MPI_Get_count(&status, bank_exchange.record, &n_records);
+    buffer.resize(n_records * record_size);
+    MPI_Recv(buffer.data(), n_records, bank_exchange.record,
+      status.MPI_SOURCE, bank_exchange.tag, mpi::bank_comm,
+      MPI_STATUS_IGNORE);
+
+    int64_t first;
+    std::memcpy(&first, buffer.data(), sizeof(int64_t));
+    int64_t n = n_records - 1;
+    unpack_sites(buffer.data() + record_size, n,
+      &simulation::source_bank[first - simulation::work_index[mpi::rank]]);
+    bank_exchange.n_pending -= n;
   }
 
-  // Since we initiated a series of asynchronous ISENDs and IRECVs, now we have
-  // to ensure that the data has actually been communicated before moving on to
-  // the next generation
-
-  int n_request = requests.size();
-  MPI_Waitall(n_request, requests.data(), MPI_STATUSES_IGNORE);
-
-#else
-  std::copy(temp_sites.data(), temp_sites.data() + settings::n_particles,
-    simulation::source_bank.begin());
-#endif
+  // Make sure all sites sent by this process have been delivered before the
+  // send buffers are released
+  MPI_Waitall(bank_exchange.requests.size(), bank_exchange.requests.data(),
+    MPI_STATUSES_IGNORE);
+  bank_exchange.requests.clear();
+  bank_exchange.buffers.clear();
+  MPI_Type_free(&bank_exchange.record);
+  bank_exchange.active = false;
 
   simulation::time_bank_sendrecv.stop();
   simulation::time_bank.stop();
+#endif
 }
 
 void calculate_average_keff()
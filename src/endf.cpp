@@ -112,6 +112,41 @@ unique_ptr<Function1D> read_function(hid_t group, const char* name)
   return func;
 }
 
+unique_ptr<Function1D> read_function(CacheReader& cache)
+{
+  switch (cache.read<CacheType>()) {
+  case CacheType::none:
+    return nullptr;
+  case CacheType::polynomial:
+    return make_unique<Polynomial>(cache);
+  case CacheType::tabulated_1d:
+    return make_unique<Tabulated1D>(cache);
+  case CacheType::sum_1d:
+    return make_unique<Sum1D>(cache);
+  default:
+    throw std::runtime_error {"Unknown function type in cross section cache"};
+  }
+}
+
+void write_function(CacheWriter& cache, const Function1D* func)
+{
+  if (!func) {
+    cache.write(CacheType::none);
+  } else if (auto f = dynamic_cast<const Polynomial*>(func)) {
+    cache.write(CacheType::polynomial);
+    f->serialize(cache);
+  } else if (auto f = dynamic_cast<const Tabulated1D*>(func)) {
+    cache.write(CacheType::tabulated_1d);
+    f->serialize(cache);
+  } else if (auto f = dynamic_cast<const Sum1D*>(func)) {
+    cache.write(CacheType::sum_1d);
+    f->serialize(cache);
+  } else {
+    throw std::runtime_error {
+      "Function type cannot be written to the cross section cache"};
+  }
+}
+
 //==============================================================================
 // Polynomial implementation
 //==============================================================================
@@ -122,6 +157,16 @@ Polynomial::Polynomial(hid_t dset)
   read_dataset(dset, coef_);
 }
 
+Polynomial::Polynomial(CacheReader& cache)
+{
+  cache.read(coef_);
+}
+
+void Polynomial::serialize(CacheWriter& cache) const
+{
+  cache.write(coef_);
+}
+
 double Polynomial::operator()(double x) const
 {
   // Use Horner's rule to evaluate polynomial. Note that coefficients are
@@ -164,6 +209,24 @@ Tabulated1D::Tabulated1D(hid_t dset)
   n_pairs_ = x_.size();
 }
 
+Tabulated1D::Tabulated1D(CacheReader& cache)
+{
+  cache.read(nbt_);
+  cache.read(int_);
+  cache.read(x_);
+  cache.read(y_);
+  n_regions_ = nbt_.size();
+  n_pairs_ = x_.size();
+}
+
+void Tabulated1D::serialize(CacheWriter& cache) const
+{
+  cache.write(nbt_);
+  cache.write(int_);
+  cache.write(x_);
+  cache.write(y_);
+}
+
 double Tabulated1D::operator()(double x) const
 {
   // find which bin the abscissa is in -- if the abscissa is outside the
@@ -290,6 +353,22 @@ Sum1D::Sum1D(hid_t group)
   }
 }
 
+Sum1D::Sum1D(CacheReader& cache)
+{
+  auto n = cache.read<size_t>();
+  for (size_t i = 0; i < n; ++i) {
+    functions_.push_back(read_function(cache));
+  }
+}
+
+void Sum1D::serialize(CacheWriter& cache) const
+{
+  cache.write(functions_.size());
+  for (const auto& func : functions_) {
+    write_function(cache, func.get());
+  }
+}
+
 double Sum1D::operator()(double x) const
 {
   double result = 0.0;
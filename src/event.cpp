@@ -1,5 +1,13 @@
 #include "openmc/event.h"
+
+#include <algorithm> // for fill, max, min
+#include <cmath>     // for log
+#include <utility>   // for swap
+
 #include "openmc/material.h"
+#include "openmc/nuclide.h"
+#include "openmc/openmp_interface.h"
+#include "openmc/settings.h"
 #include "openmc/simulation.h"
 #include "openmc/timer.h"
 
@@ -16,9 +24,14 @@ SharedArray<EventQueueItem> calculate_nonfuel_xs_queue;
 SharedArray<EventQueueItem> advance_particle_queue;
 SharedArray<EventQueueItem> surface_crossing_queue;
 SharedArray<EventQueueItem> collision_queue;
+SharedArray<EventQueueItem> xs_lookup_bank;
 
 vector<Particle> particles;
 
+vector<EventQueueItem> sorted_queue_buffer;
+vector<uint64_t> sort_keys;
+vector<uint64_t> sorted_keys_buffer;
+
 } // namespace simulation
 
 //==============================================================================
@@ -34,6 +47,16 @@ void init_event_queues(int64_t n_particles)
   simulation::collision_queue.reserve(n_particles);
 
   simulation::particles.resize(n_particles);
+
+  if (settings::banked_xs_lookup) {
+    simulation::xs_lookup_bank.reserve(n_particles);
+  }
+
+  if (settings::sort_xs_queues || settings::banked_xs_lookup) {
+    simulation::sorted_queue_buffer.resize(n_particles);
+    simulation::sort_keys.resize(n_particles);
+    simulation::sorted_keys_buffer.resize(n_particles);
+  }
 }
 
 void free_event_queues(void)
@@ -43,8 +66,13 @@ void free_event_queues(void)
   simulation::advance_particle_queue.clear();
   simulation::surface_crossing_queue.clear();
   simulation::collision_queue.clear();
+  simulation::xs_lookup_bank.clear();
 
   simulation::particles.clear();
+
+  simulation::sorted_queue_buffer.clear();
+  simulation::sort_keys.clear();
+  simulation::sorted_keys_buffer.clear();
 }
 
 void dispatch_xs_event(int64_t buffer_idx)
@@ -69,40 +97,204 @@ void process_init_events(int64_t n_particles, int64_t source_offset)
   simulation::time_event_init.stop();
 }
 
+uint64_t event_sort_key(const EventQueueItem& item)
+{
+  // Determine the bin of the logarithmic energy grid. For neutrons, this is
+  // the same bin that is used to bound the energy grid search in
+  // Nuclide::calculate_xs.
+  int type = static_cast<int>(item.type);
+  uint64_t n_bins = settings::n_log_bins + 1;
+  uint64_t i_log = 0;
+  if (settings::run_CE && type < data::energy_min.size() &&
+      item.E > data::energy_min[type] && data::energy_min[type] > 0.0) {
+    double x = std::log(item.E / data::energy_min[type]) /
+               simulation::log_spacing;
+    i_log = static_cast<uint64_t>(std::min(x, double(n_bins - 1)));
+  }
+
+  // Shift material indices by one so that void (-1) maps to zero
+  uint64_t n_mats = model::materials.size() + 1;
+  uint64_t i_mat = item.material + 1;
+
+  return (type * n_mats + i_mat) * n_bins + i_log;
+}
+
+void sort_xs_queue(SharedArray<EventQueueItem>& queue)
+{
+  int64_t n = queue.size();
+  if (n < 2)
+    return;
+
+  // Compute sort keys. The maximum key is used to skip passes over digits that
+  // are zero for every item in the queue.
+  uint64_t* keys_in = simulation::sort_keys.data();
+  uint64_t max_key = 0;
+#pragma omp parallel for schedule(static) reduction(max : max_key)
+  for (int64_t i = 0; i < n; i++) {
+    keys_in[i] = event_sort_key(queue[i]);
+    max_key = std::max(max_key, keys_in[i]);
+  }
+
+  // The queue is divided into one chunk per thread. For each digit, every
+  // chunk is histogrammed independently and an exclusive scan ordered by digit
+  // and then by chunk gives the position that each chunk scatters its items
+  // to. This keeps each pass stable, so the sorted order does not depend on
+  // the number of threads.
+  constexpr int RADIX_BITS = 8;
+  constexpr int RADIX_SIZE = 1 << RADIX_BITS;
+  int n_chunks = std::min<int64_t>(num_threads(), n);
+  vector<int64_t> offsets(n_chunks * RADIX_SIZE);
+
+  EventQueueItem* items_in = queue.data();
+  EventQueueItem* items_out = simulation::sorted_queue_buffer.data();
+  uint64_t* keys_out = simulation::sorted_keys_buffer.data();
+
+  for (int shift = 0; shift < 64 && (max_key >> shift) > 0;
+       shift += RADIX_BITS) {
+    std::fill(offsets.begin(), offsets.end(), 0);
+
+#pragma omp parallel for schedule(static)
+    for (int c = 0; c < n_chunks; c++) {
+      int64_t* count = &offsets[c * RADIX_SIZE];
+      for (int64_t i = n * c / n_chunks; i < n * (c + 1) / n_chunks; i++) {
+        ++count[(keys_in[i] >> shift) & (RADIX_SIZE - 1)];
+      }
+    }
+
+    int64_t total = 0;
+    for (int d = 0; d < RADIX_SIZE; d++) {
+      for (int c = 0; c < n_chunks; c++) {
+        int64_t count = offsets[c * RADIX_SIZE + d];
+        offsets[c * RADIX_SIZE + d] = total;
+        total += count;
+      }
+    }
+
+#pragma omp parallel for schedule(static)
+    for (int c = 0; c < n_chunks; c++) {
+      int64_t* offset = &offsets[c * RADIX_SIZE];
+      for (int64_t i = n * c / n_chunks; i < n * (c + 1) / n_chunks; i++) {
+        int64_t j = offset[(keys_in[i] >> shift) & (RADIX_SIZE - 1)]++;
+        items_out[j] = items_in[i];
+        keys_out[j] = keys_in[i];
+      }
+    }
+
+    std::swap(items_in, items_out);
+    std::swap(keys_in, keys_out);
+  }
+
+  // After an odd number of passes, the sorted items are in the scratch buffer
+  if (items_in != queue.data()) {
+    EventQueueItem* items = queue.data();
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < n; i++) {
+      items[i] = items_in[i];
+    }
+  }
+}
+
 void process_calculate_xs_events(SharedArray<EventQueueItem>& queue)
 {
   simulation::time_event_calculate_xs.start();
 
-  // TODO: If using C++17, perform a parallel sort of the queue
-  // by particle type, material type, and then energy, in order to
-  // improve cache locality and reduce thread divergence on GPU. Prior
-  // to C++17, std::sort is a serial only operation, which in this case
-  // makes it too slow to be practical for most test problems.
-  //
-  // std::sort(std::execution::par_unseq, queue.data(), queue.data() +
-  // queue.size());
+  // Sort the queue by particle type, material, and energy so that consecutive
+  // lookups hit the same regions of the nuclide energy grids. This is only
+  // beneficial when enough particles are in flight for each material to
+  // achieve consistent locality.
+  if (settings::sort_xs_queues) {
+    simulation::time_event_sort_xs.start();
+    sort_xs_queue(queue);
+    simulation::time_event_sort_xs.stop();
+  }
+
+  simulation::time_event_lookup_xs.start();
 
   int64_t offset = simulation::advance_particle_queue.size();
-  ;
 
+  if (settings::banked_xs_lookup && settings::run_CE) {
 #pragma omp parallel for schedule(runtime)
-  for (int64_t i = 0; i < queue.size(); i++) {
-    Particle* p = &simulation::particles[queue[i].idx];
-    p->event_calculate_xs();
+    for (int64_t i = 0; i < queue.size(); i++) {
+      int64_t buffer_idx = queue[i].idx;
+      Particle& p = simulation::particles[buffer_idx];
+
+      // Neutrons that need a lookup are deferred to the lookup bank, while
+      // other particle types are handled individually
+      if (p.event_calculate_xs_prepare()) {
+        if (p.type() == ParticleType::neutron) {
+          simulation::xs_lookup_bank.thread_safe_append({p, buffer_idx});
+        } else {
+          model::materials[p.material()]->calculate_xs(p);
+        }
+      }
+
+      simulation::advance_particle_queue[offset + i] = queue[i];
+    }
 
-    // After executing a calculate_xs event, particles will
-    // always require an advance event. Therefore, we don't need to use
-    // the protected enqueuing function.
-    simulation::advance_particle_queue[offset + i] = queue[i];
+    process_xs_lookup_bank();
+  } else {
+#pragma omp parallel for schedule(runtime)
+    for (int64_t i = 0; i < queue.size(); i++) {
+      Particle* p = &simulation::particles[queue[i].idx];
+      p->event_calculate_xs();
+
+      // After executing a calculate_xs event, particles will
+      // always require an advance event. Therefore, we don't need to use
+      // the protected enqueuing function.
+      simulation::advance_particle_queue[offset + i] = queue[i];
+    }
   }
 
   simulation::advance_particle_queue.resize(offset + queue.size());
 
   queue.resize(0);
 
+  simulation::time_event_lookup_xs.stop();
   simulation::time_event_calculate_xs.stop();
 }
 
+void process_xs_lookup_bank()
+{
+  auto& bank = simulation::xs_lookup_bank;
+  int64_t n = bank.size();
+
+  // Group neutrons in the same material together. Sorting also orders them by
+  // energy within each material, which improves locality in the grid search.
+  // The sort is timed along with the sorting of the queues rather than as
+  // part of the lookups.
+  simulation::time_event_lookup_xs.stop();
+  simulation::time_event_sort_xs.start();
+  sort_xs_queue(bank);
+  simulation::time_event_sort_xs.stop();
+  simulation::time_event_lookup_xs.start();
+
+  // Split the bank into groups of neutrons in the same material
+  vector<int64_t> group_start;
+  for (int64_t i = 0; i < n; i++) {
+    if (i == 0 || bank[i].material != bank[i - 1].material ||
+        i - group_start.back() == XS_LOOKUP_BANK_SIZE) {
+      group_start.push_back(i);
+    }
+  }
+  group_start.push_back(n);
+
+  int64_t n_groups = group_start.size() - 1;
+#pragma omp parallel for schedule(dynamic)
+  for (int64_t g = 0; g < n_groups; g++) {
+    array<Particle*, XS_LOOKUP_BANK_SIZE> group;
+    int64_t start = group_start[g];
+    int64_t n_group = group_start[g + 1] - start;
+    for (int64_t i = 0; i < n_group; i++) {
+      group[i] = &simulation::particles[bank[start + i].idx];
+    }
+    gsl::span<Particle*> group_span(group.data(), group.data() + n_group);
+    model::materials[bank[start].material]->calculate_neutron_xs_banked(
+      group_span);
+  }
+
+  bank.resize(0);
+}
+
 void process_advance_particle_events()
 {
   simulation::time_event_advance_particle.start();
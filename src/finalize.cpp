@@ -12,7 +12,9 @@
 #include "openmc/geometry_aux.h"
 #include "openmc/material.h"
 #include "openmc/mesh.h"
+#include "openmc/mesh_traversal.h"
 #include "openmc/message_passing.h"
+#include "openmc/node_shared.h"
 #include "openmc/nuclide.h"
 #include "openmc/photon.h"
 #include "openmc/plot.h"
@@ -43,6 +45,7 @@ void free_memory()
   free_memory_thermal();
   library_clear();
   nuclides_clear();
+  free_memory_node_shared();
   free_memory_source();
   free_memory_mesh();
   free_memory_tally();
@@ -74,13 +77,16 @@ int openmc_finalize()
 
   // Reset global variables
   settings::assume_separate = false;
+  settings::banked_xs_lookup = false;
   settings::check_overlaps = false;
+  settings::compact_source_sites = false;
   settings::confidence_intervals = false;
   settings::create_fission_neutrons = true;
   settings::create_delayed_neutrons = true;
   settings::electron_treatment = ElectronTreatment::LED;
   settings::delayed_photon_scaling = true;
   settings::energy_cutoff = {0.0, 1000.0, 0.0, 0.0};
+  settings::energy_grid_method = EnergyGridMethod::LOGARITHM;
   settings::time_cutoff = {INFTY, INFTY, INFTY, INFTY};
   settings::entropy_on = false;
   settings::event_based = false;
@@ -94,7 +100,11 @@ int openmc_finalize()
   settings::max_particle_events = 1000000;
   settings::max_splits = 1000;
   settings::max_tracks = 1000;
+  settings::track_compression = 0;
   settings::max_write_lost_particles = -1;
+  settings::neighbor_list_rays = 0;
+  settings::partitioner_type = PartitionerType::ZPLANE;
+  settings::universe_partitioners.clear();
   settings::n_log_bins = 8000;
   settings::n_inactive = 0;
   settings::n_particles = -1;
@@ -107,7 +117,9 @@ int openmc_finalize()
   settings::path_particle_restart.clear();
   settings::path_sourcepoint.clear();
   settings::path_statepoint.clear();
+  settings::path_xs_cache.clear();
   settings::photon_transport = false;
+  settings::private_tally_buffers = false;
   settings::reduce_tallies = true;
   settings::rel_max_lost_particles = 1.0e-6;
   settings::res_scat_on = false;
@@ -120,6 +132,9 @@ int openmc_finalize()
   settings::source_latest = false;
   settings::source_separate = false;
   settings::source_write = true;
+  settings::shared_nuclear_data = false;
+  settings::sort_xs_queues = false;
+  settings::statepoint_async = false;
   settings::survival_biasing = false;
   settings::temperature_default = 293.6;
   settings::temperature_method = TemperatureMethod::NEAREST;
@@ -134,6 +149,7 @@ int openmc_finalize()
   settings::verbosity = 7;
   settings::weight_cutoff = 0.25;
   settings::weight_survive = 1.0;
+  settings::tally_buffer_memory = 1024.0;
   settings::weight_windows_file.clear();
   settings::weight_windows_on = false;
   settings::write_all_tracks = false;
@@ -161,10 +177,16 @@ int openmc_finalize()
   settings::libmesh_init.reset();
 #endif
 
-  // Free all MPI types
+  // Free all MPI types and communicators
 #ifdef OPENMC_MPI
   if (mpi::source_site != MPI_DATATYPE_NULL)
     MPI_Type_free(&mpi::source_site);
+  if (mpi::node_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&mpi::node_comm);
+  if (mpi::leader_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&mpi::leader_comm);
+  if (mpi::bank_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&mpi::bank_comm);
 #endif
 
   return 0;
@@ -172,6 +194,8 @@ int openmc_finalize()
 
 int openmc_reset()
 {
+  // Results that are still being reduced belong to the tallies being reset
+  finish_tally_reduction();
 
   model::universe_cell_counts.clear();
   model::universe_level_counts.clear();
@@ -193,6 +217,8 @@ int openmc_reset()
   settings::cmfd_run = false;
 
   simulation::n_lost_particles = 0;
+  simulation::mesh_traversal_hits = 0;
+  simulation::mesh_traversal_misses = 0;
 
   return 0;
 }
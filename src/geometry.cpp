@@ -6,12 +6,16 @@
 #include "openmc/array.h"
 #include "openmc/cell.h"
 #include "openmc/constants.h"
+#include "openmc/distribution_multi.h"
 #include "openmc/error.h"
 #include "openmc/lattice.h"
+#include "openmc/random_lcg.h"
 #include "openmc/settings.h"
 #include "openmc/simulation.h"
+#include "openmc/source.h"
 #include "openmc/string_utils.h"
 #include "openmc/surface.h"
+#include "openmc/timer.h"
 
 namespace openmc {
 
@@ -450,6 +454,85 @@ BoundaryInfo distance_to_boundary(GeometryState& p)
   return info;
 }
 
+//==============================================================================
+
+namespace {
+
+//! Ray used to populate neighbor lists. Rays that cannot be located stop being
+//! traced rather than aborting the run.
+class NeighborListRay : public GeometryState {
+public:
+  using GeometryState::mark_as_lost;
+  void mark_as_lost(const char* message) override { lost_ = true; }
+
+  bool lost_ {false};
+};
+
+} // namespace
+
+void prepopulate_neighbor_lists()
+{
+  if (settings::neighbor_list_rays <= 0 || model::external_sources.empty())
+    return;
+
+  Timer timer;
+  timer.start();
+
+#pragma omp parallel
+  {
+    NeighborListRay p;
+
+#pragma omp for schedule(dynamic, 64)
+    for (int64_t i = 0; i < settings::neighbor_list_rays; ++i) {
+      // Start from a source site with an isotropic direction
+      uint64_t seed = init_seed(i, STREAM_TRACKING);
+      auto site = sample_external_source(&seed);
+      p.clear();
+      p.lost_ = false;
+      p.r() = site.r;
+      p.u() = isotropic_direction(&seed);
+      p.coord(0).universe = model::root_universe;
+      p.n_coord() = 1;
+      p.surface() = 0;
+      if (!exhaustive_find_cell(p))
+        continue;
+
+      // Trace the ray until it reaches a boundary condition, each surface
+      // crossing adding to the neighbor list of the cell being left
+      for (int j = 0; j < NEIGHBOR_LIST_MAX_CROSSINGS && !p.lost_; ++j) {
+        auto boundary = distance_to_boundary(p);
+        if (boundary.distance == INFINITY)
+          break;
+        for (int k = 0; k < p.n_coord(); ++k) {
+          p.coord(k).r += boundary.distance * p.coord(k).u;
+        }
+        p.surface() = boundary.surface_index;
+        p.n_coord() = boundary.coord_level;
+
+        if (boundary.lattice_translation[0] != 0 ||
+            boundary.lattice_translation[1] != 0 ||
+            boundary.lattice_translation[2] != 0) {
+          cross_lattice(p, boundary);
+          continue;
+        }
+
+        const auto& surf {*model::surfaces[std::abs(p.surface()) - 1]};
+        if (surf.bc_ || surf.geom_type_ == GeometryType::DAG)
+          break;
+        if (!neighbor_list_find_cell(p)) {
+          p.n_coord() = 1;
+          if (!exhaustive_find_cell(p))
+            break;
+        }
+      }
+    }
+  }
+
+  timer.stop();
+  write_message(6, "Populated neighbor lists with {} rays in {:.3f} s",
+    settings::neighbor_list_rays, timer.elapsed());
+}
+
 //==============================================================================
 // C API
 //==============================================================================
@@ -21,6 +21,8 @@
 #include "openmc/tallies/filter.h"
 #include "openmc/tallies/filter_cell_instance.h"
 #include "openmc/tallies/filter_distribcell.h"
+#include "openmc/timer.h"
+#include "openmc/universe.h"
 
 namespace openmc {
 
@@ -149,14 +151,30 @@ void adjust_indices()
 }
 
 //==============================================================================
-//! Partition some universes with many z-planes for faster find_cell searches.
+//! Partition universes with many cells for faster find_cell searches.
 
 void partition_universes()
 {
-  // Iterate over universes with more than 10 cells.  (Fewer than 10 is likely
-  // not worth partitioning.)
   for (const auto& univ : model::universes) {
-    if (univ->cells_.size() > 10) {
+    if (univ->geom_type() != GeometryType::CSG)
+      continue;
+
+    // Use the partitioner requested for this universe, if any. Otherwise,
+    // only partition universes with more than 10 cells.  (Fewer than 10 is
+    // likely not worth partitioning.)
+    PartitionerType type = settings::partitioner_type;
+    auto it = settings::universe_partitioners.find(univ->id_);
+    bool requested = (it != settings::universe_partitioners.end());
+    if (requested) {
+      type = it->second;
+    } else if (univ->cells_.size() <= 10) {
+      continue;
+    }
+
+    Timer timer;
+    timer.start();
+    std::string name;
+    if (type == PartitionerType::ZPLANE) {
       // Collect the set of surfaces in this universe.
       std::unordered_set<int32_t> surf_inds;
       for (auto i_cell : univ->cells_) {
@@ -169,14 +187,29 @@ void partition_universes()
       // 5 is likely not worth it.)
       int n_zplanes = 0;
       for (auto i_surf : surf_inds) {
-        if (dynamic_cast<const SurfaceZPlane*>(model::surfaces[i_surf].get())) {
+        if (dynamic_cast<const SurfaceZPlane*>(model::surfaces[i_surf].get()))
           ++n_zplanes;
-          if (n_zplanes > 5) {
-            univ->partitioner_ = make_unique<UniversePartitioner>(*univ);
-            break;
-          }
-        }
       }
+      if (n_zplanes > 5 || (requested && n_zplanes > 0)) {
+        univ->partitioner_ = make_unique<ZPlanePartitioner>(*univ);
+        name = "z-planes";
+      } else if (requested) {
+        warning(fmt::format("Universe {} has no z-planes to partition it with.",
+          univ->id_));
+      }
+    } else if (type == PartitionerType::OCTREE) {
+      auto octree = make_unique<OctreePartitioner>(*univ);
+      name = fmt::format("an octree with {} leaves", octree->n_leaves());
+      univ->partitioner_ = std::move(octree);
+    }
+    timer.stop();
+
+    if (univ->partitioner_) {
+      write_message(7,
+        "Partitioned universe {} with {} in {:.3f} s; {:.1f} of {} cells are "
+        "searched on average",
+        univ->id_, name, timer.elapsed(),
+        univ->partitioner_->average_candidates(), univ->cells_.size());
     }
   }
 }
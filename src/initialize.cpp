@@ -142,17 +142,36 @@ void initialize_mpi(MPI_Comm intracomm)
 {
   mpi::intracomm = intracomm;
 
-  // Initialize MPI
+  // Initialize MPI. Only the main thread makes MPI calls, but it does so
+  // while other threads are running when nuclear data is shared on a node.
   int flag;
   MPI_Initialized(&flag);
-  if (!flag)
-    MPI_Init(nullptr, nullptr);
+  if (!flag) {
+    int provided;
+    MPI_Init_thread(nullptr, nullptr, MPI_THREAD_FUNNELED, &provided);
+  }
 
   // Determine number of processes and rank for each
   MPI_Comm_size(intracomm, &mpi::n_procs);
   MPI_Comm_rank(intracomm, &mpi::rank);
   mpi::master = (mpi::rank == 0);
 
+  // Group processes by node. The first process on each node takes part in
+  // communication between nodes on behalf of the others. Ranks are used as
+  // keys so that the master process is the leader of its node and process 0
+  // among the leaders.
+  MPI_Comm_split_type(
+    intracomm, MPI_COMM_TYPE_SHARED, mpi::rank, MPI_INFO_NULL, &mpi::node_comm);
+  int node_rank;
+  MPI_Comm_rank(mpi::node_comm, &node_rank);
+  MPI_Comm_split(intracomm, node_rank == 0 ? 0 : MPI_UNDEFINED, mpi::rank,
+    &mpi::leader_comm);
+
+  // Source sites are exchanged on their own communicator so that messages
+  // received from any source can never be confused with other point-to-point
+  // messages, e.g., those sent to the master when writing state points
+  MPI_Comm_dup(intracomm, &mpi::bank_comm);
+
   // Create bank datatype
   SourceSite b;
   MPI_Aint disp[10];
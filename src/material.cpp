@@ -806,6 +806,94 @@ void Material::init_nuclide_index()
   }
 }
 
+void Material::init_union_grid()
+{
+  // Combine the energy grids of all nuclides at all temperatures
+  union_energy_.clear();
+  union_offset_.resize(nuclide_.size());
+  union_row_size_ = 0;
+  for (int i = 0; i < nuclide_.size(); ++i) {
+    const auto& nuc {data::nuclides[nuclide_[i]]};
+    union_offset_[i] = union_row_size_;
+    union_row_size_ += nuc->grid_.size();
+    for (const auto& grid : nuc->grid_) {
+      union_energy_.insert(
+        union_energy_.end(), grid.energy.begin(), grid.energy.end());
+    }
+  }
+  std::sort(union_energy_.begin(), union_energy_.end());
+  union_energy_.erase(std::unique(union_energy_.begin(), union_energy_.end()),
+    union_energy_.end());
+
+  if (union_energy_.size() < 2) {
+    union_energy_.clear();
+    return;
+  }
+
+  // For each union point, determine the lower bounding index on each nuclide
+  // grid. Since every nuclide point is also a union point, the index holds
+  // for any energy up to the next union point.
+  int n = union_energy_.size();
+  union_nuclide_index_.resize(static_cast<size_t>(n) * union_row_size_);
+  for (int i = 0; i < nuclide_.size(); ++i) {
+    const auto& nuc {data::nuclides[nuclide_[i]]};
+    for (int t = 0; t < nuc->grid_.size(); ++t) {
+      const auto& energy {nuc->grid_[t].energy};
+      int offset = union_offset_[i] + t;
+      int j = 0;
+      for (int u = 0; u < n; ++u) {
+        while (j + 2 < energy.size() && energy[j + 1] <= union_energy_[u]) {
+          ++j;
+        }
+        union_nuclide_index_[static_cast<size_t>(u) * union_row_size_ +
+                             offset] = j;
+      }
+    }
+  }
+
+  // Set up logarithmic grid for searching the union grid
+  union_log_index_ = log_grid_index(union_energy_);
+}
+
+void Material::update_union_grid()
+{
+  // The unionized grid stores grid indices for each nuclide of the material,
+  // so it is rebuilt whenever the nuclides change. Otherwise, lookups would
+  // index past the end of the rows for nuclides that were added.
+  if (settings::energy_grid_method == EnergyGridMethod::MATERIAL_UNION) {
+    this->init_union_grid();
+  } else {
+    union_energy_.clear();
+  }
+}
+
+size_t Material::union_grid_memory() const
+{
+  return union_energy_.size() * sizeof(double) +
+         (union_log_index_.size() + union_nuclide_index_.size() +
+           union_offset_.size()) *
+           sizeof(int);
+}
+
+const int* Material::union_grid_row(double E, int i_log_union) const
+{
+  if (union_energy_.empty())
+    return nullptr;
+
+  int u;
+  if (E < union_energy_.front()) {
+    u = 0;
+  } else if (E >= union_energy_.back()) {
+    u = union_energy_.size() - 1;
+  } else {
+    int i_low = union_log_index_[i_log_union];
+    int i_high = union_log_index_[i_log_union + 1] + 1;
+    u = i_low + lower_bound_index_branchless(
+                  &union_energy_[i_low], &union_energy_[i_high], E);
+  }
+  return &union_nuclide_index_[static_cast<size_t>(u) * union_row_size_];
+}
+
 void Material::calculate_xs(Particle& p) const
 {
   // Set all material macroscopic cross sections to zero
@@ -823,6 +911,9 @@ void Material::calculate_xs(Particle& p) const
 
 void Material::calculate_neutron_xs(Particle& p) const
 {
+  // Make room for the microscopic cross sections of this material's nuclides
+  p.set_neutron_xs_material(index_, nuclide_.size(), this->nuclide_index());
+
   // Find energy index on energy grid
   int neutron = static_cast<int>(ParticleType::neutron);
   int i_grid =
@@ -840,6 +931,9 @@ void Material::calculate_neutron_xs(Particle& p) const
     ncrystal_xs = ncrystal_mat_.xs(p);
   }
 
+  // Find nuclide grid indices on unionized grid, if present
+  const int* union_row = this->union_grid_row(p.E(), i_grid);
+
   // Add contribution from each nuclide in material
   for (int i = 0; i < nuclide_.size(); ++i) {
     // ======================================================================
@@ -878,7 +972,9 @@ void Material::calculate_neutron_xs(Particle& p) const
     int i_nuclide = nuclide_[i];
 
     // Update microscopic cross section for this nuclide
-    p.update_neutron_xs(i_nuclide, i_grid, i_sab, sab_frac, ncrystal_xs);
+    const int* i_union = union_row ? union_row + union_offset_[i] : nullptr;
+    p.update_neutron_xs(
+      i_nuclide, i_grid, i_sab, sab_frac, ncrystal_xs, i_union);
     auto& micro = p.neutron_xs(i_nuclide);
 
     // ======================================================================
@@ -895,6 +991,98 @@ void Material::calculate_neutron_xs(Particle& p) const
   }
 }
 
+void Material::calculate_neutron_xs_banked(gsl::span<Particle*> bank) const
+{
+  Expects(bank.size() <= XS_LOOKUP_BANK_SIZE);
+
+  array<int, XS_LOOKUP_BANK_SIZE> i_grid;
+  array<int, XS_LOOKUP_BANK_SIZE> i_sab;
+  array<double, XS_LOOKUP_BANK_SIZE> ncrystal_xs;
+  array<const int*, XS_LOOKUP_BANK_SIZE> union_row;
+  array<const int*, XS_LOOKUP_BANK_SIZE> i_union;
+  bool use_union = !union_energy_.empty();
+
+  int neutron = static_cast<int>(ParticleType::neutron);
+  for (int k = 0; k < bank.size(); ++k) {
+    Particle& p = *bank[k];
+    p.set_neutron_xs_material(index_, nuclide_.size(), this->nuclide_index());
+
+    // Set all material macroscopic cross sections to zero
+    p.macro_xs().total = 0.0;
+    p.macro_xs().absorption = 0.0;
+    p.macro_xs().fission = 0.0;
+    p.macro_xs().nu_fission = 0.0;
+
+    // Find energy index on energy grid
+    i_grid[k] =
+      std::log(p.E() / data::energy_min[neutron]) / simulation::log_spacing;
+
+    // Calculate NCrystal cross section
+    ncrystal_xs[k] = -1.0;
+    if (ncrystal_mat_ && p.E() < NCRYSTAL_MAX_ENERGY) {
+      ncrystal_xs[k] = ncrystal_mat_.xs(p);
+    }
+
+    // Find nuclide grid indices on unionized grid, if present
+    union_row[k] = this->union_grid_row(p.E(), i_grid[k]);
+  }
+
+  // Determine if this material has S(a,b) tables
+  bool check_sab = (thermal_tables_.size() > 0);
+
+  // Initialize position in i_sab_nuclides
+  int j = 0;
+
+  // Add contribution from each nuclide in material
+  for (int i = 0; i < nuclide_.size(); ++i) {
+    // Check if this nuclide matches one of the S(a,b) tables specified.
+    // This relies on thermal_tables_ being sorted by .index_nuclide
+    int i_table = C_NONE;
+    double sab_frac = 0.0;
+    if (check_sab) {
+      const auto& sab {thermal_tables_[j]};
+      if (i == sab.index_nuclide) {
+        i_table = sab.index_table;
+        sab_frac = sab.fraction;
+        ++j;
+        if (j == thermal_tables_.size())
+          check_sab = false;
+      }
+    }
+
+    // If particle energy is greater than the highest energy for the S(a,b)
+    // table, then don't use the S(a,b) table
+    for (int k = 0; k < bank.size(); ++k) {
+      i_sab[k] = i_table;
+      if (i_table != C_NONE &&
+          bank[k]->E() > data::thermal_scatt[i_table]->energy_max_)
+        i_sab[k] = C_NONE;
+    }
+
+    if (use_union) {
+      for (int k = 0; k < bank.size(); ++k) {
+        i_union[k] = union_row[k] + union_offset_[i];
+      }
+    }
+
+    // Update microscopic cross sections for this nuclide
+    int i_nuclide = nuclide_[i];
+    data::nuclides[i_nuclide]->calculate_xs_banked(i_sab.data(), i_grid.data(),
+      sab_frac, ncrystal_xs.data(), use_union ? i_union.data() : nullptr,
+      bank);
+
+    // Add contributions to macroscopic cross sections
+    double atom_density = atom_density_(i);
+    for (Particle* p : bank) {
+      const auto& micro = p->neutron_xs(i_nuclide);
+      p->macro_xs().total += atom_density * micro.total;
+      p->macro_xs().absorption += atom_density * micro.absorption;
+      p->macro_xs().fission += atom_density * micro.fission;
+      p->macro_xs().nu_fission += atom_density * micro.nu_fission;
+    }
+  }
+}
+
 void Material::calculate_photon_xs(Particle& p) const
 {
   p.macro_xs().coherent = 0.0;
@@ -1009,7 +1197,8 @@ void Material::set_densities(
   Expects(n > 0);
   Expects(n == density.size());
 
-  if (n != nuclide_.size()) {
+  bool nuclides_changed = (n != nuclide_.size());
+  if (nuclides_changed) {
     nuclide_.resize(n);
     atom_density_ = xt::zeros<double>({n});
     if (settings::photon_transport)
@@ -1025,7 +1214,10 @@ void Material::set_densities(
         throw std::runtime_error {openmc_err_msg};
     }
 
-    nuclide_[i] = data::nuclide_map.at(nuc);
+    int i_nuc = data::nuclide_map.at(nuc);
+    if (nuclide_[i] != i_nuc)
+      nuclides_changed = true;
+    nuclide_[i] = i_nuc;
     Expects(density[i] > 0.0);
     atom_density_(i) = density[i];
     sum_density += density[i];
@@ -1047,6 +1239,9 @@ void Material::set_densities(
 
   // Assign S(a,b) tables
   this->init_thermal();
+
+  if (nuclides_changed)
+    this->update_union_grid();
 }
 
 double Material::volume() const
@@ -1180,6 +1375,8 @@ void Material::add_nuclide(const std::string& name, double density)
   density_ += density;
   density_gpcc_ +=
     density * data::nuclides[i_nuc]->awr_ * MASS_NEUTRON / N_AVOGADRO;
+
+  this->update_union_grid();
 }
 
 //==============================================================================
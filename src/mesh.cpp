@@ -26,6 +26,7 @@
 #include "openmc/hdf5_interface.h"
 #include "openmc/material.h"
 #include "openmc/memory.h"
+#include "openmc/mesh_traversal.h"
 #include "openmc/message_passing.h"
 #include "openmc/openmp_interface.h"
 #include "openmc/particle_data.h"
@@ -141,6 +142,14 @@ void Mesh::set_id(int32_t id)
   model::mesh_map[id] = model::meshes.size() - 1;
 }
 
+void Mesh::bins_and_surfaces_crossed(Position r0, Position r1,
+  const Direction& u, FilterMatchVector<int>& bins,
+  FilterMatchVector<double>& lengths, FilterMatchVector<int>& surfaces) const
+{
+  bins_crossed(r0, r1, u, bins, lengths);
+  surface_bins_crossed(r0, r1, u, surfaces);
+}
+
 vector<double> Mesh::volumes() const
 {
   vector<double> volumes(n_bins());
@@ -357,7 +366,8 @@ std::string UnstructuredMesh::get_mesh_type() const
 }
 
 void UnstructuredMesh::surface_bins_crossed(
-  Position r0, Position r1, const Direction& u, vector<int>& bins) const
+  Position r0, Position r1, const Direction& u,
+  FilterMatchVector<int>& bins) const
 {
   fatal_error("Unstructured mesh surface tallies are not implemented.");
 }
@@ -693,15 +703,15 @@ void StructuredMesh::raytrace_mesh(
 }
 
 void StructuredMesh::bins_crossed(Position r0, Position r1, const Direction& u,
-  vector<int>& bins, vector<double>& lengths) const
+  FilterMatchVector<int>& bins, FilterMatchVector<double>& lengths) const
 {
 
   // Helper tally class.
   // stores a pointer to the mesh class and references to bins and lengths
   // parameters. Performs the actual tally through the track method.
   struct TrackAggregator {
-    TrackAggregator(
-      const StructuredMesh* _mesh, vector<int>& _bins, vector<double>& _lengths)
+    TrackAggregator(const StructuredMesh* _mesh,
+      FilterMatchVector<int>& _bins, FilterMatchVector<double>& _lengths)
       : mesh(_mesh), bins(_bins), lengths(_lengths)
     {}
     void surface(const MeshIndex& ijk, int k, bool max, bool inward) const {}
@@ -712,8 +722,8 @@ void StructuredMesh::bins_crossed(Position r0, Position r1, const Direction& u,
     }
 
     const StructuredMesh* mesh;
-    vector<int>& bins;
-    vector<double>& lengths;
+    FilterMatchVector<int>& bins;
+    FilterMatchVector<double>& lengths;
   };
 
   // Perform the mesh raytrace with the helper class.
@@ -721,14 +731,16 @@ void StructuredMesh::bins_crossed(Position r0, Position r1, const Direction& u,
 }
 
 void StructuredMesh::surface_bins_crossed(
-  Position r0, Position r1, const Direction& u, vector<int>& bins) const
+  Position r0, Position r1, const Direction& u,
+  FilterMatchVector<int>& bins) const
 {
 
   // Helper tally class.
   // stores a pointer to the mesh class and a reference to the bins parameter.
   // Performs the actual tally through the surface method.
   struct SurfaceAggregator {
-    SurfaceAggregator(const StructuredMesh* _mesh, vector<int>& _bins)
+    SurfaceAggregator(
+      const StructuredMesh* _mesh, FilterMatchVector<int>& _bins)
       : mesh(_mesh), bins(_bins)
     {}
     void surface(const MeshIndex& ijk, int k, bool max, bool inward) const
@@ -744,13 +756,261 @@ void StructuredMesh::surface_bins_crossed(
     void track(const MeshIndex& idx, double l) const {}
 
     const StructuredMesh* mesh;
-    vector<int>& bins;
+    FilterMatchVector<int>& bins;
   };
 
   // Perform the mesh raytrace with the helper class.
   raytrace_mesh(r0, r1, u, SurfaceAggregator(this, bins));
 }
 
+void StructuredMesh::bins_and_surfaces_crossed(Position r0, Position r1,
+  const Direction& u, FilterMatchVector<int>& bins,
+  FilterMatchVector<double>& lengths, FilterMatchVector<int>& surfaces) const
+{
+
+  // Helper tally class.
+  // Performs both the track and surface tallies of the helper classes above
+  // so that the mesh only has to be traced once.
+  struct TrackSurfaceAggregator {
+    void surface(const MeshIndex& ijk, int k, bool max, bool inward) const
+    {
+      int i_bin = 4 * mesh->n_dimension_ * mesh->get_bin_from_indices(ijk);
+      surfaces.push_back(i_bin + 4 * k + 2 * max + inward);
+    }
+    void track(const MeshIndex& ijk, double l) const
+    {
+      bins.push_back(mesh->get_bin_from_indices(ijk));
+      lengths.push_back(l);
+    }
+
+    const StructuredMesh* mesh;
+    FilterMatchVector<int>& bins;
+    FilterMatchVector<double>& lengths;
+    FilterMatchVector<int>& surfaces;
+  };
+
+  // Perform the mesh raytrace with the helper class.
+  raytrace_mesh(
+    r0, r1, u, TrackSurfaceAggregator {this, bins, lengths, surfaces});
+}
+
+//==============================================================================
+// Ray tracing through Cartesian grids
+//==============================================================================
+
+namespace {
+
+//! Helper tally class for Cartesian grids that stores the bins and lengths of
+//! a track
+struct GridTrackAggregator {
+  void surface(int bin, int k, bool max, bool inward) const {}
+  void track(int bin, double l) const
+  {
+    bins.push_back(bin);
+    lengths.push_back(l);
+  }
+
+  FilterMatchVector<int>& bins;
+  FilterMatchVector<double>& lengths;
+};
+
+//! Helper tally class for Cartesian grids that stores the surface bins
+//! crossed by a track
+struct GridSurfaceAggregator {
+  void surface(int bin, int k, bool max, bool inward) const
+  {
+    bins.push_back(4 * n_dimension * bin + 4 * k + 2 * max + inward);
+  }
+  void track(int bin, double l) const {}
+
+  int n_dimension;
+  FilterMatchVector<int>& bins;
+};
+
+//! Helper tally class for Cartesian grids that stores both the bins and
+//! lengths and the surface bins of a track
+struct GridTrackSurfaceAggregator {
+  void surface(int bin, int k, bool max, bool inward) const
+  {
+    surfaces.push_back(4 * n_dimension * bin + 4 * k + 2 * max + inward);
+  }
+  void track(int bin, double l) const
+  {
+    bins.push_back(bin);
+    lengths.push_back(l);
+  }
+
+  int n_dimension;
+  FilterMatchVector<int>& bins;
+  FilterMatchVector<double>& lengths;
+  FilterMatchVector<int>& surfaces;
+};
+
+//! Raytrace through a mesh whose elements are bounded by planes perpendicular
+//! to the coordinate axes with a 3D digital differential analyzer (Amanatides
+//! and Woo). Inside the mesh, the indices of the current element, the planes
+//! ahead of the track, and the flat bin are stepped along with each crossing
+//! without searching or virtual calls, and the grid is only searched when the
+//! track enters the mesh.
+//!
+//! Rather than accumulating the distances between planes, the distance to the
+//! plane after the next one along each axis is computed in advance from the
+//! starting position. This keeps the division off the path that selects the
+//! next crossing while giving exactly the crossings and lengths of
+//! StructuredMesh::raytrace_mesh.
+//
+//! \param[in] mesh Mesh to trace through
+//! \param[in] r0 Previous position of the particle
+//! \param[in] r1 Current position of the particle
+//! \param[in] u Particle direction
+//! \param[in] tally Functor that stores the tally data given flat bins
+template<class M, class T>
+void raytrace_grid(
+  const M& mesh, Position r0, Position r1, const Direction& u, T tally)
+{
+  using MeshIndex = StructuredMesh::MeshIndex;
+
+  double total_distance = (r1 - r0).norm();
+  if (total_distance == 0.0 && settings::solver_type != SolverType::RANDOM_RAY)
+    return;
+
+  const int n = mesh.n_dimension_;
+  const auto& shape = mesh.shape_;
+
+  // Coordinates along each axis, which are accessed with a varying axis
+  std::array<double, 3> x0 {r0.x, r0.y, r0.z};
+  std::array<double, 3> dir {u.x, u.y, u.z};
+
+  // Direction of the steps along each axis, which is zero when moving
+  // parallel to the grid planes, and the corresponding change in flat bin
+  std::array<int, 3> stride {1, shape[0], shape[0] * shape[1]};
+  std::array<int, 3> step {0, 0, 0};
+  std::array<int, 3> bin_step {0, 0, 0};
+  for (int k = 0; k < n; ++k) {
+    if (std::abs(dir[k]) >= FP_PRECISION)
+      step[k] = dir[k] > 0 ? 1 : -1;
+    bin_step[k] = step[k] * stride[k];
+  }
+
+  // Find the mesh indices of a position, the indices of the grid planes that
+  // the track crosses next, and the flat bin
+  MeshIndex ijk {1, 1, 1};
+  MeshIndex plane {1, 1, 1};
+  int bin = 0;
+  auto locate = [&](Position r) {
+    bool in_mesh = true;
+    bin = 0;
+    for (int k = 0; k < n; ++k) {
+      ijk[k] = mesh.M::get_index_in_direction(r[k], k);
+      plane[k] = step[k] < 0 ? ijk[k] - 1 : ijk[k];
+      if (ijk[k] < 1 || ijk[k] > shape[k])
+        in_mesh = false;
+      bin += (ijk[k] - 1) * stride[k];
+    }
+    return in_mesh;
+  };
+
+  // Distance from r0 to the next grid plane along an axis. Outside of the
+  // mesh, the distance is infinite when moving away from it.
+  auto distance = [&](int k) {
+    if ((step[k] > 0 && ijk[k] <= shape[k]) || (step[k] < 0 && ijk[k] >= 1))
+      return (mesh.M::positive_grid_boundary(plane, k) - x0[k]) / dir[k];
+    return INFTY;
+  };
+
+  // Distance from r0 to the grid plane with index j along an axis, which is
+  // infinite past the outer planes
+  auto plane_distance = [&](int k, int j) {
+    if (j < 0 || j > shape[k])
+      return INFTY;
+    MeshIndex p = plane;
+    p[k] = j;
+    return (mesh.M::positive_grid_boundary(p, k) - x0[k]) / dir[k];
+  };
+
+  // Offset the starting position a tiny bit in the direction of flight
+  bool in_mesh = locate(r0 + TINY_BIT * u);
+
+  // if track is very short, assume that it is completely inside one cell
+  if (total_distance < 2 * TINY_BIT) {
+    if (in_mesh) {
+      tally.track(bin, 1.0);
+    }
+    return;
+  }
+
+  // Distances to the next plane and to the one after it along each axis
+  std::array<double, 3> distances {INFTY, INFTY, INFTY};
+  std::array<double, 3> distances_ahead {INFTY, INFTY, INFTY};
+  for (int k = 0; k < n; ++k) {
+    distances[k] = distance(k);
+    if (step[k] != 0)
+      distances_ahead[k] = plane_distance(k, plane[k] + step[k]);
+  }
+
+  double traveled_distance {0.0};
+  while (true) {
+    if (in_mesh) {
+      // Find the nearest plane, taking the first axis in case of ties
+      int k = 0;
+      if (distances[1] < distances[k])
+        k = 1;
+      if (distances[2] < distances[k])
+        k = 2;
+
+      tally.track(bin,
+        (std::min(distances[k], total_distance) - traveled_distance) /
+          total_distance);
+
+      traveled_distance = distances[k];
+      if (traveled_distance >= total_distance)
+        return;
+
+      // Step into the neighboring element along the axis. The distances to
+      // the planes along the other axes remain valid. Once the track has left
+      // the convex mesh, it cannot enter it again.
+      bool max = step[k] > 0;
+      tally.surface(bin, k, max, false);
+      ijk[k] += step[k];
+      plane[k] += step[k];
+      bin += bin_step[k];
+      if (ijk[k] < 1 || ijk[k] > shape[k])
+        return;
+
+      distances[k] = distances_ahead[k];
+      distances_ahead[k] = plane_distance(k, plane[k] + step[k]);
+      tally.surface(bin, k, !max, true);
+
+    } else {
+      // Travel to the plane that is farthest away along the axes on which the
+      // track is outside of the mesh, as only it crosses all outer planes
+      int k_max {0};
+      for (int k = 0; k < n; ++k) {
+        if ((ijk[k] < 1 || ijk[k] > shape[k]) &&
+            (distances[k] > traveled_distance)) {
+          traveled_distance = distances[k];
+          k_max = k;
+        }
+      }
+
+      if (traveled_distance >= total_distance)
+        return;
+
+      in_mesh = locate(r0 + (traveled_distance + TINY_BIT) * u);
+      for (int k = 0; k < n; ++k) {
+        distances[k] = distance(k);
+        if (step[k] != 0)
+          distances_ahead[k] = plane_distance(k, plane[k] + step[k]);
+      }
+
+      if (in_mesh)
+        tally.surface(bin, k_max, step[k_max] < 0, true);
+    }
+  }
+}
+
+} // namespace
+
 //==============================================================================
 // RegularMesh implementation
 //==============================================================================
@@ -848,6 +1108,26 @@ int RegularMesh::get_index_in_direction(double r, int i) const
   return std::ceil((r - lower_left_[i]) / width_[i]);
 }
 
+void RegularMesh::bins_crossed(Position r0, Position r1, const Direction& u,
+  FilterMatchVector<int>& bins, FilterMatchVector<double>& lengths) const
+{
+  raytrace_grid(*this, r0, r1, u, GridTrackAggregator {bins, lengths});
+}
+
+void RegularMesh::surface_bins_crossed(Position r0, Position r1,
+  const Direction& u, FilterMatchVector<int>& bins) const
+{
+  raytrace_grid(*this, r0, r1, u, GridSurfaceAggregator {n_dimension_, bins});
+}
+
+void RegularMesh::bins_and_surfaces_crossed(Position r0, Position r1,
+  const Direction& u, FilterMatchVector<int>& bins,
+  FilterMatchVector<double>& lengths, FilterMatchVector<int>& surfaces) const
+{
+  raytrace_grid(*this, r0, r1, u,
+    GridTrackSurfaceAggregator {n_dimension_, bins, lengths, surfaces});
+}
+
 const std::string RegularMesh::mesh_type = "regular";
 
 std::string RegularMesh::get_mesh_type() const
@@ -1086,6 +1366,27 @@ int RectilinearMesh::get_index_in_direction(double r, int i) const
   return lower_bound_index(grid_[i].begin(), grid_[i].end(), r) + 1;
 }
 
+void RectilinearMesh::bins_crossed(Position r0, Position r1,
+  const Direction& u, FilterMatchVector<int>& bins,
+  FilterMatchVector<double>& lengths) const
+{
+  raytrace_grid(*this, r0, r1, u, GridTrackAggregator {bins, lengths});
+}
+
+void RectilinearMesh::surface_bins_crossed(Position r0, Position r1,
+  const Direction& u, FilterMatchVector<int>& bins) const
+{
+  raytrace_grid(*this, r0, r1, u, GridSurfaceAggregator {n_dimension_, bins});
+}
+
+void RectilinearMesh::bins_and_surfaces_crossed(Position r0, Position r1,
+  const Direction& u, FilterMatchVector<int>& bins,
+  FilterMatchVector<double>& lengths, FilterMatchVector<int>& surfaces) const
+{
+  raytrace_grid(*this, r0, r1, u,
+    GridTrackSurfaceAggregator {n_dimension_, bins, lengths, surfaces});
+}
+
 std::pair<vector<double>, vector<double>> RectilinearMesh::plot(
   Position plot_ll, Position plot_ur) const
 {
@@ -2362,7 +2663,7 @@ void MOABMesh::intersect_track(const moab::CartVect& start,
 }
 
 void MOABMesh::bins_crossed(Position r0, Position r1, const Direction& u,
-  vector<int>& bins, vector<double>& lengths) const
+  FilterMatchVector<int>& bins, FilterMatchVector<double>& lengths) const
 {
   moab::CartVect start(r0.x, r0.y, r0.z);
   moab::CartVect end(r1.x, r1.y, r1.z);
@@ -3099,7 +3400,7 @@ void LibMesh::write(const std::string& filename) const
 }
 
 void LibMesh::bins_crossed(Position r0, Position r1, const Direction& u,
-  vector<int>& bins, vector<double>& lengths) const
+  FilterMatchVector<int>& bins, FilterMatchVector<double>& lengths) const
 {
   // TODO: Implement triangle crossings here
   fatal_error("Tracklength tallies on libMesh instances are not implemented.");
@@ -3241,6 +3542,8 @@ void free_memory_mesh()
 {
   model::meshes.clear();
   model::mesh_map.clear();
+  model::cached_meshes.clear();
+  model::mesh_traversal_slots.clear();
 }
 
 extern "C" int n_meshes()
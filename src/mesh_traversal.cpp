@@ -0,0 +1,219 @@
+#include "openmc/mesh_traversal.h"
+
+#include <array>
+#include <set>
+#include <utility> // for pair
+
+#include "openmc/constants.h"
+#include "openmc/mesh.h"
+#include "openmc/settings.h"
+#include "openmc/tallies/filter.h"
+#include "openmc/tallies/filter_mesh.h"
+#include "openmc/tallies/tally.h"
+#include "openmc/weight_windows.h"
+
+namespace openmc {
+
+//==============================================================================
+// Global variables
+//==============================================================================
+
+namespace model {
+
+vector<MeshTraversalUse> cached_meshes;
+vector<int> mesh_traversal_slots;
+
+} // namespace model
+
+namespace simulation {
+
+int64_t mesh_traversal_hits {0};
+int64_t mesh_traversal_misses {0};
+
+} // namespace simulation
+
+namespace {
+
+//! Get the slot of a mesh in the traversal caches
+int mesh_traversal_slot(int32_t mesh)
+{
+  return mesh < model::mesh_traversal_slots.size()
+           ? model::mesh_traversal_slots[mesh]
+           : C_NONE;
+}
+
+} // namespace
+
+//==============================================================================
+// MeshTraversalCache implementation
+//==============================================================================
+
+void MeshTraversalCache::bins_crossed(int32_t mesh, Position r0, Position r1,
+  const Direction& u, FilterMatchVector<int>& bins,
+  FilterMatchVector<double>& lengths)
+{
+  int slot = mesh_traversal_slot(mesh);
+  if (slot == C_NONE || !model::cached_meshes[slot].tracks) {
+    model::meshes[mesh]->bins_crossed(r0, r1, u, bins, lengths);
+    return;
+  }
+
+  const auto& entry = traverse(slot, r0, r1, u, true, false);
+  for (auto bin : entry.bins)
+    bins.push_back(bin);
+  for (auto length : entry.lengths)
+    lengths.push_back(length);
+}
+
+void MeshTraversalCache::surface_bins_crossed(int32_t mesh, Position r0,
+  Position r1, const Direction& u, FilterMatchVector<int>& bins)
+{
+  int slot = mesh_traversal_slot(mesh);
+  if (slot == C_NONE || !model::cached_meshes[slot].surfaces) {
+    model::meshes[mesh]->surface_bins_crossed(r0, r1, u, bins);
+    return;
+  }
+
+  const auto& entry = traverse(slot, r0, r1, u, false, true);
+  for (auto bin : entry.surfaces)
+    bins.push_back(bin);
+}
+
+int MeshTraversalCache::get_bin(int32_t mesh, Position r)
+{
+  int slot = mesh_traversal_slot(mesh);
+  if (slot == C_NONE || !model::cached_meshes[slot].points) {
+    return model::meshes[mesh]->get_bin(r);
+  }
+
+  if (entries_.size() <= slot)
+    entries_.resize(model::cached_meshes.size());
+  auto& entry = entries_[slot];
+  if (entry.located && entry.r == r) {
+    ++n_hits_;
+    return entry.bin;
+  }
+
+  ++n_misses_;
+  entry.r = r;
+  entry.bin = model::meshes[mesh]->get_bin(r);
+  entry.located = true;
+  return entry.bin;
+}
+
+const MeshTraversalCache::Entry& MeshTraversalCache::traverse(int slot,
+  Position r0, Position r1, const Direction& u, bool tracks, bool surfaces)
+{
+  if (entries_.size() <= slot)
+    entries_.resize(model::cached_meshes.size());
+  auto& entry = entries_[slot];
+  if ((entry.has_tracks || !tracks) && (entry.has_surfaces || !surfaces) &&
+      entry.r0 == r0 && entry.r1 == r1 && entry.u == u) {
+    ++n_hits_;
+    return entry;
+  }
+
+  // Trace the segment once for everything that is cached for the mesh. The
+  // results are collected in the filter match arena, which is reset after the
+  // tally event, and kept in the entry.
+  ++n_misses_;
+  const auto& use = model::cached_meshes[slot];
+  const auto& mesh = *model::meshes[use.mesh];
+  FilterMatchVector<int> bins;
+  FilterMatchVector<double> lengths;
+  FilterMatchVector<int> surface_bins;
+  if (use.tracks && use.surfaces) {
+    mesh.bins_and_surfaces_crossed(r0, r1, u, bins, lengths, surface_bins);
+  } else if (use.tracks) {
+    mesh.bins_crossed(r0, r1, u, bins, lengths);
+  } else {
+    mesh.surface_bins_crossed(r0, r1, u, surface_bins);
+  }
+
+  entry.r0 = r0;
+  entry.r1 = r1;
+  entry.u = u;
+  entry.has_tracks = use.tracks;
+  entry.has_surfaces = use.surfaces;
+  entry.bins.assign(bins.begin(), bins.end());
+  entry.lengths.assign(lengths.begin(), lengths.end());
+  entry.surfaces.assign(surface_bins.begin(), surface_bins.end());
+  return entry;
+}
+
+void MeshTraversalCache::clear()
+{
+  for (auto& entry : entries_) {
+    entry.has_tracks = false;
+    entry.has_surfaces = false;
+    entry.located = false;
+  }
+}
+
+void MeshTraversalCache::accumulate()
+{
+  if (n_hits_ == 0 && n_misses_ == 0)
+    return;
+
+#pragma omp atomic
+  simulation::mesh_traversal_hits += n_hits_;
+#pragma omp atomic
+  simulation::mesh_traversal_misses += n_misses_;
+  n_hits_ = 0;
+  n_misses_ = 0;
+}
+
+//==============================================================================
+// Non-member functions
+//==============================================================================
+
+void prepare_mesh_traversal_caches()
+{
+  enum Lookup { TRACKS, SURFACES, POINTS };
+
+  // Find the lookups made by mesh filters. A filter that is used by several
+  // tallies only finds its bins once per event, so each filter is counted
+  // once for each kind of lookup that it makes.
+  std::set<std::pair<int32_t, int>> filter_lookups;
+  for (const auto& t : model::tallies) {
+    for (auto i_filter : t->filters()) {
+      const auto& filter = model::tally_filters[i_filter];
+      if (filter->type() == FilterType::MESH_SURFACE) {
+        filter_lookups.emplace(i_filter, SURFACES);
+      } else if (filter->type() == FilterType::MESH) {
+        filter_lookups.emplace(i_filter,
+          t->estimator_ == TallyEstimator::TRACKLENGTH ? TRACKS : POINTS);
+      }
+    }
+  }
+
+  // Count the consumers of each kind of lookup of each mesh
+  vector<std::array<int, 3>> n_lookups(model::meshes.size());
+  for (const auto& lookup : filter_lookups) {
+    const auto* filter =
+      dynamic_cast<MeshFilter*>(model::tally_filters[lookup.first].get());
+    ++n_lookups[filter->mesh()][lookup.second];
+  }
+  if (settings::weight_windows_on) {
+    for (const auto& ww : variance_reduction::weight_windows) {
+      ++n_lookups[model::mesh_map.at(ww->mesh()->id())][POINTS];
+    }
+  }
+
+  // Segments are cached if both kinds of segment lookups together have more
+  // than one consumer, since a single traversal serves both of them
+  model::cached_meshes.clear();
+  model::mesh_traversal_slots.assign(model::meshes.size(), C_NONE);
+  for (int32_t i = 0; i < model::meshes.size(); ++i) {
+    const auto& n = n_lookups[i];
+    bool segments = n[TRACKS] + n[SURFACES] > 1;
+    MeshTraversalUse use {
+      i, segments && n[TRACKS] > 0, segments && n[SURFACES] > 0, n[POINTS] > 1};
+    if (use.tracks || use.surfaces || use.points) {
+      model::mesh_traversal_slots[i] = model::cached_meshes.size();
+      model::cached_meshes.push_back(use);
+    }
+  }
+}
+
+} // namespace openmc
@@ -9,6 +9,9 @@ bool master {true};
 
 #ifdef OPENMC_MPI
 MPI_Comm intracomm {MPI_COMM_NULL};
+MPI_Comm node_comm {MPI_COMM_NULL};
+MPI_Comm leader_comm {MPI_COMM_NULL};
+MPI_Comm bank_comm {MPI_COMM_NULL};
 MPI_Datatype source_site {MPI_DATATYPE_NULL};
 #endif
 
@@ -0,0 +1,131 @@
+#include "openmc/node_shared.h"
+
+#include "openmc/constants.h"
+#include "openmc/message_passing.h"
+
+#include <algorithm> // for max
+#include <cstdint>   // for uintptr_t
+
+namespace openmc {
+
+namespace {
+
+//! Block of memory shared by all processes on a node, from which arrays are
+//! allocated in order
+struct NodeSharedBlock {
+#ifdef OPENMC_MPI
+  MPI_Win win; //!< Window exposing the block
+#endif
+  char* base;  //!< Start of the block
+  size_t size; //!< Size of the block in [bytes]
+  size_t used; //!< Number of bytes allocated from the block
+};
+
+vector<NodeSharedBlock> blocks;
+
+} // namespace
+
+//==============================================================================
+// Non-member functions
+//==============================================================================
+
+void* node_shared_allocate(size_t bytes)
+{
+#ifdef OPENMC_MPI
+  int node_size;
+  MPI_Comm_size(mpi::node_comm, &node_size);
+  if (node_size == 1)
+    return nullptr;
+
+  // Round up so that every array starts on an aligned boundary
+  bytes = (bytes + NODE_SHARED_ALIGNMENT - 1) / NODE_SHARED_ALIGNMENT *
+          NODE_SHARED_ALIGNMENT;
+
+  // Since all processes on the node request the same sizes, they all decide
+  // to allocate a new block at the same time. The memory of each block is
+  // held by the first process on the node.
+  if (blocks.empty() || blocks.back().used + bytes > blocks.back().size) {
+    NodeSharedBlock block;
+    block.size =
+      std::max(bytes, NODE_SHARED_BLOCK_SIZE) + NODE_SHARED_ALIGNMENT;
+
+    MPI_Aint local_size = node_shared_writer() ? block.size : 0;
+    void* base;
+    MPI_Win_allocate_shared(
+      local_size, 1, MPI_INFO_NULL, mpi::node_comm, &base, &block.win);
+    MPI_Aint size;
+    int disp_unit;
+    MPI_Win_shared_query(block.win, 0, &size, &disp_unit, &base);
+    block.base = static_cast<char*>(base);
+
+    // Skip to the first aligned address as seen by the writer so that all
+    // processes use the same offsets into the block
+    uint64_t offset =
+      (NODE_SHARED_ALIGNMENT -
+        reinterpret_cast<std::uintptr_t>(base) % NODE_SHARED_ALIGNMENT) %
+      NODE_SHARED_ALIGNMENT;
+    MPI_Bcast(&offset, 1, MPI_UINT64_T, 0, mpi::node_comm);
+    block.used = offset;
+
+    // Keep a passive target epoch open so that node_shared_fence() can
+    // synchronize the memory
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, block.win);
+    blocks.push_back(block);
+  }
+
+  auto& block = blocks.back();
+  void* p = block.base + block.used;
+  block.used += bytes;
+  return p;
+#else
+  return nullptr;
+#endif
+}
+
+bool node_shared_writer()
+{
+#ifdef OPENMC_MPI
+  int node_rank;
+  MPI_Comm_rank(mpi::node_comm, &node_rank);
+  return node_rank == 0;
+#else
+  return true;
+#endif
+}
+
+void node_shared_fence()
+{
+#ifdef OPENMC_MPI
+  if (blocks.empty())
+    return;
+  for (auto& block : blocks) {
+    MPI_Win_sync(block.win);
+  }
+  MPI_Barrier(mpi::node_comm);
+  for (auto& block : blocks) {
+    MPI_Win_sync(block.win);
+  }
+#endif
+}
+
+size_t node_shared_memory()
+{
+  size_t n = 0;
+  for (const auto& block : blocks) {
+    n += block.used;
+  }
+  return n;
+}
+
+void free_memory_node_shared()
+{
+#ifdef OPENMC_MPI
+  for (auto& block : blocks) {
+    MPI_Win_unlock_all(block.win);
+    MPI_Win_free(&block.win);
+  }
+#endif
+  blocks.clear();
+}
+
+} // namespace openmc
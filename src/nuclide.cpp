@@ -14,6 +14,7 @@
 #include "openmc/simulation.h"
 #include "openmc/string_utils.h"
 #include "openmc/thermal.h"
+#include "openmc/xs_cache.h"
 
 #include <fmt/core.h>
 
@@ -77,16 +78,13 @@ Nuclide::Nuclide(hid_t group, const vector<double>& temperature)
   }
   std::sort(temps_available.begin(), temps_available.end());
 
-  // If only one temperature is available, revert to nearest temperature
-  if (temps_available.size() == 1 &&
-      settings::temperature_method == TemperatureMethod::INTERPOLATION) {
-    if (mpi::master) {
-      warning("Cross sections for " + name_ +
-              " are only available at one "
-              "temperature. Reverting to nearest temperature method.");
-    }
-    settings::temperature_method = TemperatureMethod::NEAREST;
-  }
+  // If only one temperature is available, the nearest temperature is used.
+  // The global temperature method is reverted by revert_temperature_method()
+  // since other threads may be using the settings while nuclides are read.
+  auto temperature_method = settings::temperature_method;
+  single_temperature_ = temps_available.size() == 1;
+  if (single_temperature_)
+    temperature_method = TemperatureMethod::NEAREST;
 
   // Determine actual temperatures to read -- start by checking whether a
   // temperature range was given (indicated by T_max > 0), in which case all
@@ -115,7 +113,7 @@ Nuclide::Nuclide(hid_t group, const vector<double>& temperature)
     }
   }
 
-  switch (settings::temperature_method) {
+  switch (temperature_method) {
   case TemperatureMethod::NEAREST:
     // Find nearest temperatures
     for (double T_desired : temperature) {
@@ -205,20 +203,59 @@ Nuclide::Nuclide(hid_t group, const vector<double>& temperature)
   data::temperature_max =
     std::max(data::temperature_max, static_cast<double>(temps_to_read.back()));
 
-  hid_t energy_group = open_group(group, "energy");
+  // Determine exact kT values
   for (const auto& T : temps_to_read) {
     std::string dset {std::to_string(T) + "K"};
-
-    // Determine exact kT values
     double kT;
     read_dataset(kT_group, dset.c_str(), kT);
     kTs_.push_back(kT);
+  }
+  close_group(kT_group);
+
+  // Read the remaining data from the cross section cache if it holds a valid
+  // entry for these temperatures, and from HDF5 otherwise. Warnings about the
+  // data are only shown when they are read from HDF5.
+  unique_ptr<XsCacheEntry> entry;
+  CacheReader cache;
+  if (!settings::path_xs_cache.empty()) {
+    try {
+      entry = make_unique<XsCacheEntry>(group, temps_to_read);
+    } catch (const std::runtime_error& e) {
+      warning(fmt::format(
+        "Could not use the cross section cache for {}: {}", name_, e.what()));
+    }
+  }
+  if (entry && entry->load(cache)) {
+    write_message(7, "Reading {} from {}", name_, entry->path());
+    this->deserialize(cache);
+  } else {
+    this->read_data(group, temps_to_read);
+    if (entry && mpi::master) {
+      try {
+        CacheWriter writer;
+        this->serialize(writer);
+        entry->store(writer);
+        write_message(7, "Wrote {} to {}", name_, entry->path());
+      } catch (const std::runtime_error& e) {
+        warning(fmt::format(
+          "Could not add {} to the cross section cache: {}", name_, e.what()));
+      }
+    }
+  }
+}
+
+void Nuclide::read_data(hid_t group, const vector<int>& temps_to_read)
+{
+  hid_t energy_group = open_group(group, "energy");
+  for (const auto& T : temps_to_read) {
+    std::string dset {std::to_string(T) + "K"};
 
     // Read energy grid
+    vector<double> energy;
+    read_dataset(energy_group, dset.c_str(), energy);
     grid_.emplace_back();
-    read_dataset(energy_group, dset.c_str(), grid_.back().energy);
+    grid_.back().energy = std::move(energy);
   }
-  close_group(kT_group);
 
   // Check for 0K energy grid
   if (object_exists(energy_group, "0K")) {
@@ -329,8 +366,69 @@ Nuclide::Nuclide(hid_t group, const vector<double>& temperature)
     delayed_photons_ = read_function(fer_group, "delayed_photons");
     close_group(fer_group);
   }
+}
+
+void Nuclide::serialize(CacheWriter& cache) const
+{
+  cache.write(grid_.size());
+  for (const auto& grid : grid_) {
+    cache.write(grid.energy);
+  }
+  cache.write(energy_0K_);
+  cache.write(elastic_0K_);
 
-  this->create_derived(prompt_photons_.get(), delayed_photons_.get());
+  cache.write(reactions_.size());
+  for (const auto& rx : reactions_) {
+    rx->serialize(cache);
+  }
+  cache.write(index_inelastic_scatter_);
+
+  cache.write(urr_present_);
+  cache.write(urr_inelastic_);
+  cache.write(urr_data_.size());
+  for (const auto& urr : urr_data_) {
+    urr.serialize(cache);
+  }
+
+  write_function(cache, total_nu_.get());
+  write_function(cache, fission_q_prompt_.get());
+  write_function(cache, fission_q_recov_.get());
+  write_function(cache, fragments_.get());
+  write_function(cache, betas_.get());
+  write_function(cache, prompt_photons_.get());
+  write_function(cache, delayed_photons_.get());
+}
+
+void Nuclide::deserialize(CacheReader& cache)
+{
+  auto n = cache.read<size_t>();
+  for (size_t i = 0; i < n; ++i) {
+    grid_.emplace_back();
+    cache.read(grid_.back().energy);
+  }
+  cache.read(energy_0K_);
+  cache.read(elastic_0K_);
+
+  n = cache.read<size_t>();
+  for (size_t i = 0; i < n; ++i) {
+    reactions_.push_back(make_unique<Reaction>(cache));
+  }
+  cache.read(index_inelastic_scatter_);
+
+  cache.read(urr_present_);
+  cache.read(urr_inelastic_);
+  n = cache.read<size_t>();
+  for (size_t i = 0; i < n; ++i) {
+    urr_data_.emplace_back(cache);
+  }
+
+  total_nu_ = read_function(cache);
+  fission_q_prompt_ = read_function(cache);
+  fission_q_recov_ = read_function(cache);
+  fragments_ = read_function(cache);
+  betas_ = read_function(cache);
+  prompt_photons_ = read_function(cache);
+  delayed_photons_ = read_function(cache);
 }
 
 Nuclide::~Nuclide()
@@ -338,13 +436,18 @@ Nuclide::~Nuclide()
   data::nuclide_map.erase(name_);
 }
 
-void Nuclide::create_derived(
-  const Function1D* prompt_photons, const Function1D* delayed_photons)
+void Nuclide::create_derived()
 {
+  // Only the basic properties of the nuclide are read for volume calculations
+  if (settings::run_mode == RunMode::VOLUME)
+    return;
+
+  // Cross sections are summed in tensors that are copied to xs_ at the end
+  vector<xt::xtensor<double, 2>> nuc_xs;
   for (const auto& grid : grid_) {
     // Allocate and initialize cross section
     array<size_t, 2> shape {grid.energy.size(), 5};
-    xs_.emplace_back(shape, 0.0);
+    nuc_xs.emplace_back(shape, 0.0);
   }
 
   reaction_index_.fill(C_NONE);
@@ -357,11 +460,14 @@ void Nuclide::create_derived(
     for (int t = 0; t < kTs_.size(); ++t) {
       int j = rx->xs_[t].threshold;
       int n = rx->xs_[t].value.size();
-      auto xs = xt::adapt(rx->xs_[t].value);
+      vector<size_t> shape {static_cast<size_t>(n)};
+      auto xs =
+        xt::adapt(rx->xs_[t].value.data(), n, xt::no_ownership(), shape);
 
       for (const auto& p : rx->products_) {
         if (p.particle_ == ParticleType::photon) {
-          auto pprod = xt::view(xs_[t], xt::range(j, j + n), XS_PHOTON_PROD);
+          auto pprod =
+            xt::view(nuc_xs[t], xt::range(j, j + n), XS_PHOTON_PROD);
           for (int k = 0; k < n; ++k) {
             double E = grid_[t].energy[k + j];
 
@@ -370,9 +476,9 @@ void Nuclide::create_derived(
             double f = 1.0;
             if (settings::delayed_photon_scaling) {
               if (is_fission(rx->mt_)) {
-                if (prompt_photons && delayed_photons) {
-                  double energy_prompt = (*prompt_photons)(E);
-                  double energy_delayed = (*delayed_photons)(E);
+                if (prompt_photons_ && delayed_photons_) {
+                  double energy_prompt = (*prompt_photons_)(E);
+                  double energy_delayed = (*delayed_photons_)(E);
                   f = (energy_prompt + energy_delayed) / (energy_prompt);
                 }
               }
@@ -388,18 +494,19 @@ void Nuclide::create_derived(
         continue;
 
       // Add contribution to total cross section
-      auto total = xt::view(xs_[t], xt::range(j, j + n), XS_TOTAL);
+      auto total = xt::view(nuc_xs[t], xt::range(j, j + n), XS_TOTAL);
       total += xs;
 
       // Add contribution to absorption cross section
-      auto absorption = xt::view(xs_[t], xt::range(j, j + n), XS_ABSORPTION);
+      auto absorption =
+        xt::view(nuc_xs[t], xt::range(j, j + n), XS_ABSORPTION);
       if (is_disappearance(rx->mt_)) {
         absorption += xs;
       }
 
       if (is_fission(rx->mt_)) {
         fissionable_ = true;
-        auto fission = xt::view(xs_[t], xt::range(j, j + n), XS_FISSION);
+        auto fission = xt::view(nuc_xs[t], xt::range(j, j + n), XS_FISSION);
         fission += xs;
         absorption += xs;
 
@@ -428,10 +535,11 @@ void Nuclide::create_derived(
       int n = grid_[t].energy.size();
       for (int i = 0; i < n; ++i) {
         double E = grid_[t].energy[i];
-        xs_[t](i, XS_NU_FISSION) =
-          nu(E, EmissionMode::total) * xs_[t](i, XS_FISSION);
+        nuc_xs[t](i, XS_NU_FISSION) =
+          nu(E, EmissionMode::total) * nuc_xs[t](i, XS_FISSION);
       }
     }
+    xs_.emplace_back(nuc_xs[t]);
   }
 
   if (settings::res_scat_on) {
@@ -442,11 +550,14 @@ void Nuclide::create_derived(
         if (name_ == name) {
           resonant_ = true;
 
-          // Make sure nuclide has 0K data
+          // Make sure nuclide has 0K data. This runs in a task while
+          // libraries are read, so the error is raised as an exception that is
+          // reported once all threads are done.
           if (energy_0K_.empty()) {
-            fatal_error("Cannot treat " + name_ +
-                        " as a resonant scatterer "
-                        "because 0 K elastic scattering data is not present.");
+            throw std::runtime_error {
+              "Cannot treat " + name_ +
+              " as a resonant scatterer because 0 K elastic scattering data "
+              "is not present."};
           }
           break;
         }
@@ -483,35 +594,113 @@ void Nuclide::create_derived(
 
 void Nuclide::init_grid()
 {
-  int neutron = static_cast<int>(ParticleType::neutron);
-  double E_min = data::energy_min[neutron];
-  double E_max = data::energy_max[neutron];
-  int M = settings::n_log_bins;
+  for (auto& grid : grid_) {
+    if (settings::energy_grid_method == EnergyGridMethod::HASH) {
+      const auto& E = grid.energy;
+
+      // Choose the width of the hash bins so that, on average, each bin
+      // contains HASH_GRID_POINTS_PER_BIN points. Nuclides with many
+      // resonances thus get more bins than nuclides with smooth cross
+      // sections. Starting from one bin per power of two in energy, each
+      // step halves the bin width.
+      int shift = 52;
+      auto n_bins = [&E](int s) {
+        return energy_hash_key(E.back(), s) - energy_hash_key(E.front(), s) +
+               1;
+      };
+      while (shift > 32 &&
+             n_bins(shift) * HASH_GRID_POINTS_PER_BIN < E.size()) {
+        --shift;
+      }
+      grid.hash_shift = shift;
+      grid.hash_key_min = energy_hash_key(E.front(), shift);
+
+      // Determine corresponding indices in nuclide grid to the lower edge of
+      // each hash bin
+      uint64_t M = n_bins(shift);
+      grid.hash_index.resize(M + 1);
+      int j = 0;
+      for (uint64_t k = 0; k <= M; ++k) {
+        uint64_t bits = (grid.hash_key_min + k) << shift;
+        double E_bin;
+        std::memcpy(&E_bin, &bits, sizeof(double));
+        while (j + 2 < E.size() && E[j + 1] <= E_bin) {
+          ++j;
+        }
+        grid.hash_index[k] = j;
+      }
+      grid.grid_index.clear();
+    } else {
+      grid.grid_index = log_grid_index(grid.energy);
+      grid.hash_index.clear();
+    }
+  }
+}
 
-  // Determine equal-logarithmic energy spacing
-  double spacing = std::log(E_max / E_min) / M;
+void Nuclide::share_data()
+{
+  for (auto& grid : grid_) {
+    grid.energy.share();
+  }
+  for (auto& xs : xs_) {
+    xs.share();
+  }
+  for (auto& rx : reactions_) {
+    for (auto& xs : rx->xs_) {
+      xs.value.share();
+    }
+    for (auto& product : rx->products_) {
+      product.share_data();
+    }
+  }
+  node_shared_fence();
+}
 
-  // Create equally log-spaced energy grid
-  auto umesh = xt::linspace(0.0, M * spacing, M + 1);
+size_t Nuclide::grid_search_memory() const
+{
+  size_t n = 0;
+  for (const auto& grid : grid_) {
+    n += (grid.grid_index.size() + grid.hash_index.size()) * sizeof(int);
+  }
+  return n;
+}
 
-  for (auto& grid : grid_) {
-    // Resize array for storing grid indices
-    grid.grid_index.resize(M + 1);
-
-    // Determine corresponding indices in nuclide grid to energies on
-    // equal-logarithmic grid
-    int j = 0;
-    for (int k = 0; k <= M; ++k) {
-      while (std::log(grid.energy[j + 1] / E_min) <= umesh(k)) {
-        // Ensure that for isotopes where maxval(grid.energy) << E_max that
-        // there are no out-of-bounds issues.
-        if (j + 2 == grid.energy.size())
-          break;
-        ++j;
-      }
-      grid.grid_index[k] = j;
+int Nuclide::find_grid_index(
+  int i_temp, int i_log_union, const int* i_union, double E) const
+{
+  const auto& grid {grid_[i_temp]};
+
+  int i_grid;
+  if (i_union) {
+    // The index was resolved when the material unionized grid was built
+    i_grid = i_union[i_temp];
+  } else if (E < grid.energy.front()) {
+    i_grid = 0;
+  } else if (E > grid.energy.back()) {
+    i_grid = grid.energy.size() - 2;
+  } else {
+    // Determine bounding indices based on which equal log-spaced interval or
+    // hash bin the energy is in
+    int i_low, i_high;
+    if (grid.hash_index.empty()) {
+      i_low = grid.grid_index[i_log_union];
+      i_high = grid.grid_index[i_log_union + 1] + 1;
+    } else {
+      uint64_t k = energy_hash_key(E, grid.hash_shift) - grid.hash_key_min;
+      i_low = grid.hash_index[k];
+      i_high = grid.hash_index[k + 1] + 1;
     }
+
+    // Perform binary search over reduced range
+    i_grid = i_low + lower_bound_index_branchless(
+                       &grid.energy[i_low], &grid.energy[i_high], E);
   }
+
+  // check for rare case where two energy points are the same
+  if (grid.energy[i_grid] == grid.energy[i_grid + 1])
+    ++i_grid;
+
+  return i_grid;
 }
 
 double Nuclide::nu(double E, EmissionMode mode, int group) const
@@ -596,7 +785,7 @@ double Nuclide::elastic_xs_0K(double E) const
 }
 
 void Nuclide::calculate_xs(
-  int i_sab, int i_log_union, double sab_frac, Particle& p)
+  int i_sab, int i_log_union, double sab_frac, Particle& p, const int* i_union)
 {
   auto& micro {p.neutron_xs(index_)};
 
@@ -616,116 +805,21 @@ void Nuclide::calculate_xs(
     // Call multipole kernel
     double sig_s, sig_a, sig_f;
     std::tie(sig_s, sig_a, sig_f) = multipole_->evaluate(p.E(), p.sqrtkT());
-
-    micro.total = sig_s + sig_a;
-    micro.elastic = sig_s;
-    micro.absorption = sig_a;
-    micro.fission = sig_f;
-    micro.nu_fission =
-      fissionable_ ? sig_f * this->nu(p.E(), EmissionMode::total) : 0.0;
-
-    if (simulation::need_depletion_rx) {
-      // Only non-zero reaction is (n,gamma)
-      micro.reaction[0] = sig_a - sig_f;
-
-      // Set all other reaction cross sections to zero
-      for (int i = 1; i < DEPLETION_RX.size(); ++i) {
-        micro.reaction[i] = 0.0;
-      }
-    }
-
-    /*
-     * index_temp, index_grid, and interp_factor are used only in the
-     * following places:
-     *   1. physics.cpp - scatter - For inelastic scatter.
-     *   2. physics.cpp - sample_fission - For partial fissions.
-     *   3. tallies/tally_scoring.cpp - score_general -
-     *        For tallying on MTxxx reactions.
-     *   4. nuclide.cpp - calculate_urr_xs - For unresolved purposes.
-     * It is worth noting that none of these occur in the resolved resonance
-     * range, so the value here does not matter.  index_temp is set to -1 to
-     * force a segfault in case a developer messes up and tries to use it with
-     * multipole.
-     *
-     * However, a segfault is not necessarily guaranteed with an out-of-bounds
-     * access, so this technique should be replaced by something more robust
-     * in the future.
-     */
-    micro.index_temp = -1;
-    micro.index_grid = -1;
-    micro.interp_factor = 0.0;
+    this->set_multipole_xs(p.E(), sig_s, sig_a, sig_f, micro);
 
   } else {
     // Find the appropriate temperature index.
-    double kT = p.sqrtkT() * p.sqrtkT();
-    double f;
-    int i_temp = -1;
-    switch (settings::temperature_method) {
-    case TemperatureMethod::NEAREST: {
-      double max_diff = INFTY;
-      for (int t = 0; t < kTs_.size(); ++t) {
-        double diff = std::abs(kTs_[t] - kT);
-        if (diff < max_diff) {
-          i_temp = t;
-          max_diff = diff;
-        }
-      }
-    } break;
-
-    case TemperatureMethod::INTERPOLATION:
-      // If current kT outside of the bounds of available, snap to the bound
-      if (kT < kTs_.front()) {
-        i_temp = 0;
-        break;
-      }
-      if (kT > kTs_.back()) {
-        i_temp = kTs_.size() - 1;
-        break;
-      }
-
-      // Find temperatures that bound the actual temperature
-      for (i_temp = 0; i_temp < kTs_.size() - 1; ++i_temp) {
-        if (kTs_[i_temp] <= kT && kT < kTs_[i_temp + 1])
-          break;
-      }
-
-      // Randomly sample between temperature i and i+1
-      f = (kT - kTs_[i_temp]) / (kTs_[i_temp + 1] - kTs_[i_temp]);
-      if (f > prn(p.current_seed()))
-        ++i_temp;
-      break;
-    }
-
-    // Determine the energy grid index using a logarithmic mapping to
-    // reduce the energy range over which a binary search needs to be
-    // performed
+    int i_temp =
+      this->temperature_index(p.sqrtkT() * p.sqrtkT(), p.current_seed());
 
+    // Determine the energy grid index
     const auto& grid {grid_[i_temp]};
     const auto& xs {xs_[i_temp]};
-
-    int i_grid;
-    if (p.E() < grid.energy.front()) {
-      i_grid = 0;
-    } else if (p.E() > grid.energy.back()) {
-      i_grid = grid.energy.size() - 2;
-    } else {
-      // Determine bounding indices based on which equal log-spaced
-      // interval the energy is in
-      int i_low = grid.grid_index[i_log_union];
-      int i_high = grid.grid_index[i_log_union + 1] + 1;
-
-      // Perform binary search over reduced range
-      i_grid = i_low + lower_bound_index(
-                         &grid.energy[i_low], &grid.energy[i_high], p.E());
-    }
-
-    // check for rare case where two energy points are the same
-    if (grid.energy[i_grid] == grid.energy[i_grid + 1])
-      ++i_grid;
+    int i_grid = this->find_grid_index(i_temp, i_log_union, i_union, p.E());
 
     // calculate interpolation factor
-    f = (p.E() - grid.energy[i_grid]) /
-        (grid.energy[i_grid + 1] - grid.energy[i_grid]);
+    double f = (p.E() - grid.energy[i_grid]) /
+               (grid.energy[i_grid + 1] - grid.energy[i_grid]);
 
     micro.index_temp = i_temp;
     micro.index_grid = i_grid;
@@ -758,40 +852,7 @@ void Nuclide::calculate_xs(
 
     // Depletion-related reactions
     if (simulation::need_depletion_rx) {
-      // Initialize all reaction cross sections to zero
-      for (double& xs_i : micro.reaction) {
-        xs_i = 0.0;
-      }
-
-      for (int j = 0; j < DEPLETION_RX.size(); ++j) {
-        // If reaction is present and energy is greater than threshold, set the
-        // reaction xs appropriately
-        int i_rx = reaction_index_[DEPLETION_RX[j]];
-        if (i_rx >= 0) {
-          const auto& rx = reactions_[i_rx];
-          const auto& rx_xs = rx->xs_[i_temp].value;
-
-          // Physics says that (n,gamma) is not a threshold reaction, so we
-          // don't need to specifically check its threshold index
-          if (j == 0) {
-            micro.reaction[0] =
-              (1.0 - f) * rx_xs[i_grid] + f * rx_xs[i_grid + 1];
-            continue;
-          }
-
-          int threshold = rx->xs_[i_temp].threshold;
-          if (i_grid >= threshold) {
-            micro.reaction[j] = (1.0 - f) * rx_xs[i_grid - threshold] +
-                                f * rx_xs[i_grid - threshold + 1];
-          } else if (j >= 3) {
-            // One can show that the the threshold for (n,(x+1)n) is always
-            // higher than the threshold for (n,xn). Thus, if we are below
-            // the threshold for, e.g., (n,2n), there is no reason to check
-            // the threshold for (n,3n) and (n,4n).
-            break;
-          }
-        }
-      }
+      this->calculate_depletion_xs(i_temp, i_grid, f, micro);
     }
   }
 
@@ -820,6 +881,287 @@ void Nuclide::calculate_xs(
   micro.last_sqrtkT = p.sqrtkT();
 }
 
+int Nuclide::temperature_index(double kT, uint64_t* seed) const
+{
+  int i_temp = -1;
+  switch (settings::temperature_method) {
+  case TemperatureMethod::NEAREST: {
+    double max_diff = INFTY;
+    for (int t = 0; t < kTs_.size(); ++t) {
+      double diff = std::abs(kTs_[t] - kT);
+      if (diff < max_diff) {
+        i_temp = t;
+        max_diff = diff;
+      }
+    }
+  } break;
+
+  case TemperatureMethod::INTERPOLATION:
+    // If current kT outside of the bounds of available, snap to the bound
+    if (kT < kTs_.front()) {
+      i_temp = 0;
+      break;
+    }
+    if (kT > kTs_.back()) {
+      i_temp = kTs_.size() - 1;
+      break;
+    }
+
+    // Find temperatures that bound the actual temperature
+    for (i_temp = 0; i_temp < kTs_.size() - 1; ++i_temp) {
+      if (kTs_[i_temp] <= kT && kT < kTs_[i_temp + 1])
+        break;
+    }
+
+    // Randomly sample between temperature i and i+1
+    double f = (kT - kTs_[i_temp]) / (kTs_[i_temp + 1] - kTs_[i_temp]);
+    if (f > prn(seed))
+      ++i_temp;
+    break;
+  }
+  return i_temp;
+}
+
+void Nuclide::calculate_depletion_xs(
+  int i_temp, int i_grid, double f, NuclideMicroXS& micro) const
+{
+  // Initialize all reaction cross sections to zero
+  for (double& xs_i : micro.reaction) {
+    xs_i = 0.0;
+  }
+
+  for (int j = 0; j < DEPLETION_RX.size(); ++j) {
+    // If reaction is present and energy is greater than threshold, set the
+    // reaction xs appropriately
+    int i_rx = reaction_index_[DEPLETION_RX[j]];
+    if (i_rx >= 0) {
+      const auto& rx = reactions_[i_rx];
+      const auto& rx_xs = rx->xs_[i_temp].value;
+
+      // Physics says that (n,gamma) is not a threshold reaction, so we
+      // don't need to specifically check its threshold index
+      if (j == 0) {
+        micro.reaction[0] = (1.0 - f) * rx_xs[i_grid] + f * rx_xs[i_grid + 1];
+        continue;
+      }
+
+      int threshold = rx->xs_[i_temp].threshold;
+      if (i_grid >= threshold) {
+        micro.reaction[j] = (1.0 - f) * rx_xs[i_grid - threshold] +
+                            f * rx_xs[i_grid - threshold + 1];
+      } else if (j >= 3) {
+        // One can show that the the threshold for (n,(x+1)n) is always
+        // higher than the threshold for (n,xn). Thus, if we are below
+        // the threshold for, e.g., (n,2n), there is no reason to check
+        // the threshold for (n,3n) and (n,4n).
+        break;
+      }
+    }
+  }
+}
+
+void Nuclide::set_multipole_xs(double E, double sig_s, double sig_a,
+  double sig_f, NuclideMicroXS& micro) const
+{
+  micro.total = sig_s + sig_a;
+  micro.elastic = sig_s;
+  micro.absorption = sig_a;
+  micro.fission = sig_f;
+  micro.nu_fission =
+    fissionable_ ? sig_f * this->nu(E, EmissionMode::total) : 0.0;
+
+  if (simulation::need_depletion_rx) {
+    // Only non-zero reaction is (n,gamma)
+    micro.reaction[0] = sig_a - sig_f;
+
+    // Set all other reaction cross sections to zero
+    for (int i = 1; i < DEPLETION_RX.size(); ++i) {
+      micro.reaction[i] = 0.0;
+    }
+  }
+
+  /*
+   * index_temp, index_grid, and interp_factor are used only in the
+   * following places:
+   *   1. physics.cpp - scatter - For inelastic scatter.
+   *   2. physics.cpp - sample_fission - For partial fissions.
+   *   3. tallies/tally_scoring.cpp - score_general -
+   *        For tallying on MTxxx reactions.
+   *   4. nuclide.cpp - calculate_urr_xs - For unresolved purposes.
+   * It is worth noting that none of these occur in the resolved resonance
+   * range, so the value here does not matter.  index_temp is set to -1 to
+   * force a segfault in case a developer messes up and tries to use it with
+   * multipole.
+   *
+   * However, a segfault is not necessarily guaranteed with an out-of-bounds
+   * access, so this technique should be replaced by something more robust
+   * in the future.
+   */
+  micro.index_temp = -1;
+  micro.index_grid = -1;
+  micro.interp_factor = 0.0;
+}
+
+void Nuclide::calculate_xs_banked(const int* i_sab, const int* i_log_union,
+  double sab_frac, const double* ncrystal_xs, const int* const* i_union,
+  gsl::span<Particle*> bank)
+{
+  Expects(bank.size() <= XS_LOOKUP_BANK_SIZE);
+
+  // Position in the bank, temperature index, and pointers to the bracketing
+  // energy grid points and cross section rows for each particle that goes
+  // through the banked kernel
+  array<int, XS_LOOKUP_BANK_SIZE> k_bank;
+  array<int, XS_LOOKUP_BANK_SIZE> i_temp;
+  array<int, XS_LOOKUP_BANK_SIZE> i_grid;
+  array<double, XS_LOOKUP_BANK_SIZE> E;
+  array<const double*, XS_LOOKUP_BANK_SIZE> E_grid;
+  array<const double*, XS_LOOKUP_BANK_SIZE> xs_row;
+  int n = 0;
+
+  // Position in the bank, energy, and temperature of each particle whose cross
+  // sections are evaluated from windowed multipole data
+  array<int, XS_LOOKUP_BANK_SIZE> k_mp;
+  array<double, XS_LOOKUP_BANK_SIZE> E_mp;
+  array<double, XS_LOOKUP_BANK_SIZE> sqrtkT_mp;
+  int n_mp = 0;
+
+  // First pass: determine which particles need their cross sections
+  // recalculated, sample temperatures, and perform the energy grid search
+  for (int k = 0; k < bank.size(); ++k) {
+    Particle& p = *bank[k];
+    const auto& micro {p.neutron_xs(index_)};
+
+    // Skip particles whose cached cross sections are still valid
+    if (p.E() == micro.last_E && p.sqrtkT() == micro.last_sqrtkT &&
+        i_sab[k] == micro.index_sab && sab_frac == micro.sab_frac)
+      continue;
+
+    // Cases that are not handled by the banked kernel
+    if (i_sab[k] >= 0 || ncrystal_xs[k] >= 0.0) {
+      p.update_neutron_xs(index_, i_log_union[k], i_sab[k], sab_frac,
+        ncrystal_xs[k], i_union ? i_union[k] : nullptr);
+      continue;
+    }
+
+    // Defer particles in the resolved resonance range of multipole data
+    if (multipole_ && p.E() >= multipole_->E_min_ &&
+        p.E() <= multipole_->E_max_) {
+      k_mp[n_mp] = k;
+      E_mp[n_mp] = p.E();
+      sqrtkT_mp[n_mp] = p.sqrtkT();
+      ++n_mp;
+      continue;
+    }
+
+    int t = this->temperature_index(p.sqrtkT() * p.sqrtkT(), p.current_seed());
+    const auto& grid {grid_[t]};
+    int i = this->find_grid_index(
+      t, i_log_union[k], i_union ? i_union[k] : nullptr, p.E());
+
+    k_bank[n] = k;
+    i_temp[n] = t;
+    i_grid[n] = i;
+    E[n] = p.E();
+    E_grid[n] = &grid.energy[i];
+    xs_row[n] = &xs_[t](i, 0);
+    ++n;
+  }
+
+  // Second pass: interpolate cross sections. The loop body has no branches so
+  // that it can be vectorized with gathers from the cross section rows.
+  array<double, XS_LOOKUP_BANK_SIZE> f;
+  array<double, XS_LOOKUP_BANK_SIZE> total;
+  array<double, XS_LOOKUP_BANK_SIZE> absorption;
+  array<double, XS_LOOKUP_BANK_SIZE> fission;
+  array<double, XS_LOOKUP_BANK_SIZE> nu_fission;
+  array<double, XS_LOOKUP_BANK_SIZE> photon_prod;
+  const int n_cols = xs_.front().shape()[1];
+  const int i_total = XS_TOTAL;
+  const int i_absorption = XS_ABSORPTION;
+  const int i_fission = XS_FISSION;
+  const int i_nu_fission = XS_NU_FISSION;
+  const int i_photon_prod = XS_PHOTON_PROD;
+
+#pragma omp simd
+  for (int m = 0; m < n; ++m) {
+    const double* x0 = xs_row[m];
+    const double* x1 = xs_row[m] + n_cols;
+    double f_m = (E[m] - E_grid[m][0]) / (E_grid[m][1] - E_grid[m][0]);
+    f[m] = f_m;
+    total[m] = (1.0 - f_m) * x0[i_total] + f_m * x1[i_total];
+    absorption[m] = (1.0 - f_m) * x0[i_absorption] + f_m * x1[i_absorption];
+    fission[m] = (1.0 - f_m) * x0[i_fission] + f_m * x1[i_fission];
+    nu_fission[m] = (1.0 - f_m) * x0[i_nu_fission] + f_m * x1[i_nu_fission];
+    photon_prod[m] =
+      (1.0 - f_m) * x0[i_photon_prod] + f_m * x1[i_photon_prod];
+  }
+
+  // Third pass: store results in each particle's cross section cache and
+  // handle depletion reactions and probability tables
+  for (int m = 0; m < n; ++m) {
+    Particle& p = *bank[k_bank[m]];
+    auto& micro {p.neutron_xs(index_)};
+
+    micro.elastic = CACHE_INVALID;
+    micro.thermal = 0.0;
+    micro.thermal_elastic = 0.0;
+
+    micro.index_temp = i_temp[m];
+    micro.index_grid = i_grid[m];
+    micro.interp_factor = f[m];
+
+    micro.total = total[m];
+    micro.absorption = absorption[m];
+    micro.fission = fissionable_ ? fission[m] : 0.0;
+    micro.nu_fission = fissionable_ ? nu_fission[m] : 0.0;
+    micro.photon_prod = photon_prod[m];
+
+    if (simulation::need_depletion_rx) {
+      this->calculate_depletion_xs(i_temp[m], i_grid[m], f[m], micro);
+    }
+
+    micro.index_sab = C_NONE;
+    micro.sab_frac = 0.0;
+    micro.use_ptable = false;
+
+    if (settings::urr_ptables_on && urr_present_) {
+      if (urr_data_[micro.index_temp].energy_in_bounds(p.E()))
+        this->calculate_urr_xs(micro.index_temp, p);
+    }
+
+    micro.last_E = p.E();
+    micro.last_sqrtkT = p.sqrtkT();
+  }
+
+  // Evaluate the windowed multipole cross sections of the deferred particles
+  // at once
+  if (n_mp > 0) {
+    array<double, XS_LOOKUP_BANK_SIZE> sig_s;
+    array<double, XS_LOOKUP_BANK_SIZE> sig_a;
+    array<double, XS_LOOKUP_BANK_SIZE> sig_f;
+    multipole_->evaluate(n_mp, E_mp.data(), sqrtkT_mp.data(), sig_s.data(),
+      sig_a.data(), sig_f.data());
+
+    for (int m = 0; m < n_mp; ++m) {
+      Particle& p = *bank[k_mp[m]];
+      auto& micro {p.neutron_xs(index_)};
+
+      micro.elastic = CACHE_INVALID;
+      micro.thermal = 0.0;
+      micro.thermal_elastic = 0.0;
+      this->set_multipole_xs(E_mp[m], sig_s[m], sig_a[m], sig_f[m], micro);
+
+      micro.index_sab = C_NONE;
+      micro.sab_frac = 0.0;
+      micro.use_ptable = false;
+
+      micro.last_E = p.E();
+      micro.last_sqrtkT = p.sqrtkT();
+    }
+  }
+}
+
 void Nuclide::calculate_sab_xs(int i_sab, double sab_frac, Particle& p)
 {
   auto& micro {p.neutron_xs(index_)};
@@ -1064,6 +1406,49 @@ double Nuclide::collapse_rate(int MT, double temperature,
 // Non-member functions
 //==============================================================================
 
+void revert_temperature_method(const Nuclide& nuc)
+{
+  if (nuc.single_temperature_ &&
+      settings::temperature_method == TemperatureMethod::INTERPOLATION) {
+    if (mpi::master) {
+      warning("Cross sections for " + nuc.name_ +
+              " are only available at one "
+              "temperature. Reverting to nearest temperature method.");
+    }
+    settings::temperature_method = TemperatureMethod::NEAREST;
+  }
+}
+
+vector<int> log_grid_index(gsl::span<const double> energy)
+{
+  int neutron = static_cast<int>(ParticleType::neutron);
+  double E_min = data::energy_min[neutron];
+  double E_max = data::energy_max[neutron];
+  int M = settings::n_log_bins;
+
+  // Determine equal-logarithmic energy spacing
+  double spacing = std::log(E_max / E_min) / M;
+
+  // Create equally log-spaced energy grid
+  auto umesh = xt::linspace(0.0, M * spacing, M + 1);
+
+  // Determine corresponding indices in the energy grid to energies on
+  // equal-logarithmic grid
+  vector<int> grid_index(M + 1);
+  int j = 0;
+  for (int k = 0; k <= M; ++k) {
+    while (std::log(energy[j + 1] / E_min) <= umesh(k)) {
+      // Ensure that for isotopes where maxval(grid.energy) << E_max that
+      // there are no out-of-bounds issues.
+      if (j + 2 == energy.size())
+        break;
+      ++j;
+    }
+    grid_index[k] = j;
+  }
+  return grid_index;
+}
+
 void check_data_version(hid_t file_id)
 {
   if (attribute_exists(file_id, "version")) {
@@ -1089,12 +1474,9 @@ extern "C" size_t nuclides_size()
   return data::nuclides.size();
 }
 
-//==============================================================================
-// C API
-//==============================================================================
-
-extern "C" int openmc_load_nuclide(const char* name, const double* temps, int n)
+int read_nuclide(const char* name, const double* temps, int n, Nuclide*& nuc)
 {
+  nuc = nullptr;
   if (data::nuclide_map.find(name) == data::nuclide_map.end() ||
       data::nuclide_map.at(name) >= data::elements.size()) {
     LibraryKey key {Library::Type::neutron, name};
@@ -1106,9 +1488,10 @@ extern "C" int openmc_load_nuclide(const char* name, const double* temps, int n)
     }
 
     // Get filename for library containing nuclide
-    int idx = it->second;
-    const auto& filename = data::libraries[idx].path_;
+    auto& library = data::libraries[it->second];
+    const auto& filename = library.path_;
     write_message(6, "Reading {} from {}", name, filename);
+    library.timer_.start();
 
     // Open file and make sure version is sufficient
     hid_t file_id = file_open(filename, 'r');
@@ -1118,9 +1501,11 @@ extern "C" int openmc_load_nuclide(const char* name, const double* temps, int n)
     hid_t group = open_group(file_id, name);
     vector<double> temperature {temps, temps + n};
     data::nuclides.push_back(make_unique<Nuclide>(group, temperature));
+    nuc = data::nuclides.back().get();
 
     close_group(group);
     file_close(file_id);
+    library.timer_.stop();
 
     // Read multipole file into the appropriate entry on the nuclides array
     int i_nuclide = data::nuclide_map.at(name);
@@ -1141,9 +1526,10 @@ extern "C" int openmc_load_nuclide(const char* name, const double* temps, int n)
           return OPENMC_E_DATA;
         }
 
-        int idx = it->second;
-        const auto& filename = data::libraries[idx].path_;
+        auto& library = data::libraries[it->second];
+        const auto& filename = library.path_;
         write_message(6, "Reading {} from {} ", element, filename);
+        library.timer_.start();
 
         // Open file and make sure version is sufficient
         hid_t file_id = file_open(filename, 'r');
@@ -1155,12 +1541,33 @@ extern "C" int openmc_load_nuclide(const char* name, const double* temps, int n)
 
         close_group(group);
         file_close(file_id);
+        library.timer_.stop();
       }
     }
   }
   return 0;
 }
 
+//==============================================================================
+// C API
+//==============================================================================
+
+extern "C" int openmc_load_nuclide(const char* name, const double* temps, int n)
+{
+  Nuclide* nuc;
+  int err = read_nuclide(name, temps, n, nuc);
+  if (nuc) {
+    revert_temperature_method(*nuc);
+    try {
+      nuc->create_derived();
+    } catch (const std::exception& e) {
+      set_errmsg(e.what());
+      return OPENMC_E_DATA;
+    }
+  }
+  return err;
+}
+
 extern "C" int openmc_get_nuclide_index(const char* name, int* index)
 {
   auto it = data::nuclide_map.find(name);
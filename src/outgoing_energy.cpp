@@ -0,0 +1,118 @@
+#include "openmc/outgoing_energy.h"
+
+#include <algorithm> // for max, min
+#include <utility>   // for move
+
+#include "openmc/endf.h"
+
+namespace openmc {
+
+//==============================================================================
+// OutgoingEnergyTables implementation
+//==============================================================================
+
+OutgoingEnergyTables::OutgoingEnergyTables(const xt::xarray<double>& eout,
+  const vector<int>& offsets, const vector<int>& interpolation,
+  const vector<int>& n_discrete, int n_fields)
+  : n_fields_ {n_fields}
+{
+  int n_energy = offsets.size();
+  int n_total = eout.shape()[1];
+  vector<double> values;
+  vector<int> guide;
+  values.reserve(static_cast<size_t>(n_total) * n_fields);
+
+  for (int i = 0; i < n_energy; ++i) {
+    Table t;
+    t.start = values.size() / n_fields;
+    t.n = (i < n_energy - 1 ? offsets[i + 1] : n_total) - offsets[i];
+    t.n_discrete = n_discrete[i];
+    t.interpolation = int2interp(interpolation[i]);
+
+    // To get answers that match ACE data, the tabulated CDF values that were
+    // passed through to the HDF5 library are used as is rather than being
+    // reconstructed from the PDF
+    for (int f = 0; f < n_fields; ++f) {
+      for (int j = 0; j < t.n; ++j) {
+        values.push_back(eout(f, offsets[i] + j));
+      }
+    }
+
+    // Determine the first bin that can hold a CDF value in each guide table
+    // bin. The products with the number of guide table bins are compared to
+    // the bin indices exactly as they are computed in find_bin() so that
+    // rounding can never cause a bin to be skipped.
+    const double* c = values.data() + values.size() - (n_fields - CDF) * t.n;
+    int end = t.n - 2;
+    t.guide = guide.size();
+    t.n_guide = std::max(1, t.n - t.n_discrete);
+    int j = t.n_discrete;
+    for (int g = 0; g < t.n_guide; ++g) {
+      while (j < end && !(c[j + 1] * t.n_guide >= g)) {
+        ++j;
+      }
+      guide.push_back(j);
+    }
+
+    tables_.push_back(t);
+  }
+  values_ = std::move(values);
+  guide_ = std::move(guide);
+}
+
+OutgoingEnergyTables::OutgoingEnergyTables(CacheReader& cache)
+{
+  cache.read(n_fields_);
+  cache.read(tables_);
+  cache.read(values_);
+  cache.read(guide_);
+}
+
+OutgoingEnergyTables::Bin OutgoingEnergyTables::find_bin(
+  int i, double xi) const
+{
+  const auto& t = tables_[i];
+  const double* c = this->c(i);
+  int end = t.n - 2;
+
+  // Discrete portion
+  for (int k = 0; k < t.n_discrete; ++k) {
+    if (xi < c[k])
+      return {k, c[k], c[k]};
+  }
+
+  // If there is no continuous bin to search, the value is assigned to the
+  // last discrete line
+  int k = std::max(t.n_discrete - 1, 0);
+  if (t.n_discrete >= end) {
+    return {k, c[k], k + 1 < t.n ? c[k + 1] : c[k]};
+  }
+
+  // Continuous portion, starting from the guide table. The CDF value at the
+  // lower bound of the first continuous bin is that of the last discrete line.
+  int g = std::min(static_cast<int>(xi * t.n_guide), t.n_guide - 1);
+  int j = guide_[t.guide + g];
+  while (j < end && !(xi < c[j + 1])) {
+    ++j;
+  }
+  if (j == end) {
+    return {end, c[end], c[end]};
+  }
+  return {j, j == t.n_discrete ? c[k] : c[j], c[j + 1]};
+}
+
+void OutgoingEnergyTables::serialize(CacheWriter& cache) const
+{
+  cache.write(n_fields_);
+  cache.write(tables_);
+  cache.write(values_);
+  cache.write(guide_);
+}
+
+void OutgoingEnergyTables::share_data()
+{
+  values_.share();
+  guide_.share();
+}
+
+} // namespace openmc
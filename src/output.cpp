@@ -27,6 +27,7 @@
 #include "openmc/geometry.h"
 #include "openmc/lattice.h"
 #include "openmc/math_functions.h"
+#include "openmc/mesh_traversal.h"
 #include "openmc/message_passing.h"
 #include "openmc/mgxs_interface.h"
 #include "openmc/nuclide.h"
@@ -422,6 +423,13 @@ void show_time(const char* label, double secs, int indent_level)
     label, width, secs);
 }
 
+void show_bytes(const char* label, int64_t bytes, int indent_level)
+{
+  int width = 33 - indent_level * 2;
+  fmt::print("{0:{1}} {2:<{3}} = {4:>10.4e} bytes\n", "", 2 * indent_level,
+    label, width, static_cast<double>(bytes));
+}
+
 void show_rate(const char* label, double particles_per_sec)
 {
   fmt::print(" {:<33} = {:.6} particles/second\n", label, particles_per_sec);
@@ -445,6 +453,10 @@ void print_runtime()
   if (settings::event_based) {
     show_time("Particle initialization", time_event_init.elapsed(), 2);
     show_time("XS lookups", time_event_calculate_xs.elapsed(), 2);
+    if (settings::sort_xs_queues || settings::banked_xs_lookup) {
+      show_time("Sorting queues", time_event_sort_xs.elapsed(), 3);
+      show_time("Cross section lookups", time_event_lookup_xs.elapsed(), 3);
+    }
     show_time("Advancing", time_event_advance_particle.elapsed(), 2);
     show_time("Surface crossings", time_event_surface_crossing.elapsed(), 2);
     show_time("Collisions", time_event_collision.elapsed(), 2);
@@ -458,8 +470,23 @@ void print_runtime()
     show_time("Time synchronizing fission bank", time_bank.elapsed(), 1);
     show_time("Sampling source sites", time_bank_sample.elapsed(), 2);
     show_time("SEND/RECV source sites", time_bank_sendrecv.elapsed(), 2);
+    show_bytes("Sent to other processes", bank_bytes_sent, 3);
+    show_bytes("Kept on same process", bank_bytes_copied, 3);
   }
   show_time("Time accumulating tallies", time_tallies.elapsed(), 1);
+  if (mpi::n_procs > 1 && settings::reduce_tallies) {
+    double time_reduce = 0.0;
+    for (const auto& t : model::tallies) {
+      time_reduce += t->time_reduce_.elapsed();
+    }
+    show_time("Reducing tallies", time_reduce, 2);
+    if (settings::verbosity >= 7) {
+      for (const auto& t : model::tallies) {
+        show_time(fmt::format("Tally {}", t->id_).c_str(),
+          t->time_reduce_.elapsed(), 3);
+      }
+    }
+  }
   show_time("Time writing statepoints", time_statepoint.elapsed(), 1);
   show_time("Total time for finalization", time_finalize.elapsed());
   show_time("Total time elapsed", time_total.elapsed());
@@ -501,6 +528,15 @@ void print_runtime()
     show_rate("Calculation Rate (inactive)", speed_inactive);
   }
   show_rate("Calculation Rate (active)", speed_active);
+
+  // display how often mesh traversals were shared between mesh filters and
+  // weight windows
+  int64_t n_lookups = mesh_traversal_hits + mesh_traversal_misses;
+  if (n_lookups > 0) {
+    fmt::print(" {:<33} = {:.2f}% of {} lookups\n",
+      "Mesh traversal cache hit rate",
+      100.0 * mesh_traversal_hits / n_lookups, n_lookups);
+  }
 }
 
 //==============================================================================
@@ -631,6 +667,10 @@ void write_tallies()
       fmt::print(tallies_out, " Internal\n\n");
       continue;
     }
+    if (tally.decompose_) {
+      fmt::print(tallies_out, " Decomposed; see state point file\n\n");
+      continue;
+    }
 
     // Calculate t-value for confidence intervals
     double t_value = 1;
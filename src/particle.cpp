@@ -114,6 +114,7 @@ void Particle::from_source(const SourceSite* src)
   n_collision() = 0;
   fission() = false;
   zero_flux_derivs();
+  mesh_traversals().clear();
 
   // Copy attributes from source bank site
   type() = src->particle;
@@ -139,6 +140,13 @@ void Particle::from_source(const SourceSite* src)
 }
 
 void Particle::event_calculate_xs()
+{
+  if (this->event_calculate_xs_prepare()) {
+    model::materials[material()]->calculate_xs(*this);
+  }
+}
+
+bool Particle::event_calculate_xs_prepare()
 {
   // Set the random number stream
   stream() = STREAM_TRACKING;
@@ -162,7 +170,7 @@ void Particle::event_calculate_xs()
     if (!exhaustive_find_cell(*this)) {
       mark_as_lost(
         "Could not find the cell containing particle " + std::to_string(id()));
-      return;
+      return false;
     }
 
     // Set birth cell attribute
@@ -180,12 +188,10 @@ void Particle::event_calculate_xs()
   // Calculate microscopic and macroscopic cross sections
   if (material() != MATERIAL_VOID) {
     if (settings::run_CE) {
-      if (material() != material_last() || sqrtkT() != sqrtkT_last()) {
-        // If the material is the same as the last material and the
-        // temperature hasn't changed, we don't need to lookup cross
-        // sections again.
-        model::materials[material()]->calculate_xs(*this);
-      }
+      // If the material is the same as the last material and the
+      // temperature hasn't changed, we don't need to lookup cross
+      // sections again.
+      return material() != material_last() || sqrtkT() != sqrtkT_last();
     } else {
       // Get the MG data; unlike the CE case above, we have to re-calculate
       // cross sections for every collision since the cross sections may
@@ -201,6 +207,7 @@ void Particle::event_calculate_xs()
     macro_xs().fission = 0.0;
     macro_xs().nu_fission = 0.0;
   }
+  return false;
 }
 
 void Particle::event_advance()
@@ -455,6 +462,9 @@ void Particle::event_death()
   keff_tally_tracklength() = 0.0;
   keff_tally_leakage() = 0.0;
 
+  // Contribute mesh traversal cache statistics to global counters
+  mesh_traversals().accumulate();
+
   if (!model::active_pulse_height_tallies.empty()) {
     score_pulse_height_tally(*this, model::active_pulse_height_tallies);
   }
@@ -760,6 +770,9 @@ void Particle::write_restart() const
 
 #pragma omp critical(WriteParticleRestart)
   {
+    // HDF5 may be in use by the track writer thread
+    std::lock_guard<std::mutex> lock(track_hdf5_mutex);
+
     // Create file
     hid_t file_id = file_open(filename, 'w');
 
@@ -820,8 +833,8 @@ void Particle::write_restart() const
   } // #pragma omp critical
 }
 
-void Particle::update_neutron_xs(
-  int i_nuclide, int i_grid, int i_sab, double sab_frac, double ncrystal_xs)
+void Particle::update_neutron_xs(int i_nuclide, int i_grid, int i_sab,
+  double sab_frac, double ncrystal_xs, const int* i_union)
 {
   // Get microscopic cross section cache
   auto& micro = this->neutron_xs(i_nuclide);
@@ -829,7 +842,8 @@ void Particle::update_neutron_xs(
   // If the cache doesn't match, recalculate micro xs
   if (this->E() != micro.last_E || this->sqrtkT() != micro.last_sqrtkT ||
       i_sab != micro.index_sab || sab_frac != micro.sab_frac) {
-    data::nuclides[i_nuclide]->calculate_xs(i_sab, i_grid, sab_frac, *this);
+    data::nuclides[i_nuclide]->calculate_xs(
+      i_sab, i_grid, sab_frac, *this, i_union);
 
     // If NCrystal is being used, update micro cross section cache
     if (ncrystal_xs >= 0.0) {
@@ -72,7 +72,7 @@ ParticleData::ParticleData()
   filter_matches_.resize(model::tally_filters.size());
 
   // Create microscopic cross section caches
-  neutron_xs_.resize(data::nuclides.size());
+  neutron_xs_.resize(NEUTRON_XS_EXTRA_SLOTS);
   photon_xs_.resize(data::elements.size());
 
   // Creates the pulse-height storage for the particle
@@ -365,6 +365,7 @@ void FlatSourceDomain::convert_source_regions_to_tallies()
       // Reset all the filter matches for the next tally event.
       for (auto& match : p.filter_matches())
         match.bins_present_ = false;
+      reset_filter_match_arena();
     }
   }
   openmc::simulation::time_tallies.stop();
@@ -47,7 +47,9 @@ Reaction::Reaction(hid_t group, const vector<int>& temperatures)
     read_attribute(dset, "threshold_idx", xs.threshold);
 
     // Read cross section values
-    read_dataset(dset, xs.value);
+    vector<double> value;
+    read_dataset(dset, value);
+    xs.value = std::move(value);
     close_dataset(dset);
     close_group(temp_group);
 
@@ -65,6 +67,27 @@ Reaction::Reaction(hid_t group, const vector<int>& temperatures)
   }
 }
 
+Reaction::Reaction(CacheReader& cache)
+{
+  cache.read(mt_);
+  cache.read(q_value_);
+  cache.read(scatter_in_cm_);
+  cache.read(redundant_);
+
+  auto n = cache.read<size_t>();
+  for (size_t i = 0; i < n; ++i) {
+    TemperatureXS xs;
+    cache.read(xs.threshold);
+    cache.read(xs.value);
+    xs_.push_back(std::move(xs));
+  }
+
+  n = cache.read<size_t>();
+  for (size_t i = 0; i < n; ++i) {
+    products_.emplace_back(cache);
+  }
+}
+
 double Reaction::xs(
   gsl::index i_temp, gsl::index i_grid, double interp_factor) const
 {
@@ -84,7 +107,7 @@ double Reaction::xs(const NuclideMicroXS& micro) const
 
 double Reaction::collapse_rate(gsl::index i_temp,
   gsl::span<const double> energy, gsl::span<const double> flux,
-  const vector<double>& grid) const
+  gsl::span<const double> grid) const
 {
   // Find index corresponding to first energy
   const auto& xs = xs_[i_temp].value;
@@ -150,6 +173,25 @@ double Reaction::collapse_rate(gsl::index i_temp,
   return xs_flux_sum;
 }
 
+void Reaction::serialize(CacheWriter& cache) const
+{
+  cache.write(mt_);
+  cache.write(q_value_);
+  cache.write(scatter_in_cm_);
+  cache.write(redundant_);
+
+  cache.write(xs_.size());
+  for (const auto& xs : xs_) {
+    cache.write(xs.threshold);
+    cache.write(xs.value);
+  }
+
+  cache.write(products_.size());
+  for (const auto& p : products_) {
+    p.serialize(cache);
+  }
+}
+
 //==============================================================================
 // Non-member functions
 //==============================================================================
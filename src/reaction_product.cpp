@@ -1,6 +1,7 @@
 #include "openmc/reaction_product.h"
 
-#include <string> // for string
+#include <stdexcept> // for runtime_error
+#include <string>    // for string
 
 #include <fmt/core.h>
 
@@ -83,6 +84,82 @@ ReactionProduct::ReactionProduct(hid_t group)
   }
 }
 
+ReactionProduct::ReactionProduct(CacheReader& cache)
+{
+  cache.read(particle_);
+  cache.read(emission_mode_);
+  cache.read(decay_rate_);
+  yield_ = read_function(cache);
+
+  auto n = cache.read<size_t>();
+  for (size_t i = 0; i < n; ++i) {
+    applicability_.emplace_back(cache);
+  }
+
+  n = cache.read<size_t>();
+  for (size_t i = 0; i < n; ++i) {
+    switch (cache.read<CacheType>()) {
+    case CacheType::uncorrelated:
+      distribution_.push_back(make_unique<UncorrelatedAngleEnergy>(cache));
+      break;
+    case CacheType::correlated:
+      distribution_.push_back(make_unique<CorrelatedAngleEnergy>(cache));
+      break;
+    case CacheType::nbody:
+      distribution_.push_back(make_unique<NBodyPhaseSpace>(cache));
+      break;
+    case CacheType::kalbach_mann:
+      distribution_.push_back(make_unique<KalbachMann>(cache));
+      break;
+    default:
+      throw std::runtime_error {
+        "Unknown angle-energy distribution type in cross section cache"};
+    }
+  }
+}
+
+void ReactionProduct::serialize(CacheWriter& cache) const
+{
+  cache.write(particle_);
+  cache.write(emission_mode_);
+  cache.write(decay_rate_);
+  write_function(cache, yield_.get());
+
+  cache.write(applicability_.size());
+  for (const auto& app : applicability_) {
+    app.serialize(cache);
+  }
+
+  // Write the type of each distribution followed by its data
+  cache.write(distribution_.size());
+  for (const auto& dist : distribution_) {
+    if (auto d = dynamic_cast<const UncorrelatedAngleEnergy*>(dist.get())) {
+      cache.write(CacheType::uncorrelated);
+      d->serialize(cache);
+    } else if (auto d =
+                 dynamic_cast<const CorrelatedAngleEnergy*>(dist.get())) {
+      cache.write(CacheType::correlated);
+      d->serialize(cache);
+    } else if (auto d = dynamic_cast<const NBodyPhaseSpace*>(dist.get())) {
+      cache.write(CacheType::nbody);
+      d->serialize(cache);
+    } else if (auto d = dynamic_cast<const KalbachMann*>(dist.get())) {
+      cache.write(CacheType::kalbach_mann);
+      d->serialize(cache);
+    } else {
+      throw std::runtime_error {"Angle-energy distribution type cannot be "
+                                "written to the cross section cache"};
+    }
+  }
+}
+
+void ReactionProduct::share_data()
+{
+  for (auto& dist : distribution_) {
+    dist->share_data();
+  }
+}
+
 void ReactionProduct::sample(
   double E_in, double& E_out, double& mu, uint64_t* seed) const
 {
@@ -58,60 +58,12 @@ CorrelatedAngleEnergy::CorrelatedAngleEnergy(hid_t group)
   xt::xarray<double> mu;
   read_dataset(group, "mu", mu);
 
-  for (int i = 0; i < n_energy; ++i) {
-    // Determine number of outgoing energies
-    int j = offsets[i];
-    int n;
-    if (i < n_energy - 1) {
-      n = offsets[i + 1] - j;
-    } else {
-      n = eout.shape()[1] - j;
-    }
-
-    // Assign interpolation scheme and number of discrete lines
-    CorrTable d;
-    d.interpolation = int2interp(interp[i]);
-    d.n_discrete = n_discrete[i];
-
-    // Copy data
-    d.e_out = xt::view(eout, 0, xt::range(j, j + n));
-    d.p = xt::view(eout, 1, xt::range(j, j + n));
-    d.c = xt::view(eout, 2, xt::range(j, j + n));
-
-    // To get answers that match ACE data, for now we still use the tabulated
-    // CDF values that were passed through to the HDF5 library. At a later
-    // time, we can remove the CDF values from the HDF5 library and
-    // reconstruct them using the PDF
-    if (false) {
-      // Calculate cumulative distribution function -- discrete portion
-      for (int k = 0; k < d.n_discrete; ++k) {
-        if (k == 0) {
-          d.c[k] = d.p[k];
-        } else {
-          d.c[k] = d.c[k - 1] + d.p[k];
-        }
-      }
-
-      // Continuous portion
-      for (int k = d.n_discrete; k < n; ++k) {
-        if (k == d.n_discrete) {
-          d.c[k] = d.c[k - 1] + d.p[k];
-        } else {
-          if (d.interpolation == Interpolation::histogram) {
-            d.c[k] = d.c[k - 1] + d.p[k - 1] * (d.e_out[k] - d.e_out[k - 1]);
-          } else if (d.interpolation == Interpolation::lin_lin) {
-            d.c[k] = d.c[k - 1] + 0.5 * (d.p[k - 1] + d.p[k]) *
-                                    (d.e_out[k] - d.e_out[k - 1]);
-          }
-        }
-      }
+  // Store the outgoing energy, PDF, and CDF of each table
+  distribution_ = OutgoingEnergyTables {eout, offsets, interp, n_discrete, 3};
 
-      // Normalize density and distribution functions
-      d.p /= d.c[n - 1];
-      d.c /= d.c[n - 1];
-    }
-
-    for (j = 0; j < n; ++j) {
+  angle_.reserve(eout.shape()[1]);
+  for (int i = 0; i < n_energy; ++i) {
+    for (int j = 0; j < distribution_.n(i); ++j) {
       // Get interpolation scheme
       int interp_mu = std::lround(eout(3, offsets[i] + j));
 
@@ -144,13 +96,39 @@ CorrelatedAngleEnergy::CorrelatedAngleEnergy(hid_t group)
       // CDF values that were passed through to the HDF5 library. At a later
       // time, we can remove the CDF values from the HDF5 library and
       // reconstruct them using the PDF
-      Tabular* mudist = new Tabular {x.data(), p.data(), m, interp, c.data()};
-
-      d.angle.emplace_back(mudist);
+      angle_.emplace_back(x.data(), p.data(), m, interp, c.data());
     } // outgoing energies
+  }   // incoming energies
+}
+
+CorrelatedAngleEnergy::CorrelatedAngleEnergy(CacheReader& cache)
+{
+  cache.read(breakpoints_);
+  cache.read(interpolation_);
+  cache.read(energy_);
+  n_region_ = breakpoints_.size();
+  distribution_ = OutgoingEnergyTables {cache};
+  for (int i = 0; i < distribution_.size(); ++i) {
+    for (int j = 0; j < distribution_.n(i); ++j) {
+      angle_.emplace_back(cache);
+    }
+  }
+}
+
+void CorrelatedAngleEnergy::serialize(CacheWriter& cache) const
+{
+  cache.write(breakpoints_);
+  cache.write(interpolation_);
+  cache.write(energy_);
+  distribution_.serialize(cache);
+  for (const auto& mudist : angle_) {
+    mudist.serialize(cache);
+  }
+}
 
-    distribution_.push_back(std::move(d));
-  } // incoming energies
+void CorrelatedAngleEnergy::share_data()
+{
+  distribution_.share_data();
 }
 
 void CorrelatedAngleEnergy::sample(
@@ -176,51 +154,31 @@ void CorrelatedAngleEnergy::sample(
   int l = r > prn(seed) ? i + 1 : i;
 
   // Interpolation for energy E1 and EK
-  int n_energy_out = distribution_[i].e_out.size();
-  int n_discrete = distribution_[i].n_discrete;
-  double E_i_1 = distribution_[i].e_out[n_discrete];
-  double E_i_K = distribution_[i].e_out[n_energy_out - 1];
+  const double* e_out = distribution_.e_out(i);
+  double E_i_1 = e_out[distribution_.n_discrete(i)];
+  double E_i_K = e_out[distribution_.n(i) - 1];
 
-  n_energy_out = distribution_[i + 1].e_out.size();
-  n_discrete = distribution_[i + 1].n_discrete;
-  double E_i1_1 = distribution_[i + 1].e_out[n_discrete];
-  double E_i1_K = distribution_[i + 1].e_out[n_energy_out - 1];
+  e_out = distribution_.e_out(i + 1);
+  double E_i1_1 = e_out[distribution_.n_discrete(i + 1)];
+  double E_i1_K = e_out[distribution_.n(i + 1) - 1];
 
   double E_1 = E_i_1 + r * (E_i1_1 - E_i_1);
   double E_K = E_i_K + r * (E_i1_K - E_i_K);
 
   // Determine outgoing energy bin
-  n_energy_out = distribution_[l].e_out.size();
-  n_discrete = distribution_[l].n_discrete;
+  int n_discrete = distribution_.n_discrete(l);
+  e_out = distribution_.e_out(l);
+  const double* p = distribution_.p(l);
   double r1 = prn(seed);
-  double c_k = distribution_[l].c[0];
-  int k = 0;
-  int end = n_energy_out - 2;
-
-  // Discrete portion
-  for (int j = 0; j < n_discrete; ++j) {
-    k = j;
-    c_k = distribution_[l].c[k];
-    if (r1 < c_k) {
-      end = j;
-      break;
-    }
-  }
-
-  // Continuous portion
-  double c_k1;
-  for (int j = n_discrete; j < end; ++j) {
-    k = j;
-    c_k1 = distribution_[l].c[k + 1];
-    if (r1 < c_k1)
-      break;
-    k = j + 1;
-    c_k = c_k1;
-  }
-
-  double E_l_k = distribution_[l].e_out[k];
-  double p_l_k = distribution_[l].p[k];
-  if (distribution_[l].interpolation == Interpolation::histogram) {
+  auto bin = distribution_.find_bin(l, r1);
+  int k = bin.k;
+  double c_k = bin.c_k;
+  double c_k1 = bin.c_k1;
+
+  double E_l_k = e_out[k];
+  double p_l_k = p[k];
+  auto interpolation = distribution_.interpolation(l);
+  if (interpolation == Interpolation::histogram) {
     // Histogram interpolation
     if (p_l_k > 0.0 && k >= n_discrete) {
       E_out = E_l_k + (r1 - c_k) / p_l_k;
@@ -228,10 +186,10 @@ void CorrelatedAngleEnergy::sample(
       E_out = E_l_k;
     }
 
-  } else if (distribution_[l].interpolation == Interpolation::lin_lin) {
+  } else if (interpolation == Interpolation::lin_lin) {
     // Linear-linear interpolation
-    double E_l_k1 = distribution_[l].e_out[k + 1];
-    double p_l_k1 = distribution_[l].p[k + 1];
+    double E_l_k1 = e_out[k + 1];
+    double p_l_k1 = p[k + 1];
 
     double frac = (p_l_k1 - p_l_k) / (E_l_k1 - E_l_k);
     if (frac == 0.0) {
@@ -255,11 +213,11 @@ void CorrelatedAngleEnergy::sample(
   }
 
   // Find correlated angular distribution for closest outgoing energy bin
-  if (r1 - c_k < c_k1 - r1 ||
-      distribution_[l].interpolation == Interpolation::histogram) {
-    mu = distribution_[l].angle[k]->sample(seed);
+  int j = distribution_.start(l) + k;
+  if (r1 - c_k < c_k1 - r1 || interpolation == Interpolation::histogram) {
+    mu = angle_[j].sample(seed);
   } else {
-    mu = distribution_[l].angle[k + 1]->sample(seed);
+    mu = angle_[j + 1].sample(seed);
   }
 }
 
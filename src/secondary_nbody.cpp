@@ -22,6 +22,22 @@ NBodyPhaseSpace::NBodyPhaseSpace(hid_t group)
   read_attribute(group, "q_value", Q_);
 }
 
+NBodyPhaseSpace::NBodyPhaseSpace(CacheReader& cache)
+{
+  cache.read(n_bodies_);
+  cache.read(mass_ratio_);
+  cache.read(A_);
+  cache.read(Q_);
+}
+
+void NBodyPhaseSpace::serialize(CacheWriter& cache) const
+{
+  cache.write(n_bodies_);
+  cache.write(mass_ratio_);
+  cache.write(A_);
+  cache.write(Q_);
+}
+
 void NBodyPhaseSpace::sample(
   double E_in, double& E_out, double& mu, uint64_t* seed) const
 {
@@ -6,6 +6,7 @@
 
 #include <gsl/gsl-lite.hpp>
 
+#include "xtensor/xadapt.hpp"
 #include "xtensor/xview.hpp"
 
 #include <cmath> // for log, exp
@@ -216,29 +217,30 @@ IncoherentInelasticAE::IncoherentInelasticAE(hid_t group)
   energy_ = dist.energy();
 
   // Convert to S(a,b) native format
-  for (const auto& edist : dist.distribution()) {
+  const auto& tables = dist.distribution();
+  for (int i = 0; i < tables.size(); ++i) {
     // Create temporary distribution
     DistEnergySab d;
 
     // Copy outgoing energy distribution
-    d.n_e_out = edist.e_out.size();
-    d.e_out = edist.e_out;
-    d.e_out_pdf = edist.p;
-    d.e_out_cdf = edist.c;
+    d.n_e_out = tables.n(i);
+    array<size_t, 1> shape {d.n_e_out};
+    d.e_out = xt::adapt(tables.e_out(i), d.n_e_out, xt::no_ownership(), shape);
+    d.e_out_pdf = xt::adapt(tables.p(i), d.n_e_out, xt::no_ownership(), shape);
+    d.e_out_cdf = xt::adapt(tables.c(i), d.n_e_out, xt::no_ownership(), shape);
 
     for (int j = 0; j < d.n_e_out; ++j) {
-      auto adist = dynamic_cast<Tabular*>(edist.angle[j].get());
-      if (adist) {
-        // On first pass, allocate space for angles
-        if (j == 0) {
-          auto n_mu = adist->x().size();
-          d.mu = xt::empty<double>({d.n_e_out, n_mu});
-        }
-
-        // Copy outgoing angles
-        auto mu_j = xt::view(d.mu, j);
-        std::copy(adist->x().begin(), adist->x().end(), mu_j.begin());
+      const auto& adist = dist.angle(i, j);
+
+      // On first pass, allocate space for angles
+      if (j == 0) {
+        auto n_mu = adist.x().size();
+        d.mu = xt::empty<double>({d.n_e_out, n_mu});
       }
+
+      // Copy outgoing angles
+      auto mu_j = xt::view(d.mu, j);
+      std::copy(adist.x().begin(), adist.x().end(), mu_j.begin());
     }
 
     distribution_.emplace_back(std::move(d));
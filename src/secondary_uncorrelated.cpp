@@ -1,6 +1,7 @@
 #include "openmc/secondary_uncorrelated.h"
 
-#include <string> // for string
+#include <stdexcept> // for runtime_error
+#include <string>    // for string
 
 #include <fmt/core.h>
 
@@ -50,6 +51,74 @@ UncorrelatedAngleEnergy::UncorrelatedAngleEnergy(hid_t group)
   }
 }
 
+UncorrelatedAngleEnergy::UncorrelatedAngleEnergy(CacheReader& cache)
+  : angle_ {cache}
+{
+  switch (cache.read<CacheType>()) {
+  case CacheType::none:
+    break;
+  case CacheType::discrete_photon:
+    energy_ = make_unique<DiscretePhoton>(cache);
+    break;
+  case CacheType::level_inelastic:
+    energy_ = make_unique<LevelInelastic>(cache);
+    break;
+  case CacheType::continuous_tabular:
+    energy_ = make_unique<ContinuousTabular>(cache);
+    break;
+  case CacheType::maxwell_energy:
+    energy_ = make_unique<MaxwellEnergy>(cache);
+    break;
+  case CacheType::evaporation:
+    energy_ = make_unique<Evaporation>(cache);
+    break;
+  case CacheType::watt_energy:
+    energy_ = make_unique<WattEnergy>(cache);
+    break;
+  default:
+    throw std::runtime_error {
+      "Unknown energy distribution type in cross section cache"};
+  }
+}
+
+void UncorrelatedAngleEnergy::serialize(CacheWriter& cache) const
+{
+  angle_.serialize(cache);
+
+  // Write the type of the energy distribution followed by its data
+  const EnergyDistribution* energy = energy_.get();
+  if (!energy) {
+    cache.write(CacheType::none);
+  } else if (auto d = dynamic_cast<const DiscretePhoton*>(energy)) {
+    cache.write(CacheType::discrete_photon);
+    d->serialize(cache);
+  } else if (auto d = dynamic_cast<const LevelInelastic*>(energy)) {
+    cache.write(CacheType::level_inelastic);
+    d->serialize(cache);
+  } else if (auto d = dynamic_cast<const ContinuousTabular*>(energy)) {
+    cache.write(CacheType::continuous_tabular);
+    d->serialize(cache);
+  } else if (auto d = dynamic_cast<const MaxwellEnergy*>(energy)) {
+    cache.write(CacheType::maxwell_energy);
+    d->serialize(cache);
+  } else if (auto d = dynamic_cast<const Evaporation*>(energy)) {
+    cache.write(CacheType::evaporation);
+    d->serialize(cache);
+  } else if (auto d = dynamic_cast<const WattEnergy*>(energy)) {
+    cache.write(CacheType::watt_energy);
+    d->serialize(cache);
+  } else {
+    throw std::runtime_error {
+      "Energy distribution type cannot be written to the cross section cache"};
+  }
+}
+
+void UncorrelatedAngleEnergy::share_data()
+{
+  if (energy_)
+    energy_->share_data();
+}
+
 void UncorrelatedAngleEnergy::sample(
   double E_in, double& E_out, double& mu, uint64_t* seed) const
 {
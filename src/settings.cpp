@@ -43,8 +43,10 @@ namespace settings {
 
 // Default values for boolean flags
 bool assume_separate {false};
+bool banked_xs_lookup {false};
 bool check_overlaps {false};
 bool cmfd_run {false};
+bool compact_source_sites {false};
 bool confidence_intervals {false};
 bool create_delayed_neutrons {true};
 bool create_fission_neutrons {true};
@@ -57,6 +59,7 @@ bool output_summary {true};
 bool output_tallies {true};
 bool particle_restart_run {false};
 bool photon_transport {false};
+bool private_tally_buffers {false};
 bool reduce_tallies {true};
 bool res_scat_on {false};
 bool restart_run {false};
@@ -64,7 +67,10 @@ bool run_CE {true};
 bool source_latest {false};
 bool source_separate {false};
 bool source_write {true};
+bool shared_nuclear_data {false};
+bool sort_xs_queues {false};
 bool source_mcpl_write {false};
+bool statepoint_async {false};
 bool surf_source_write {false};
 bool surf_mcpl_write {false};
 bool surf_source_read {false};
@@ -86,6 +92,7 @@ std::string path_output;
 std::string path_particle_restart;
 std::string path_sourcepoint;
 std::string path_statepoint;
+std::string path_xs_cache;
 const char* path_statepoint_c {path_statepoint.c_str()};
 std::string weight_windows_file;
 
@@ -101,6 +108,7 @@ int max_particle_events {1000000};
 
 ElectronTreatment electron_treatment {ElectronTreatment::TTB};
 array<double, 4> energy_cutoff {0.0, 1000.0, 0.0, 0.0};
+EnergyGridMethod energy_grid_method {EnergyGridMethod::LOGARITHM};
 array<double, 4> time_cutoff {INFTY, INFTY, INFTY, INFTY};
 int legendre_to_tabular_points {C_NONE};
 int max_order {0};
@@ -109,6 +117,10 @@ int n_batches;
 int n_max_batches;
 int max_splits {1000};
 int max_tracks {1000};
+int track_compression {0};
+int64_t neighbor_list_rays {0};
+PartitionerType partitioner_type {PartitionerType::ZPLANE};
+std::unordered_map<int32_t, PartitionerType> universe_partitioners;
 ResScatMethod res_scat_method {ResScatMethod::rvs};
 double res_scat_energy_min {0.01};
 double res_scat_energy_max {1000.0};
@@ -131,6 +143,7 @@ int trigger_batch_interval {1};
 int verbosity {7};
 double weight_cutoff {0.25};
 double weight_survive {1.0};
+double tally_buffer_memory {1024.0};
 
 } // namespace settings
 
@@ -493,6 +506,20 @@ void read_settings_xml(pugi::xml_node root)
     }
   }
 
+  // Method for accelerating energy grid searches
+  if (check_for_node(root, "energy_grid")) {
+    auto temp_str = get_node_value(root, "energy_grid", true, true);
+    if (temp_str == "logarithm") {
+      energy_grid_method = EnergyGridMethod::LOGARITHM;
+    } else if (temp_str == "material-union") {
+      energy_grid_method = EnergyGridMethod::MATERIAL_UNION;
+    } else if (temp_str == "hash") {
+      energy_grid_method = EnergyGridMethod::HASH;
+    } else {
+      fatal_error("Unrecognized energy grid method: " + temp_str + ".");
+    }
+  }
+
   // Number of OpenMP threads
   if (check_for_node(root, "threads")) {
     if (mpi::master)
@@ -689,6 +716,18 @@ void read_settings_xml(pugi::xml_node root)
       // If neither were specified, write state point at last batch
       statepoint_batch.insert(n_batches);
     }
+
+    // Check if state points should be written by a background thread
+    if (check_for_node(node_sp, "async")) {
+      statepoint_async = get_node_value_bool(node_sp, "async");
+#ifdef PHDF5
+      if (statepoint_async) {
+        warning("State points cannot be written in the background when using "
+                "parallel HDF5.");
+        statepoint_async = false;
+      }
+#endif
+    }
   } else {
     // If no <state_point> tag was present, by default write state point at
     // last batch only
@@ -787,6 +826,23 @@ void read_settings_xml(pugi::xml_node root)
     reduce_tallies = !get_node_value_bool(root, "no_reduce");
   }
 
+  // Check whether to accumulate tally results in thread-private buffers
+  if (check_for_node(root, "private_tally_buffers")) {
+    private_tally_buffers = get_node_value_bool(root, "private_tally_buffers");
+  }
+  if (check_for_node(root, "tally_buffer_memory")) {
+    tally_buffer_memory =
+      std::stod(get_node_value(root, "tally_buffer_memory"));
+    if (tally_buffer_memory < 0.0) {
+      fatal_error("Tally buffer memory limit must be non-negative.");
+    }
+  }
+
+  // Check whether source sites are sent between processes in single precision
+  if (check_for_node(root, "compact_source_sites")) {
+    compact_source_sites = get_node_value_bool(root, "compact_source_sites");
+  }
+
   // Check if the user has specified to use confidence intervals for
   // uncertainties rather than standard deviations
   if (check_for_node(root, "confidence_intervals")) {
@@ -953,6 +1009,33 @@ void read_settings_xml(pugi::xml_node root)
     event_based = get_node_value_bool(root, "event_based");
   }
 
+  // Check whether to use banked cross section lookups in event-based mode
+  if (check_for_node(root, "banked_xs_lookup")) {
+    banked_xs_lookup = get_node_value_bool(root, "banked_xs_lookup");
+  }
+
+  // Check whether to sort cross section lookup queues in event-based mode
+  if (check_for_node(root, "sort_xs_queues")) {
+    sort_xs_queues = get_node_value_bool(root, "sort_xs_queues");
+  }
+
+  // Check whether to store nuclear data once for all processes on a node
+  if (check_for_node(root, "shared_nuclear_data")) {
+    shared_nuclear_data = get_node_value_bool(root, "shared_nuclear_data");
+  }
+
+  // Check for a directory in which nuclear data are cached
+  if (check_for_node(root, "cross_section_cache")) {
+    path_xs_cache = get_node_value(root, "cross_section_cache");
+    if (!ends_with(path_xs_cache, "/")) {
+      path_xs_cache += "/";
+    }
+    if (!dir_exists(path_xs_cache)) {
+      fatal_error(fmt::format(
+        "Cross section cache directory '{}' does not exist.", path_xs_cache));
+    }
+  }
+
   // Check whether material cell offsets should be generated
   if (check_for_node(root, "material_cell_offsets")) {
     material_cell_offsets = get_node_value_bool(root, "material_cell_offsets");
@@ -987,6 +1070,44 @@ void read_settings_xml(pugi::xml_node root)
     settings::max_tracks = std::stoi(get_node_value(root, "max_tracks"));
   }
 
+  if (check_for_node(root, "track_compression")) {
+    settings::track_compression =
+      std::stoi(get_node_value(root, "track_compression"));
+    if (settings::track_compression < 0 || settings::track_compression > 9) {
+      fatal_error("Track compression level must be between 0 and 9.");
+    }
+  }
+
+  if (check_for_node(root, "neighbor_list_rays")) {
+    settings::neighbor_list_rays =
+      std::stoll(get_node_value(root, "neighbor_list_rays"));
+    if (settings::neighbor_list_rays < 0) {
+      fatal_error("Number of neighbor list rays must be non-negative.");
+    }
+  }
+
+  // Methods for partitioning universes, either by default or per universe
+  for (pugi::xml_node node : root.children("universe_partitioner")) {
+    auto method = get_node_value(node, "method", true, true);
+    PartitionerType type;
+    if (method == "none") {
+      type = PartitionerType::NONE;
+    } else if (method == "z-plane") {
+      type = PartitionerType::ZPLANE;
+    } else if (method == "octree") {
+      type = PartitionerType::OCTREE;
+    } else {
+      fatal_error("Unrecognized universe partitioning method: " + method);
+    }
+
+    if (check_for_node(node, "universe")) {
+      settings::universe_partitioners[std::stoi(
+        get_node_value(node, "universe"))] = type;
+    } else {
+      settings::partitioner_type = type;
+    }
+  }
+
   // Create weight window generator objects
   if (check_for_node(root, "weight_window_generators")) {
     auto wwgs_node = root.child("weight_window_generators");
@@ -6,9 +6,11 @@
 #include "openmc/eigenvalue.h"
 #include "openmc/error.h"
 #include "openmc/event.h"
+#include "openmc/geometry.h"
 #include "openmc/geometry_aux.h"
 #include "openmc/material.h"
 #include "openmc/mcpl_interface.h"
+#include "openmc/mesh_traversal.h"
 #include "openmc/message_passing.h"
 #include "openmc/nuclide.h"
 #include "openmc/output.h"
@@ -108,6 +110,7 @@ int openmc_simulation_init()
     t->set_strides();
     t->init_results();
   }
+  init_tally_buffers();
 
   // Set up material nuclide index mapping
   for (auto& mat : model::materials) {
@@ -134,6 +137,11 @@ int openmc_simulation_init()
     }
   }
 
+  // Trace rays to populate neighbor lists before transport
+  if (settings::solver_type == SolverType::MONTE_CARLO) {
+    prepopulate_neighbor_lists();
+  }
+
   // Display header
   if (mpi::master) {
     if (settings::run_mode == RunMode::FIXED_SOURCE) {
@@ -154,6 +162,10 @@ int openmc_simulation_init()
     openmc_weight_windows_import(settings::weight_windows_file.c_str());
   }
 
+  // Find the meshes whose traversals are shared by mesh filters and weight
+  // windows
+  prepare_mesh_traversal_caches();
+
   // Set flag indicating initialization is done
   simulation::initialized = true;
   return 0;
@@ -181,11 +193,34 @@ int openmc_simulation_finalize()
     close_track_file();
   }
 
+  // Wait for state point and source files that are being written in the
+  // background
+  simulation::time_statepoint.start();
+  flush_state_points();
+  simulation::time_statepoint.stop();
+
   // Increment total number of generations
   simulation::total_gen += simulation::current_batch * settings::gen_per_batch;
 
+  simulation::time_tallies.start();
+  finish_tally_reduction();
+  simulation::time_tallies.stop();
+
 #ifdef OPENMC_MPI
   broadcast_results();
+
+  // Sum the source site data moved and the mesh traversal cache lookups of
+  // all processes
+  int64_t counts[] {simulation::bank_bytes_sent, simulation::bank_bytes_copied,
+    simulation::mesh_traversal_hits, simulation::mesh_traversal_misses};
+  MPI_Reduce(mpi::master ? MPI_IN_PLACE : counts, counts, 4, MPI_INT64_T,
+    MPI_SUM, 0, mpi::intracomm);
+  if (mpi::master) {
+    simulation::bank_bytes_sent = counts[0];
+    simulation::bank_bytes_copied = counts[1];
+    simulation::mesh_traversal_hits = counts[2];
+    simulation::mesh_traversal_misses = counts[3];
+  }
 #endif
 
   // Write tally results to tallies.out
@@ -380,6 +415,14 @@ void finalize_batch()
   // Reduce tallies onto master process and accumulate
   simulation::time_tallies.start();
   accumulate_tallies();
+
+  // Tally results are needed right away to update weight windows and check
+  // triggers. Otherwise, their reduction finishes during the next batch.
+  if (!variance_reduction::weight_windows_generators.empty() ||
+      (settings::trigger_on &&
+        simulation::current_batch >= settings::n_batches)) {
+    finish_tally_reduction();
+  }
   simulation::time_tallies.stop();
 
   // update weight windows if needed
@@ -405,6 +448,16 @@ void finalize_batch()
     settings::statepoint_batch.insert(simulation::current_batch);
   }
 
+  // Statepoints and source points need the complete source bank
+  if (settings::run_mode == RunMode::EIGENVALUE) {
+    finish_bank_exchange();
+  }
+
+  // Make sure tracks from this batch are written before any other output
+  if (!settings::track_identifiers.empty() || settings::write_all_tracks) {
+    flush_particle_tracks();
+  }
+
   // Write out state point if it's been specified for this batch and is not
   // a CMFD run instance
   if (contains(settings::statepoint_batch, simulation::current_batch) &&
@@ -412,10 +465,9 @@ void finalize_batch()
     if (contains(settings::sourcepoint_batch, simulation::current_batch) &&
         settings::source_write && !settings::source_separate) {
       bool b = (settings::run_mode == RunMode::EIGENVALUE);
-      openmc_statepoint_write(nullptr, &b);
+      write_state_point(nullptr, b, settings::statepoint_async);
     } else {
-      bool b = false;
-      openmc_statepoint_write(nullptr, &b);
+      write_state_point(nullptr, false, settings::statepoint_async);
     }
   }
 
@@ -433,8 +485,8 @@ void finalize_batch()
         write_mcpl_source_point(
           source_point_filename.c_str(), bankspan, simulation::work_index);
       } else {
-        write_source_point(
-          source_point_filename.c_str(), bankspan, simulation::work_index);
+        write_source_point(source_point_filename.c_str(), bankspan,
+          simulation::work_index, settings::statepoint_async);
       }
     }
 
@@ -448,7 +500,8 @@ void finalize_batch()
         write_mcpl_source_point(
           filename.c_str(), bankspan, simulation::work_index);
       } else {
-        write_source_point(filename.c_str(), bankspan, simulation::work_index);
+        write_source_point(filename.c_str(), bankspan, simulation::work_index,
+          settings::statepoint_async);
       }
     }
   }
@@ -464,7 +517,8 @@ void finalize_batch()
     if (settings::surf_mcpl_write) {
       write_mcpl_source_point(filename.c_str(), surfbankspan, surf_work_index);
     } else {
-      write_source_point(filename.c_str(), surfbankspan, surf_work_index);
+      write_source_point(filename.c_str(), surfbankspan, surf_work_index,
+        settings::statepoint_async);
     }
   }
 }
@@ -472,6 +526,9 @@ void finalize_batch()
 void initialize_generation()
 {
   if (settings::run_mode == RunMode::EIGENVALUE) {
+    // Receive source sites still in flight from the last generation
+    finish_bank_exchange();
+
     // Clear out the fission bank
     simulation::fission_bank.resize(0);
 
@@ -698,13 +755,49 @@ void initialize_data()
   }
 
   // Set up logarithmic grid for nuclides
-  for (auto& nuc : data::nuclides) {
-    nuc->init_grid();
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < data::nuclides.size(); ++i) {
+    data::nuclides[i]->init_grid();
   }
   int neutron = static_cast<int>(ParticleType::neutron);
   simulation::log_spacing =
     std::log(data::energy_max[neutron] / data::energy_min[neutron]) /
     settings::n_log_bins;
+
+  // Set up unionized grid for each material
+  size_t grid_memory = 0;
+  if (settings::energy_grid_method == EnergyGridMethod::MATERIAL_UNION) {
+#pragma omp parallel for schedule(dynamic) reduction(+ : grid_memory)
+    for (int i = 0; i < model::materials.size(); ++i) {
+      model::materials[i]->init_union_grid();
+      grid_memory += model::materials[i]->union_grid_memory();
+    }
+  }
+
+  // Report memory used for accelerating energy grid searches
+  for (const auto& nuc : data::nuclides) {
+    grid_memory += nuc->grid_search_memory();
+  }
+  write_message(6, "Energy grid search data: {:.3f} MB",
+    grid_memory / (1024.0 * 1024.0));
+
+  // Report memory used by the microscopic cross section cache of a particle,
+  // which only holds the nuclides of one material at a time
+  size_t max_nuclides = 0;
+  for (const auto& mat : model::materials) {
+    max_nuclides = std::max(max_nuclides, mat->nuclide_.size());
+  }
+  size_t cache_memory =
+    (NEUTRON_XS_EXTRA_SLOTS + max_nuclides) * sizeof(NuclideMicroXS);
+  write_message(6, "Microscopic cross section cache: {:.3f} kB per particle",
+    cache_memory / 1024.0);
+  if (settings::event_based) {
+    write_message(6,
+      "Microscopic cross section cache: {:.3f} MB for up to {} particles in "
+      "flight",
+      cache_memory * settings::max_particles_in_flight / (1024.0 * 1024.0),
+      settings::max_particles_in_flight);
+  }
 }
 
 #ifdef OPENMC_MPI
@@ -712,6 +805,10 @@ void broadcast_results()
 {
   // Broadcast tally results so that each process has access to results
   for (auto& t : model::tallies) {
+    // Results of decomposed tallies stay on the processes storing them
+    if (t->decompose_)
+      continue;
+
     // Create a new datatype that consists of all values for a given filter
     // bin and then use that to broadcast. This is done to minimize the
     // chance of the 'count' argument of MPI_BCAST exceeding 2**31
@@ -4,7 +4,11 @@
 #define HAS_DYNAMIC_LINKING
 #endif
 
-#include <algorithm> // for move
+#include <algorithm> // for move, min
+#include <cstring>   // for strcmp, strlen
+#include <iterator>  // for back_inserter
+#include <numeric>   // for accumulate
+#include <unordered_map>
 
 #ifdef HAS_DYNAMIC_LINKING
 #include <dlfcn.h> // for dlopen, dlsym, dlclose, dlerror
@@ -33,6 +37,7 @@
 #include "openmc/simulation.h"
 #include "openmc/state_point.h"
 #include "openmc/string_utils.h"
+#include "openmc/timer.h"
 #include "openmc/xml_interface.h"
 
 namespace openmc {
@@ -270,6 +275,8 @@ IndependentSource::IndependentSource(pugi::xml_node node) : Source(node)
       particle_ = ParticleType::neutron;
     } else if (temp_str == "photon") {
       particle_ = ParticleType::photon;
+      // Sources of mesh elements may be created concurrently
+#pragma omp atomic write
       settings::photon_transport = true;
     } else {
       fatal_error(std::string("Unknown source particle type: ") + temp_str);
@@ -524,29 +531,257 @@ CompiledSourceWrapper::~CompiledSourceWrapper()
 // MeshSource implementation
 //==============================================================================
 
+namespace {
+
+//! Append a string to a key, preceded by its length so that the boundaries
+//! between strings are unambiguous
+void append_key_string(const char* s, std::string& key)
+{
+  fmt::format_to(std::back_inserter(key), "{}:", std::strlen(s));
+  key += s;
+}
+
+double append_key(pugi::xml_node node, std::string& key);
+
+//! Append the attributes and children of an XML element to a key
+//! \param[in] node  XML element
+//! \param[inout] key  Key to append to
+//! \param[in] skip  Name of an attribute or child that is left out
+void append_key_contents(
+  pugi::xml_node node, std::string& key, const char* skip = "")
+{
+  key += '(';
+  for (auto attr : node.attributes()) {
+    if (std::strcmp(attr.name(), skip) != 0) {
+      append_key_string(attr.name(), key);
+      append_key_string(attr.value(), key);
+    }
+  }
+  key += ';';
+  for (auto child : node.children()) {
+    if (child.type() == pugi::node_element) {
+      if (std::strcmp(child.name(), skip) != 0)
+        append_key(child, key);
+    } else if (child.type() == pugi::node_pcdata ||
+               child.type() == pugi::node_cdata) {
+      append_key_string(child.value(), key);
+    }
+  }
+  key += ')';
+}
+
+//! Append a description of an XML element to a key that identifies a source.
+//! Univariate distributions are described such that distributions differing
+//! only by a constant factor in their probabilities, which are normalized
+//! when the distributions are created, have the same description.
+//
+//! \param[in] node  XML element
+//! \param[inout] key  Key to append to
+//! \return Sum of the probabilities of a discrete or tabular distribution as
+//!   given, by which its integral scales, and one for any other element
+double append_key(pugi::xml_node node, std::string& key)
+{
+  append_key_string(node.name(), key);
+
+  std::string type;
+  if (check_for_node(node, "type"))
+    type = get_node_value(node, "type", true, true);
+
+  if ((type == "discrete" || type == "tabular") &&
+      check_for_node(node, "parameters")) {
+    auto params = get_node_array<double>(node, "parameters");
+    size_t n = params.size() / 2;
+    double sum =
+      std::accumulate(params.begin() + n, params.begin() + 2 * n, 0.0);
+    double norm = sum > 0.0 ? sum : 1.0;
+
+    // Probabilities are compared to 12 significant digits since the
+    // normalized probabilities of scaled distributions may differ in the last
+    // bits
+    append_key_contents(node, key, "parameters");
+    key += '[';
+    for (size_t i = 0; i < n; ++i) {
+      fmt::format_to(std::back_inserter(key), "{} ", params[i]);
+    }
+    for (size_t i = n; i < params.size(); ++i) {
+      fmt::format_to(std::back_inserter(key), "{:.12g} ", params[i] / norm);
+    }
+    key += ']';
+    return sum;
+  }
+
+  if (type == "mixture") {
+    // Mixture weights each pair by its probability times the integral of its
+    // distribution, so the same is done with the sums of the probabilities
+    vector<double> weights;
+    vector<std::string> keys;
+    bool valid = true;
+    for (auto pair : node.children("pair")) {
+      if (!pair.attribute("probability") || !pair.child("dist")) {
+        valid = false;
+        break;
+      }
+      keys.emplace_back();
+      double sum = append_key(pair.child("dist"), keys.back());
+      weights.push_back(pair.attribute("probability").as_double() * sum);
+    }
+
+    // Invalid mixtures are described as they are so that the error is
+    // reported when the distribution is created
+    if (valid) {
+      double total = std::accumulate(weights.begin(), weights.end(), 0.0);
+      double norm = total > 0.0 ? total : 1.0;
+      key += "(mixture";
+      for (size_t i = 0; i < weights.size(); ++i) {
+        fmt::format_to(std::back_inserter(key), " {:.12g} ", weights[i] / norm);
+        key += keys[i];
+      }
+      key += ')';
+      return 1.0;
+    }
+  }
+
+  append_key_contents(node, key);
+  return 1.0;
+}
+
+//! Determine a key that is the same for sources that only differ in their
+//! strength or by a constant factor in the probabilities of their
+//! distributions
+std::string source_key(pugi::xml_node node)
+{
+  std::string key;
+  append_key_contents(node, key, "strength");
+  return key;
+}
+
+//! Determine whether Source::create makes an independent source from a node
+bool is_independent_source(pugi::xml_node node)
+{
+  if (check_for_node(node, "type"))
+    return get_node_value(node, "type") == "independent";
+  return !check_for_node(node, "file") && !check_for_node(node, "library");
+}
+
+} // namespace
+
 MeshSource::MeshSource(pugi::xml_node node) : Source(node)
 {
+  Timer timer;
+  timer.start();
+
   int32_t mesh_id = stoi(get_node_value(node, "mesh"));
   int32_t mesh_idx = model::mesh_map.at(mesh_id);
   const auto& mesh = model::meshes[mesh_idx];
 
-  std::vector<double> strengths;
-  // read all source distributions and populate strengths vector for MeshSpatial
-  // object
+  vector<pugi::xml_node> nodes;
   for (auto source_node : node.children("source")) {
-    sources_.emplace_back(Source::create(source_node));
-    strengths.push_back(sources_.back()->strength());
+    nodes.push_back(source_node);
   }
 
   // the number of source distributions should either be one or equal to the
   // number of mesh elements
-  if (sources_.size() > 1 && sources_.size() != mesh->n_bins()) {
+  int64_t n = nodes.size();
+  if (n > 1 && n != mesh->n_bins()) {
     fatal_error(fmt::format("Incorrect number of source distributions ({}) for "
                             "mesh source with {} elements.",
-      sources_.size(), mesh->n_bins()));
+      n, mesh->n_bins()));
+  }
+
+  // Determine which elements can share a source. The keys of the sources are
+  // determined in parallel for one block of elements at a time so that only
+  // the keys of distinct sources are kept. Exceptions cannot leave a parallel
+  // region, so invalid strengths are recorded for each element and reported
+  // after the loop.
+  constexpr int64_t block_size {1 << 16};
+  vector<double> strengths(n);
+  vector<std::string> keys(std::min(n, block_size));
+  vector<std::string> errors(std::min(n, block_size));
+  vector<pugi::xml_node> distinct;
+  std::unordered_map<std::string, int32_t> key_index;
+  source_index_.resize(n);
+  for (int64_t start = 0; start < n; start += block_size) {
+    int64_t end = std::min(start + block_size, n);
+#pragma omp parallel for schedule(dynamic, 64)
+    for (int64_t i = start; i < end; ++i) {
+      keys[i - start] = source_key(nodes[i]);
+      try {
+        strengths[i] = check_for_node(nodes[i], "strength")
+                         ? std::stod(get_node_value(nodes[i], "strength"))
+                         : 1.0;
+      } catch (const std::exception&) {
+        errors[i - start] =
+          fmt::format("Invalid strength '{}' of source {} of mesh source.",
+            get_node_value(nodes[i], "strength"), i);
+      }
+    }
+
+    for (int64_t i = start; i < end; ++i) {
+      if (!errors[i - start].empty()) {
+        fatal_error(errors[i - start]);
+      }
+      if (strengths[i] < 0.0) {
+        fatal_error("Source strength is negative.");
+      }
+      int32_t index = distinct.size();
+      auto result = key_index.emplace(std::move(keys[i - start]), index);
+      if (result.second) {
+        distinct.push_back(nodes[i]);
+      }
+      source_index_[i] = result.first->second;
+    }
+  }
+  key_index.clear();
+  keys.clear();
+  errors.clear();
+
+  // Create the distinct sources. Only independent sources are created in
+  // parallel since other kinds of sources may read files. Exceptions are
+  // recorded for each source and reported after the loop. Input errors found
+  // while reading an independent source that call fatal_error() or warning()
+  // directly are written by the worker thread that reads it, so the run is
+  // aborted from that thread and warnings of different sources may appear in
+  // any order.
+  int32_t n_distinct = distinct.size();
+  sources_.resize(n_distinct);
+  errors.resize(n_distinct);
+#pragma omp parallel for schedule(dynamic)
+  for (int32_t i = 0; i < n_distinct; ++i) {
+    if (is_independent_source(distinct[i])) {
+      try {
+        sources_[i] = make_unique<IndependentSource>(distinct[i]);
+      } catch (const std::exception& e) {
+        errors[i] = e.what();
+      }
+    }
+  }
+  for (int32_t i = 0; i < n_distinct; ++i) {
+    if (!errors[i].empty()) {
+      fatal_error(fmt::format(
+        "Could not create a source of mesh source: {}", errors[i]));
+    }
+    if (!sources_[i]) {
+      sources_[i] = Source::create(distinct[i]);
+    }
+  }
+  errors.clear();
+  if (n_distinct == 1) {
+    source_index_.clear();
+    source_index_.shrink_to_fit();
   }
 
   space_ = std::make_unique<MeshSpatial>(mesh_idx, strengths);
+
+  // Report the sharing of sources along with the memory used for each element
+  const auto& dist = space_->element_distribution();
+  size_t element_memory = source_index_.size() * sizeof(int32_t) +
+                          dist.prob().size() * sizeof(double) +
+                          dist.alias().size() * sizeof(size_t);
+  write_message(6,
+    "Mesh source with {} elements: {} distinct element sources, {:.3f} MB of "
+    "element data, created in {:.3f} s",
+    mesh->n_bins(), n_distinct, element_memory / (1024.0 * 1024.0),
+    timer.elapsed());
 }
 
 SourceSite MeshSource::sample(uint64_t* seed) const
@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <cstdint> // for int64_t
+#include <fstream>
+#include <future>
 #include <string>
 
 #include "xtensor/xbuilder.hpp" // for empty_like
@@ -31,10 +33,105 @@
 
 namespace openmc {
 
+//==============================================================================
+// Background writing of state point and source point files
+//==============================================================================
+
+namespace {
+
+//! Amount by which the memory of an in-memory HDF5 file grows
+constexpr size_t FILE_IMAGE_INCREMENT {1 << 26};
+
+//! Write of the last file handed to the background writer. Its value is an
+//! error message, or empty if the file was written successfully.
+std::future<std::string> file_image_write;
+
+//! Create an HDF5 file that is assembled in memory and only written to disk
+//! when it is closed with file_close_background
+hid_t file_open_memory(const std::string& filename)
+{
+  hid_t plist = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fapl_core(plist, FILE_IMAGE_INCREMENT, false);
+  hid_t file_id =
+    H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plist);
+  H5Pclose(plist);
+  if (file_id < 0) {
+    fatal_error("Failed to create in-memory HDF5 file: " + filename);
+  }
+  return file_id;
+}
+
+std::string write_file_image(std::string filename, vector<char> image)
+{
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+  file.write(image.data(), image.size());
+  file.close();
+  if (!file) {
+    return "Failed to write " + filename;
+  }
+  return {};
+}
+
+//! Close a file created by file_open_memory and write it to disk on a
+//! background thread
+void file_close_background(hid_t file_id, const std::string& filename)
+{
+  H5Fflush(file_id, H5F_SCOPE_GLOBAL);
+  ssize_t size = H5Fget_file_image(file_id, nullptr, 0);
+  if (size < 0) {
+    fatal_error("Failed to get image of in-memory HDF5 file: " + filename);
+  }
+  vector<char> image(size);
+  H5Fget_file_image(file_id, image.data(), size);
+  file_close(file_id);
+
+  // Files are written one at a time so that at most one image is held in
+  // memory while the next one is assembled
+  flush_state_points();
+  file_image_write = std::async(
+    std::launch::async, write_file_image, filename, std::move(image));
+}
+
+} // namespace
+
+void flush_state_points()
+{
+  if (file_image_write.valid()) {
+    std::string error = file_image_write.get();
+    if (!error.empty()) {
+      fatal_error(error);
+    }
+  }
+}
+
 extern "C" int openmc_statepoint_write(const char* filename, bool* write_source)
 {
+  // Determine whether or not to write the source bank
+  bool write_source_ = write_source ? *write_source : true;
+
+  write_state_point(filename, write_source_, false);
+  return 0;
+}
+
+void write_state_point(const char* filename, bool write_source, bool background)
+{
+  // Tally results written to the file must be complete
+  simulation::time_tallies.start();
+  finish_tally_reduction();
+  simulation::time_tallies.stop();
+
   simulation::time_statepoint.start();
 
+  // Assembling the file in memory would gather the results of decomposed
+  // tallies on the master process, so they are written directly instead
+  bool decomposed = false;
+  for (const auto& tally : model::tallies) {
+    if (tally->decompose_)
+      decomposed = true;
+  }
+  if (decomposed)
+    background = false;
+
   // If a nullptr is passed in, we assume that the user
   // wants a default name for this, of the form like output/statepoint.20.h5
   std::string filename_;
@@ -58,16 +155,14 @@ extern "C" int openmc_statepoint_write(const char* filename, bool* write_source)
             "from .h5, but an hdf5 file will be written.");
   }
 
-  // Determine whether or not to write the source bank
-  bool write_source_ = write_source ? *write_source : true;
-
   // Write message
   write_message("Creating state point " + filename_ + "...", 5);
 
   hid_t file_id;
   if (mpi::master) {
-    // Create statepoint file
-    file_id = file_open(filename_, 'w');
+    // Create statepoint file, in memory if it is written in the background
+    file_id =
+      background ? file_open_memory(filename_) : file_open(filename_, 'w');
 
     // Write file type
     write_attribute(file_id, "filetype", "statepoint");
@@ -111,7 +206,7 @@ extern "C" int openmc_statepoint_write(const char* filename, bool* write_source)
     write_dataset(file_id, "current_batch", simulation::current_batch);
 
     // Indicate whether source bank is stored in statepoint
-    write_attribute(file_id, "source_present", write_source_);
+    write_attribute(file_id, "source_present", write_source);
 
     // Write out information for eigenvalue run
     if (settings::run_mode == RunMode::EIGENVALUE)
@@ -260,7 +355,7 @@ extern "C" int openmc_statepoint_write(const char* filename, bool* write_source)
 
         // Write all tally results
         for (const auto& tally : model::tallies) {
-          if (!tally->writable_)
+          if (!tally->writable_ || tally->decompose_)
             continue;
           // Write sum and sum_sq for each bin
           std::string name = "tally " + std::to_string(tally->id_);
@@ -320,7 +415,8 @@ extern "C" int openmc_statepoint_write(const char* filename, bool* write_source)
       runtime_group, "writing statepoints", time_statepoint.elapsed());
     close_group(runtime_group);
 
-    file_close(file_id);
+    if (!background)
+      file_close(file_id);
   }
 
 #ifdef PHDF5
@@ -329,23 +425,50 @@ extern "C" int openmc_statepoint_write(const char* filename, bool* write_source)
   bool parallel = false;
 #endif
 
-  // Write the source bank if desired
-  if (write_source_) {
+  // Write the results of decomposed tallies, which are never all held by a
+  // single process
+  if (decomposed && !model::active_tallies.empty()) {
     if (mpi::master || parallel)
       file_id = file_open(filename_, 'a', true);
-    write_source_bank(file_id, simulation::source_bank, simulation::work_index);
+    hid_t tallies_group;
     if (mpi::master || parallel)
+      tallies_group = open_group(file_id, "tallies");
+    for (const auto& tally : model::tallies) {
+      if (!tally->writable_ || !tally->decompose_)
+        continue;
+      hid_t tally_group;
+      std::string name = "tally " + std::to_string(tally->id_);
+      if (mpi::master || parallel)
+        tally_group = open_group(tallies_group, name.c_str());
+      write_tally_results_decomposed(tally_group, *tally);
+      if (mpi::master || parallel)
+        close_group(tally_group);
+    }
+    if (mpi::master || parallel) {
+      close_group(tallies_group);
       file_close(file_id);
+    }
   }
 
+  // Write the source bank if desired
+  if (write_source) {
+    if (!background && (mpi::master || parallel))
+      file_id = file_open(filename_, 'a', true);
+    write_source_bank(file_id, simulation::source_bank, simulation::work_index);
+    if (!background && (mpi::master || parallel))
+      file_close(file_id);
+  }
+
+  // Hand the file assembled in memory to the background writer
+  if (background && mpi::master)
+    file_close_background(file_id, filename_);
+
 #if defined(LIBMESH) || defined(DAGMC)
   // write unstructured mesh tally files
   write_unstructured_mesh_results();
 #endif
 
   simulation::time_statepoint.stop();
-
-  return 0;
 }
 
 void restart_set_keff()
@@ -488,6 +611,9 @@ extern "C" int openmc_statepoint_load(const char* filename)
       hid_t tallies_group = open_group(file_id, "tallies");
 
       for (auto& tally : model::tallies) {
+        if (tally->decompose_)
+          continue;
+
         // Read sum, sum_sq, and N for each bin
         std::string name = "tally " + std::to_string(tally->id_);
         hid_t tally_group = open_group(tallies_group, name.c_str());
@@ -510,6 +636,24 @@ extern "C" int openmc_statepoint_load(const char* filename)
     }
   }
 
+  // Every process reads its own block of the results of decomposed tallies
+  bool tallies_present = false;
+  if (attribute_exists(file_id, "tallies_present"))
+    read_attribute(file_id, "tallies_present", tallies_present);
+  if (tallies_present) {
+    hid_t tallies_group = open_group(file_id, "tallies");
+    for (auto& tally : model::tallies) {
+      if (!tally->decompose_)
+        continue;
+      std::string name = "tally " + std::to_string(tally->id_);
+      hid_t tally_group = open_group(tallies_group, name.c_str());
+      read_tally_results_decomposed(tally_group, *tally);
+      read_dataset(tally_group, "n_realizations", tally->n_realizations_);
+      close_group(tally_group);
+    }
+    close_group(tallies_group);
+  }
+
   // Read source if in eigenvalue mode
   if (settings::run_mode == RunMode::EIGENVALUE) {
 
@@ -569,7 +713,7 @@ hid_t h5banktype()
 }
 
 void write_source_point(const char* filename, gsl::span<SourceSite> source_bank,
-  const vector<int64_t>& bank_index)
+  const vector<int64_t>& bank_index, bool background)
 {
   // When using parallel HDF5, the file is written to collectively by all
   // processes. With MPI-only, the file is opened and written by the master
@@ -595,15 +739,21 @@ void write_source_point(const char* filename, gsl::span<SourceSite> source_bank,
 
   hid_t file_id;
   if (mpi::master || parallel) {
-    file_id = file_open(filename_.c_str(), 'w', true);
+    file_id = background ? file_open_memory(filename_)
+                         : file_open(filename_.c_str(), 'w', true);
     write_attribute(file_id, "filetype", "source");
   }
 
   // Get pointer to source bank and write to file
   write_source_bank(file_id, source_bank, bank_index);
 
-  if (mpi::master || parallel)
-    file_close(file_id);
+  if (mpi::master || parallel) {
+    if (background) {
+      file_close_background(file_id, filename_);
+    } else {
+      file_close(file_id);
+    }
+  }
 }
 
 void write_source_bank(hid_t group_id, gsl::span<SourceSite> source_bank,
@@ -716,6 +866,138 @@ std::string dtype_member_names(hid_t dtype_id)
   return names;
 }
 
+void write_tally_results_decomposed(hid_t group_id, const Tally& tally)
+{
+  const auto& results {tally.results_};
+  const auto& bin_index {tally.bin_index()};
+  hsize_t n_scores = results.shape(1);
+
+  // Only the sum and sum of squares of each block are written
+  auto select_block = [n_scores](hid_t dspace, hsize_t first, hsize_t n) {
+    hsize_t start[] {first, 0, 0};
+    hsize_t count[] {n, n_scores, 2};
+    if (n > 0) {
+      H5Sselect_hyperslab(
+        dspace, H5S_SELECT_SET, start, nullptr, count, nullptr);
+    } else {
+      H5Sselect_none(dspace);
+    }
+  };
+  auto block_memspace = [n_scores](hsize_t n) {
+    hsize_t dims[] {n, n_scores, 3};
+    hsize_t start[] {0, 0, 1};
+    hsize_t count[] {n, n_scores, 2};
+    hid_t memspace = H5Screate_simple(3, dims, nullptr);
+    if (n > 0) {
+      H5Sselect_hyperslab(
+        memspace, H5S_SELECT_SET, start, nullptr, count, nullptr);
+    } else {
+      H5Sselect_none(memspace);
+    }
+    return memspace;
+  };
+
+  hsize_t dims[] {static_cast<hsize_t>(bin_index.back()), n_scores, 2};
+  hsize_t n_local = results.shape(0);
+
+#ifdef PHDF5
+  hid_t dspace = H5Screate_simple(3, dims, nullptr);
+  hid_t dset = H5Dcreate(group_id, "results", H5T_NATIVE_DOUBLE, dspace,
+    H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  hid_t memspace = block_memspace(n_local);
+  select_block(dspace, bin_index[mpi::rank], n_local);
+
+  // Write data to file in parallel
+  hid_t plist = H5Pcreate(H5P_DATASET_XFER);
+  H5Pset_dxpl_mpio(plist, H5FD_MPIO_COLLECTIVE);
+  H5Dwrite(dset, H5T_NATIVE_DOUBLE, memspace, dspace, plist, results.data());
+
+  H5Pclose(plist);
+  H5Sclose(memspace);
+  H5Sclose(dspace);
+  H5Dclose(dset);
+
+#else
+
+#ifdef OPENMC_MPI
+  // Results are sent one filter bin combination at a time so that the count
+  // fits in an int
+  MPI_Datatype result_block;
+  MPI_Type_contiguous(n_scores * 3, MPI_DOUBLE, &result_block);
+  MPI_Type_commit(&result_block);
+#endif
+
+  if (mpi::master) {
+    hid_t dspace = H5Screate_simple(3, dims, nullptr);
+    hid_t dset = H5Dcreate(group_id, "results", H5T_NATIVE_DOUBLE, dspace,
+      H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+    // Receive and write the block of one process at a time
+    vector<double> buffer;
+    for (int i = 0; i < mpi::n_procs; ++i) {
+      hsize_t n = bin_index[i + 1] - bin_index[i];
+      if (n == 0)
+        continue;
+      const double* data = results.data();
+#ifdef OPENMC_MPI
+      if (i > 0) {
+        buffer.resize(n * n_scores * 3);
+        MPI_Recv(buffer.data(), n, result_block, i, i, mpi::intracomm,
+          MPI_STATUS_IGNORE);
+        data = buffer.data();
+      }
+#endif
+      hid_t memspace = block_memspace(n);
+      select_block(dspace, bin_index[i], n);
+      H5Dwrite(dset, H5T_NATIVE_DOUBLE, memspace, dspace, H5P_DEFAULT, data);
+      H5Sclose(memspace);
+    }
+
+    H5Sclose(dspace);
+    H5Dclose(dset);
+  } else {
+#ifdef OPENMC_MPI
+    if (n_local > 0)
+      MPI_Send(results.data(), n_local, result_block, 0, mpi::rank,
+        mpi::intracomm);
+#endif
+  }
+
+#ifdef OPENMC_MPI
+  MPI_Type_free(&result_block);
+#endif
+#endif
+}
+
+void read_tally_results_decomposed(hid_t group_id, Tally& tally)
+{
+  auto& results {tally.results_};
+  hsize_t n_local = results.shape(0);
+  hsize_t n_scores = results.shape(1);
+
+  hsize_t dims[] {n_local, n_scores, 3};
+  hsize_t mem_start[] {0, 0, 1};
+  hsize_t count[] {n_local, n_scores, 2};
+  hid_t memspace = H5Screate_simple(3, dims, nullptr);
+  hid_t dset = open_dataset(group_id, "results");
+  hid_t dspace = H5Dget_space(dset);
+  if (n_local > 0) {
+    hsize_t start[] {static_cast<hsize_t>(tally.bin_index()[mpi::rank]), 0, 0};
+    H5Sselect_hyperslab(
+      memspace, H5S_SELECT_SET, mem_start, nullptr, count, nullptr);
+    H5Sselect_hyperslab(dspace, H5S_SELECT_SET, start, nullptr, count, nullptr);
+  } else {
+    H5Sselect_none(memspace);
+    H5Sselect_none(dspace);
+  }
+  H5Dread(dset, H5T_NATIVE_DOUBLE, memspace, dspace, H5P_DEFAULT,
+    results.data());
+
+  H5Sclose(dspace);
+  H5Sclose(memspace);
+  close_dataset(dset);
+}
+
 void read_source_bank(
   hid_t group_id, vector<SourceSite>& sites, bool distribute)
 {
@@ -786,6 +1068,9 @@ void write_unstructured_mesh_results()
 {
 
   for (auto& tally : model::tallies) {
+    // Decomposed tallies only have part of their results on each process
+    if (tally->decompose_)
+      continue;
 
     vector<std::string> tally_scores;
     for (auto filter_idx : tally->filters()) {
@@ -942,6 +1227,10 @@ void write_tally_results_nr(hid_t file_id)
       write_attribute(file_id, "tallies_present", 1);
     }
 
+    // Decomposed tallies are written by write_tally_results_decomposed()
+    if (t->decompose_)
+      continue;
+
     // Get view of accumulated tally values
     auto values_view = xt::view(t->results_, xt::all(), xt::all(),
       xt::range(static_cast<int>(TallyResult::SUM),
@@ -1163,6 +1163,20 @@ Direction SurfaceZTorus::normal(Position r) const
   return n / n.norm();
 }
 
+//==============================================================================
+// SurfaceSenseCache implementation
+//==============================================================================
+
+int SurfaceSenseCache::generation_ {0};
+
+void SurfaceSenseCache::resize()
+{
+  stamps_.assign(model::surfaces.size(), 0);
+  senses_.resize(model::surfaces.size());
+  stamp_ = 1;
+  cache_generation_ = generation_;
+}
+
 //==============================================================================
 
 void read_surfaces(pugi::xml_node node)
@@ -1348,6 +1362,7 @@ void free_memory_surfaces()
 {
   model::surfaces.clear();
   model::surface_map.clear();
+  SurfaceSenseCache::invalidate();
 }
 
 } // namespace openmc
@@ -9,6 +9,8 @@
 
 #include <fmt/core.h>
 
+#include <algorithm> // for find
+
 template class openmc::vector<openmc::TallyDerivative>;
 
 namespace openmc {
@@ -66,6 +68,21 @@ TallyDerivative::TallyDerivative(pugi::xml_node node)
   }
 
   diff_material = std::stoi(get_node_value(node, "material"));
+
+  // Cross sections are only cached on particles for the nuclides of the
+  // material they are in, so the nuclide has to be one of them
+  if (variable == DerivativeVariable::NUCLIDE_DENSITY) {
+    auto search = model::material_map.find(diff_material);
+    if (search != model::material_map.end()) {
+      const auto& nuclides {model::materials[search->second]->nuclide_};
+      if (std::find(nuclides.begin(), nuclides.end(), diff_nuclide) ==
+          nuclides.end()) {
+        fatal_error(fmt::format("Nuclide \"{}\" specified in derivative {} is "
+                                "not in material {}.",
+          data::nuclides[diff_nuclide]->name_, id, diff_material));
+      }
+    }
+  }
 }
 
 //==============================================================================
@@ -48,14 +48,14 @@ void MeshFilter::get_all_bins(
   }
 
   if (estimator != TallyEstimator::TRACKLENGTH) {
-    auto bin = model::meshes[mesh_]->get_bin(r);
+    auto bin = p.mesh_traversals().get_bin(mesh_, r);
     if (bin >= 0) {
       match.bins_.push_back(bin);
       match.weights_.push_back(1.0);
     }
   } else {
-    model::meshes[mesh_]->bins_crossed(
-      last_r, r, u, match.bins_, match.weights_);
+    p.mesh_traversals().bins_crossed(
+      mesh_, last_r, r, u, match.bins_, match.weights_);
   }
 }
 
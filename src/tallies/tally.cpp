@@ -10,6 +10,7 @@
 #include "openmc/message_passing.h"
 #include "openmc/mgxs_interface.h"
 #include "openmc/nuclide.h"
+#include "openmc/openmp_interface.h"
 #include "openmc/particle.h"
 #include "openmc/reaction.h"
 #include "openmc/reaction_product.h"
@@ -40,6 +41,7 @@
 
 #include <algorithm> // for max
 #include <cstddef>   // for size_t
+#include <mutex>     // for lock_guard
 #include <string>
 
 namespace openmc {
@@ -101,6 +103,10 @@ Tally::Tally(pugi::xml_node node)
     multiply_density_ = get_node_value_bool(node, "multiply_density");
   }
 
+  if (check_for_node(node, "decompose")) {
+    decompose_ = get_node_value_bool(node, "decompose");
+  }
+
   // =======================================================================
   // READ DATA FOR FILTERS
 
@@ -317,6 +323,19 @@ Tally::Tally(pugi::xml_node node)
     }
   }
 
+  // Triggers are checked on the master process and random ray scores directly
+  // to the results, so both need all results on every process
+  if (decompose_) {
+    if (!triggers_.empty()) {
+      throw std::runtime_error {
+        fmt::format("Triggers cannot be used on decomposed tally {}", id_)};
+    }
+    if (settings::solver_type == SolverType::RANDOM_RAY) {
+      throw std::runtime_error {fmt::format(
+        "Tally {} cannot be decomposed with the random ray solver", id_)};
+    }
+  }
+
 #ifdef LIBMESH
   // ensure a tracklength tally isn't used with a libMesh filter
   for (auto i : this->filters_) {
@@ -732,23 +751,209 @@ void Tally::init_triggers(pugi::xml_node node)
 void Tally::init_results()
 {
   int n_scores = scores_.size() * nuclides_.size();
-  results_ = xt::empty<double>({n_filter_bins_, n_scores, 3});
+  int n_bins = n_filter_bins_;
+
+  // A decomposed tally stores an equal share of the filter bin combinations
+  // on each process
+  if (decompose_) {
+    bin_index_.resize(mpi::n_procs + 1);
+    for (int i = 0; i <= mpi::n_procs; ++i) {
+      bin_index_[i] = static_cast<int64_t>(n_filter_bins_) * i / mpi::n_procs;
+    }
+    first_bin_ = bin_index_[mpi::rank];
+    n_bins = bin_index_[mpi::rank + 1] - first_bin_;
+    remote_values_.resize(num_threads());
+    for (auto& values : remote_values_) {
+      values.reserve(TALLY_REMOTE_BUFFER_SIZE);
+    }
+  }
+
+  results_ = xt::empty<double>({n_bins, n_scores, 3});
 }
 
 void Tally::reset()
 {
   n_realizations_ = 0;
+  time_reduce_.reset();
   if (results_.size() != 0) {
     xt::view(results_, xt::all()) = 0.0;
   }
+  for (auto& buffer : thread_buffers_) {
+    buffer->flush([](int64_t, double) {});
+  }
+  for (auto& values : remote_values_) {
+    values.clear();
+  }
+  remote_merged_.clear();
+}
+
+size_t Tally::init_thread_buffers(size_t max_memory)
+{
+  thread_buffers_.clear();
+
+  // Small tallies get a dense buffer while large tallies, such as those over
+  // meshes with many elements, get a sparse buffer of fixed size
+  int64_t n_values = results_.shape(0) * results_.shape(1);
+  if (n_values == 0)
+    return 0;
+  bool dense = (n_values <= TALLY_DENSE_BUFFER_MAX);
+  int n_threads = num_threads();
+  size_t memory = n_threads * TallyBuffer::memory(n_values, dense);
+  if (memory > max_memory)
+    return 0;
+
+  // Allocate each buffer on the thread that uses it
+  thread_buffers_.resize(n_threads);
+#pragma omp parallel num_threads(n_threads)
+  {
+    thread_buffers_[thread_num()] = make_unique<TallyBuffer>(n_values, dense);
+  }
+  return memory;
+}
+
+void Tally::reduce_thread_buffers()
+{
+  if (thread_buffers_.empty())
+    return;
+
+  int n_scores = results_.shape(1);
+  if (thread_buffers_[0]->dense()) {
+    // Sum the buffers of all threads, dividing the values among threads
+    int64_t n_values = results_.shape(0) * n_scores;
+#pragma omp parallel for
+    for (int64_t i = 0; i < n_values; ++i) {
+      double sum = 0.0;
+      for (auto& buffer : thread_buffers_) {
+        sum += buffer->data()[i];
+        buffer->data()[i] = 0.0;
+      }
+      results_(i / n_scores, i % n_scores, TallyResult::VALUE) += sum;
+    }
+  } else {
+#pragma omp parallel for
+    for (int i = 0; i < thread_buffers_.size(); ++i) {
+      this->flush_buffer(*thread_buffers_[i]);
+    }
+  }
+}
+
+void Tally::flush_buffer(TallyBuffer& buffer)
+{
+  int n_scores = results_.shape(1);
+  buffer.flush([this, n_scores](int64_t i, double value) {
+#pragma omp atomic
+    results_(i / n_scores, i % n_scores, TallyResult::VALUE) += value;
+  });
+}
+
+void Tally::add_remote_value(int64_t index, double value)
+{
+  auto& values {remote_values_[thread_num()]};
+
+  // When the buffer is full, values with the same index are combined. If that
+  // does not free at least half of it, the values are moved to the values
+  // shared by all threads, which hold each index only once. The values stored
+  // for other processes therefore never exceed the size of their part of the
+  // results plus one buffer per thread.
+  if (values.size() >= TALLY_REMOTE_BUFFER_SIZE) {
+    merge_remote_values(values);
+    if (values.size() > TALLY_REMOTE_BUFFER_SIZE / 2)
+      this->flush_remote_values(values);
+  }
+  values.push_back({index, value});
+}
+
+void Tally::flush_remote_values(vector<RemoteValue>& values)
+{
+  std::lock_guard<OpenMPMutex> lock(remote_mutex_);
+  auto n = remote_merged_.size();
+  remote_merged_.insert(remote_merged_.end(), values.begin(), values.end());
+  std::inplace_merge(remote_merged_.begin(), remote_merged_.begin() + n,
+    remote_merged_.end(), [](const RemoteValue& a, const RemoteValue& b) {
+      return a.index < b.index;
+    });
+  combine_remote_values(remote_merged_);
+  values.clear();
+}
+
+void Tally::merge_remote_values(vector<RemoteValue>& values)
+{
+  std::sort(values.begin(), values.end(),
+    [](const RemoteValue& a, const RemoteValue& b) {
+      return a.index < b.index;
+    });
+  combine_remote_values(values);
+}
+
+void Tally::combine_remote_values(vector<RemoteValue>& values)
+{
+  size_t n = 0;
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (n > 0 && values[n - 1].index == values[i].index) {
+      values[n - 1].value += values[i].value;
+    } else {
+      values[n++] = values[i];
+    }
+  }
+  values.resize(n);
+}
+
+#ifdef OPENMC_MPI
+void Tally::exchange_remote_values()
+{
+  // Combine the values of all threads. After sorting, the values for each
+  // process are contiguous.
+  for (auto& values : remote_values_) {
+    merge_remote_values(values);
+    this->flush_remote_values(values);
+  }
+  const auto& send {remote_merged_};
+
+  int n_scores = results_.shape(1);
+  vector<int> send_counts(mpi::n_procs, 0);
+  int owner = 0;
+  for (const auto& v : send) {
+    while (v.index / n_scores >= bin_index_[owner + 1])
+      ++owner;
+    ++send_counts[owner];
+  }
+
+  vector<int> recv_counts(mpi::n_procs);
+  MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT,
+    mpi::intracomm);
+  vector<int> send_displs(mpi::n_procs, 0);
+  vector<int> recv_displs(mpi::n_procs, 0);
+  for (int i = 1; i < mpi::n_procs; ++i) {
+    send_displs[i] = send_displs[i - 1] + send_counts[i - 1];
+    recv_displs[i] = recv_displs[i - 1] + recv_counts[i - 1];
+  }
+  vector<RemoteValue> recv(recv_displs.back() + recv_counts.back());
+
+  MPI_Datatype remote_value;
+  MPI_Type_contiguous(sizeof(RemoteValue), MPI_BYTE, &remote_value);
+  MPI_Type_commit(&remote_value);
+  MPI_Alltoallv(send.data(), send_counts.data(), send_displs.data(),
+    remote_value, recv.data(), recv_counts.data(), recv_displs.data(),
+    remote_value, mpi::intracomm);
+  MPI_Type_free(&remote_value);
+  remote_merged_.clear();
+
+  for (const auto& v : recv) {
+    int filter_index = v.index / n_scores - first_bin_;
+    int score_index = v.index % n_scores;
+    results_(filter_index, score_index, TallyResult::VALUE) += v.value;
+  }
 }
+#endif
 
 void Tally::accumulate()
 {
-  // Increment number of realizations
-  n_realizations_ += settings::reduce_tallies ? 1 : mpi::n_procs;
+  // Increment number of realizations. The values of a decomposed tally are
+  // combined across processes before they are accumulated.
+  bool combined = settings::reduce_tallies || decompose_;
+  n_realizations_ += combined ? 1 : mpi::n_procs;
 
-  if (mpi::master || !settings::reduce_tallies) {
+  if (mpi::master || !settings::reduce_tallies || decompose_) {
     // Calculate total source strength for normalization
     double total_source = 0.0;
     if (settings::run_mode == RunMode::FIXED_SOURCE) {
@@ -897,31 +1102,132 @@ void read_tallies_xml(pugi::xml_node root)
 }
 
 #ifdef OPENMC_MPI
+namespace {
+
+//! State of the reduction of tally results across processes
+struct TallyReduction {
+  MPI_Win win {MPI_WIN_NULL};   //!< Shared memory window of the node
+  double* window {nullptr};     //!< Memory of the window
+  int64_t capacity {0};         //!< Number of values the window holds
+  vector<int> tallies;          //!< Tallies whose results are being reduced
+  vector<int64_t> offsets;      //!< Offset of each tally in the window
+  vector<MPI_Request> requests; //!< Reductions between nodes
+  vector<double> reduced;       //!< Results reduced onto the master process
+} tally_reduction;
+
+void free_tally_window()
+{
+  auto& tr {tally_reduction};
+  if (tr.win != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(tr.win);
+    MPI_Win_free(&tr.win);
+  }
+  tr.window = nullptr;
+  tr.capacity = 0;
+}
+
+//! Make sure the shared memory window of the node holds n values
+void reserve_tally_window(int64_t n)
+{
+  auto& tr {tally_reduction};
+  if (n <= tr.capacity)
+    return;
+  free_tally_window();
+
+  // The memory is allocated by the first process on the node and accessed
+  // directly by all others
+  int node_rank;
+  MPI_Comm_rank(mpi::node_comm, &node_rank);
+  MPI_Aint size = (node_rank == 0) ? n * sizeof(double) : 0;
+  double* base;
+  MPI_Win_allocate_shared(size, sizeof(double), MPI_INFO_NULL, mpi::node_comm,
+    &base, &tr.win);
+  int disp_unit;
+  MPI_Win_shared_query(tr.win, 0, &size, &disp_unit, &tr.window);
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, tr.win);
+  tr.capacity = n;
+}
+
+//! Wait until all processes on the node have reached this point and their
+//! writes to the shared memory window are visible
+void tally_window_barrier()
+{
+  MPI_Win_sync(tally_reduction.win);
+  MPI_Barrier(mpi::node_comm);
+  MPI_Win_sync(tally_reduction.win);
+}
+
+} // namespace
+
 void reduce_tally_results()
 {
   // Don't reduce tally is no_reduce option is on
   if (settings::reduce_tallies) {
-    for (int i_tally : model::active_tallies) {
-      // Skip any tallies that are not active
-      auto& tally {model::tallies[i_tally]};
-
-      // Get view of accumulated tally values
-      auto values_view = xt::view(tally->results_, xt::all(), xt::all(),
-        static_cast<int>(TallyResult::VALUE));
+    auto& tr {tally_reduction};
 
-      // Make copy of tally values in contiguous array
-      xt::xtensor<double, 2> values = values_view;
-      xt::xtensor<double, 2> values_reduced = xt::empty_like(values);
+    // The window still holds the results of the last batch until their
+    // reduction between nodes is finished
+    finish_tally_reduction();
 
-      // Reduce contiguous set of tally results
-      MPI_Reduce(values.data(), values_reduced.data(), values.size(),
-        MPI_DOUBLE, MPI_SUM, 0, mpi::intracomm);
+    // Decomposed tallies are already complete on each process
+    tr.tallies.clear();
+    for (int i_tally : model::active_tallies) {
+      if (!model::tallies[i_tally]->decompose_)
+        tr.tallies.push_back(i_tally);
+    }
+    tr.offsets.resize(tr.tallies.size() + 1);
+    tr.offsets[0] = 0;
+    for (int i = 0; i < tr.tallies.size(); ++i) {
+      const auto& results {model::tallies[tr.tallies[i]]->results_};
+      tr.offsets[i + 1] = tr.offsets[i] + results.shape(0) * results.shape(1);
+    }
+    reserve_tally_window(tr.offsets.back());
+    tally_window_barrier();
+
+    // Sum the results of all processes on the node in the window. The results
+    // of each tally are split into as many parts as there are processes on
+    // the node, and in every step each process adds its values to a
+    // different part. The process that owns a part overwrites it in the
+    // first step. Values are reset as they are added.
+    int node_rank, node_size;
+    MPI_Comm_rank(mpi::node_comm, &node_rank);
+    MPI_Comm_size(mpi::node_comm, &node_size);
+    for (int step = 0; step < node_size; ++step) {
+      int part = (node_rank + step) % node_size;
+      for (int i = 0; i < tr.tallies.size(); ++i) {
+        auto& tally {model::tallies[tr.tallies[i]]};
+        tally->time_reduce_.start();
+        int64_t n = tr.offsets[i + 1] - tr.offsets[i];
+        int64_t first = n * part / node_size;
+        int64_t last = n * (part + 1) / node_size;
+        int stride = tally->results_.shape(2);
+        double* values = tally->results_.data() +
+                         static_cast<int>(TallyResult::VALUE);
+        double* window = tr.window + tr.offsets[i];
+        for (int64_t j = first; j < last; ++j) {
+          window[j] = (step == 0) ? values[j * stride]
+                                  : window[j] + values[j * stride];
+          values[j * stride] = 0.0;
+        }
+        tally->time_reduce_.stop();
+      }
+      tally_window_barrier();
+    }
 
-      // Transfer values on master and reset on other ranks
-      if (mpi::master) {
-        values_view = values_reduced;
-      } else {
-        values_view = 0.0;
+    // Reduce the sums of all nodes onto the master process. This is left to
+    // progress while the next batch runs.
+    if (mpi::leader_comm != MPI_COMM_NULL) {
+      if (mpi::master)
+        tr.reduced.resize(tr.offsets.back());
+      tr.requests.resize(tr.tallies.size());
+      for (int i = 0; i < tr.tallies.size(); ++i) {
+        auto& tally {model::tallies[tr.tallies[i]]};
+        tally->time_reduce_.start();
+        MPI_Ireduce(tr.window + tr.offsets[i],
+          mpi::master ? tr.reduced.data() + tr.offsets[i] : nullptr,
+          tr.offsets[i + 1] - tr.offsets[i], MPI_DOUBLE, MPI_SUM, 0,
+          mpi::leader_comm, &tr.requests[i]);
+        tally->time_reduce_.stop();
       }
     }
   }
@@ -959,11 +1265,90 @@ void reduce_tally_results()
 }
 #endif
 
+void finish_tally_reduction()
+{
+#ifdef OPENMC_MPI
+  auto& tr {tally_reduction};
+  for (int i = 0; i < tr.tallies.size(); ++i) {
+    auto& tally {model::tallies[tr.tallies[i]]};
+    if (!tr.requests.empty()) {
+      tally->time_reduce_.start();
+      MPI_Wait(&tr.requests[i], MPI_STATUS_IGNORE);
+      tally->time_reduce_.stop();
+    }
+
+    if (mpi::master) {
+      // Values of the batch in progress are set aside while the reduced
+      // values are accumulated
+      int stride = tally->results_.shape(2);
+      double* values =
+        tally->results_.data() + static_cast<int>(TallyResult::VALUE);
+      double* reduced = tr.reduced.data() + tr.offsets[i];
+      int64_t n = tr.offsets[i + 1] - tr.offsets[i];
+      for (int64_t j = 0; j < n; ++j) {
+        std::swap(values[j * stride], reduced[j]);
+      }
+      tally->accumulate();
+      for (int64_t j = 0; j < n; ++j) {
+        values[j * stride] = reduced[j];
+      }
+    } else {
+      tally->accumulate();
+    }
+  }
+  tr.tallies.clear();
+  tr.requests.clear();
+#endif
+}
+
+void init_tally_buffers()
+{
+  size_t max_memory = 0;
+  if (settings::private_tally_buffers) {
+    max_memory = settings::tally_buffer_memory * 1024 * 1024;
+  }
+
+  // Tallies whose buffers do not fit in the remaining memory fall back to
+  // atomic updates of their results
+  size_t memory = 0;
+  int n_buffered = 0;
+  for (auto& t : model::tallies) {
+    size_t m = t->init_thread_buffers(max_memory - memory);
+    if (m > 0) {
+      memory += m;
+      ++n_buffered;
+    }
+  }
+
+  if (settings::private_tally_buffers) {
+    write_message(6,
+      "Thread-private tally buffers: {:.3f} MB for {} of {} tallies",
+      memory / (1024.0 * 1024.0), n_buffered, model::tallies.size());
+  }
+}
+
+void reduce_tally_buffers()
+{
+  for (int i_tally : model::active_tallies) {
+    model::tallies[i_tally]->reduce_thread_buffers();
+  }
+}
+
 void accumulate_tallies()
 {
+  // Merge thread-private tally buffers into the results for this realization
+  reduce_tally_buffers();
+
 #ifdef OPENMC_MPI
-  // Combine tally results onto master process
   if (mpi::n_procs > 1 && settings::solver_type == SolverType::MONTE_CARLO) {
+    // Send values of decomposed tallies to the processes storing them
+    for (int i_tally : model::active_tallies) {
+      auto& tally {model::tallies[i_tally]};
+      if (tally->decompose_)
+        tally->exchange_remote_values();
+    }
+
+    // Combine tally results onto master process
     reduce_tally_results();
   }
 #endif
@@ -999,8 +1384,13 @@ void accumulate_tallies()
     }
   }
 
-  // Accumulate results for each tally
+  // Accumulate results for each tally. Tallies that are being reduced across
+  // processes are accumulated by finish_tally_reduction().
   for (int i_tally : model::active_tallies) {
+#ifdef OPENMC_MPI
+    if (contains(tally_reduction.tallies, i_tally))
+      continue;
+#endif
     auto& tally {model::tallies[i_tally]};
     tally->accumulate();
   }
@@ -1054,6 +1444,11 @@ void setup_active_tallies()
 
 void free_memory_tally()
 {
+#ifdef OPENMC_MPI
+  finish_tally_reduction();
+  free_tally_window();
+#endif
+
   model::tally_derivs.clear();
   model::tally_deriv_map.clear();
 
@@ -1403,10 +1798,23 @@ extern "C" int openmc_tally_get_n_realizations(int32_t index, int32_t* n)
     return OPENMC_E_OUT_OF_BOUNDS;
   }
 
+  finish_tally_reduction();
   *n = model::tallies[index]->n_realizations_;
   return 0;
 }
 
+extern "C" int openmc_tally_get_reduce_time(int32_t index, double* time)
+{
+  // Make sure the index fits in the array bounds.
+  if (index < 0 || index >= model::tallies.size()) {
+    set_errmsg("Index in tallies array is out of bounds.");
+    return OPENMC_E_OUT_OF_BOUNDS;
+  }
+
+  *time = model::tallies[index]->time_reduce_.elapsed();
+  return 0;
+}
+
 //! \brief Returns a pointer to a tally results array along with its shape. This
 //! allows a user to obtain in-memory tally results from Python directly.
 extern "C" int openmc_tally_results(
@@ -1418,12 +1826,20 @@ extern "C" int openmc_tally_results(
     return OPENMC_E_OUT_OF_BOUNDS;
   }
 
+  finish_tally_reduction();
   const auto& t {model::tallies[index]};
   if (t->results_.size() == 0) {
     set_errmsg("Tally results have not been allocated yet.");
     return OPENMC_E_ALLOCATE;
   }
 
+  // Each process only holds part of the results of a decomposed tally
+  if (t->decompose_) {
+    set_errmsg(fmt::format(
+      "Results of decomposed tally {} are not available in memory", t->id_));
+    return OPENMC_E_INVALID_ARGUMENT;
+  }
+
   // Set pointer to results and copy shape
   *results = t->results_.data();
   auto s = t->results_.shape();
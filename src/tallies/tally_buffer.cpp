@@ -0,0 +1,51 @@
+#include "openmc/tallies/tally_buffer.h"
+
+#include "openmc/constants.h"
+
+namespace openmc {
+
+//==============================================================================
+// TallyBuffer implementation
+//==============================================================================
+
+constexpr int64_t TallyBuffer::EMPTY;
+
+TallyBuffer::TallyBuffer(int64_t n_values, bool dense) : dense_ {dense}
+{
+  if (dense_) {
+    values_.resize(n_values, 0.0);
+  } else {
+    // The hash maps onto the top bits of a 64-bit product, so the number of
+    // slots must be a power of two
+    int64_t n_slots = TALLY_SPARSE_BUFFER_SLOTS;
+    shift_ = 64;
+    for (int64_t n = 1; n < n_slots; n *= 2) {
+      --shift_;
+    }
+    keys_.resize(n_slots, EMPTY);
+    values_.resize(n_slots, 0.0);
+
+    // Keep the table at most half full so probe sequences stay short
+    max_used_ = n_slots / 2;
+    used_.reserve(max_used_);
+  }
+}
+
+size_t TallyBuffer::memory() const
+{
+  return values_.capacity() * sizeof(double) +
+         keys_.capacity() * sizeof(int64_t) + used_.capacity() * sizeof(size_t);
+}
+
+size_t TallyBuffer::memory(int64_t n_values, bool dense)
+{
+  if (dense) {
+    return n_values * sizeof(double);
+  } else {
+    int64_t n_slots = TALLY_SPARSE_BUFFER_SLOTS;
+    return n_slots * (sizeof(double) + sizeof(int64_t)) +
+           n_slots / 2 * sizeof(size_t);
+  }
+}
+
+} // namespace openmc
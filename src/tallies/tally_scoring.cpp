@@ -37,13 +37,14 @@ FilterBinIter::FilterBinIter(const Tally& tally, Particle& p)
     if (!match.bins_present_) {
       match.bins_.clear();
       match.weights_.clear();
+      match.all_bins_ = false;
       model::tally_filters[i_filt]->get_all_bins(p, tally_.estimator_, match);
       match.bins_present_ = true;
     }
 
     // If there are no valid bins for this filter, then there are no valid
     // filter bin combinations so all iterators are end iterators.
-    if (match.bins_.size() == 0) {
+    if (match.size() == 0) {
       index_ = -1;
       return;
     }
@@ -69,16 +70,15 @@ FilterBinIter::FilterBinIter(
   for (auto i_filt : tally_.filters()) {
     auto& match {filter_matches_[i_filt]};
     if (!match.bins_present_) {
+      // Every bin matches with unit weight, so no bins need to be stored
       match.bins_.clear();
       match.weights_.clear();
-      for (auto i = 0; i < model::tally_filters[i_filt]->n_bins(); ++i) {
-        match.bins_.push_back(i);
-        match.weights_.push_back(1.0);
-      }
+      match.all_bins_ = true;
+      match.n_all_bins_ = model::tally_filters[i_filt]->n_bins();
       match.bins_present_ = true;
     }
 
-    if (match.bins_.size() == 0) {
+    if (match.size() == 0) {
       index_ = -1;
       return;
     }
@@ -99,7 +99,7 @@ FilterBinIter& FilterBinIter::operator++()
   for (int i = tally_.filters().size() - 1; i >= 0; --i) {
     auto i_filt = tally_.filters(i);
     auto& match {filter_matches_[i_filt]};
-    if (match.i_bin_ < match.bins_.size() - 1) {
+    if (match.i_bin_ < match.size() - 1) {
       // The bin for this filter can be incremented.  Increment it and do not
       // touch any of the remaining filters.
       ++match.i_bin_;
@@ -132,8 +132,8 @@ void FilterBinIter::compute_index_weight()
     auto i_filt = tally_.filters(i);
     auto& match {filter_matches_[i_filt]};
     auto i_bin = match.i_bin_;
-    index_ += match.bins_[i_bin] * tally_.strides(i);
-    weight_ *= match.weights_[i_bin];
+    index_ += match.bin(i_bin) * tally_.strides(i);
+    weight_ *= match.weight(i_bin);
   }
 }
 
@@ -165,10 +165,8 @@ void score_fission_delayed_dg(int i_tally, int d_bin, double score,
     filter_weight *= match.weights_[i_bin];
   }
 
-// Update the tally result
-#pragma omp atomic
-  tally.results_(filter_index, score_index, TallyResult::VALUE) +=
-    score * filter_weight;
+  // Update the tally result
+  tally.add_value(filter_index, score_index, score * filter_weight);
 
   // Reset the original delayed group bin
   dg_match.bins_[i_bin] = original_bin;
@@ -406,10 +404,8 @@ void score_fission_eout(Particle& p, int i_tally, int i_score, int score_bin)
         filter_weight *= match.weights_[i_bin];
       }
 
-// Update tally results
-#pragma omp atomic
-      tally.results_(filter_index, i_score, TallyResult::VALUE) +=
-        score * filter_weight;
+      // Update tally results
+      tally.add_value(filter_index, i_score, score * filter_weight);
 
     } else if (score_bin == SCORE_DELAYED_NU_FISSION && g != 0) {
 
@@ -454,10 +450,8 @@ void score_fission_eout(Particle& p, int i_tally, int i_score, int score_bin)
           filter_weight *= match.weights_[i_bin];
         }
 
-// Update tally results
-#pragma omp atomic
-        tally.results_(filter_index, i_score, TallyResult::VALUE) +=
-          score * filter_weight;
+        // Update tally results
+        tally.add_value(filter_index, i_score, score * filter_weight);
       }
     }
   }
@@ -854,9 +848,8 @@ void score_general_ce_nonanalog(Particle& p, int i_tally, int start_index,
       break;
 
     case SCORE_EVENTS:
-// Simply count the number of scoring events
-#pragma omp atomic
-      tally.results_(filter_index, score_index, TallyResult::VALUE) += 1.0;
+      // Simply count the number of scoring events
+      tally.add_value(filter_index, score_index, 1.0);
       continue;
 
     case ELASTIC:
@@ -1010,10 +1003,8 @@ void score_general_ce_nonanalog(Particle& p, int i_tally, int start_index,
       apply_derivative_to_score(
         p, i_tally, i_nuclide, atom_density, score_bin, score);
 
-// Update tally results
-#pragma omp atomic
-    tally.results_(filter_index, score_index, TallyResult::VALUE) +=
-      score * filter_weight;
+    // Update tally results
+    tally.add_value(filter_index, score_index, score * filter_weight);
   }
 }
 
@@ -1427,9 +1418,8 @@ void score_general_ce_analog(Particle& p, int i_tally, int start_index,
       break;
 
     case SCORE_EVENTS:
-// Simply count the number of scoring events
-#pragma omp atomic
-      tally.results_(filter_index, score_index, TallyResult::VALUE) += 1.0;
+      // Simply count the number of scoring events
+      tally.add_value(filter_index, score_index, 1.0);
       continue;
 
     case ELASTIC:
@@ -1532,10 +1522,8 @@ void score_general_ce_analog(Particle& p, int i_tally, int start_index,
       apply_derivative_to_score(
         p, i_tally, i_nuclide, atom_density, score_bin, score);
 
-// Update tally results
-#pragma omp atomic
-    tally.results_(filter_index, score_index, TallyResult::VALUE) +=
-      score * filter_weight;
+    // Update tally results
+    tally.add_value(filter_index, score_index, score * filter_weight);
   }
 }
 
@@ -2221,19 +2209,16 @@ void score_general_mg(Particle& p, int i_tally, int start_index,
       break;
 
     case SCORE_EVENTS:
-// Simply count the number of scoring events
-#pragma omp atomic
-      tally.results_(filter_index, score_index, TallyResult::VALUE) += 1.0;
+      // Simply count the number of scoring events
+      tally.add_value(filter_index, score_index, 1.0);
       continue;
 
     default:
       continue;
     }
 
-// Update tally results
-#pragma omp atomic
-    tally.results_(filter_index, score_index, TallyResult::VALUE) +=
-      score * filter_weight;
+    // Update tally results
+    tally.add_value(filter_index, score_index, score * filter_weight);
   }
 }
 
@@ -2287,6 +2272,7 @@ void score_analog_tally_ce(Particle& p)
   // Reset all the filter matches for the next tally event.
   for (auto& match : p.filter_matches())
     match.bins_present_ = false;
+  reset_filter_match_arena();
 }
 
 void score_analog_tally_mg(Particle& p)
@@ -2336,6 +2322,7 @@ void score_analog_tally_mg(Particle& p)
   // Reset all the filter matches for the next tally event.
   for (auto& match : p.filter_matches())
     match.bins_present_ = false;
+  reset_filter_match_arena();
 }
 
 void score_tracklength_tally(Particle& p, double distance)
@@ -2413,6 +2400,7 @@ void score_tracklength_tally(Particle& p, double distance)
   // Reset all the filter matches for the next tally event.
   for (auto& match : p.filter_matches())
     match.bins_present_ = false;
+  reset_filter_match_arena();
 }
 
 void score_collision_tally(Particle& p)
@@ -2491,6 +2479,7 @@ void score_collision_tally(Particle& p)
   // Reset all the filter matches for the next tally event.
   for (auto& match : p.filter_matches())
     match.bins_present_ = false;
+  reset_filter_match_arena();
 }
 
 void score_surface_tally(Particle& p, const vector<int>& tallies)
@@ -2519,8 +2508,7 @@ void score_surface_tally(Particle& p, const vector<int>& tallies)
       double score = current * filter_weight;
       for (auto score_index = 0; score_index < tally.scores_.size();
            ++score_index) {
-#pragma omp atomic
-        tally.results_(filter_index, score_index, TallyResult::VALUE) += score;
+        tally.add_value(filter_index, score_index, score);
       }
     }
 
@@ -2535,6 +2523,7 @@ void score_surface_tally(Particle& p, const vector<int>& tallies)
   // Reset all the filter matches for the next tally event.
   for (auto& match : p.filter_matches())
     match.bins_present_ = false;
+  reset_filter_match_arena();
 }
 
 void score_pulse_height_tally(Particle& p, const vector<int>& tallies)
@@ -2594,15 +2583,14 @@ void score_pulse_height_tally(Particle& p, const vector<int>& tallies)
             // Loop over scores.
             for (auto score_index = 0; score_index < tally.scores_.size();
                  ++score_index) {
-#pragma omp atomic
-              tally.results_(filter_index, score_index, TallyResult::VALUE) +=
-                filter_weight;
+              tally.add_value(filter_index, score_index, filter_weight);
             }
           }
 
           // Reset all the filter matches for the next tally event.
           for (auto& match : p.filter_matches())
             match.bins_present_ = false;
+          reset_filter_match_arena();
         }
       }
     }
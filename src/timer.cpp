@@ -22,12 +22,17 @@ Timer time_total;
 Timer time_transport;
 Timer time_event_init;
 Timer time_event_calculate_xs;
+Timer time_event_sort_xs;
+Timer time_event_lookup_xs;
 Timer time_event_advance_particle;
 Timer time_event_surface_crossing;
 Timer time_event_collision;
 Timer time_event_death;
 Timer time_update_src;
 
+int64_t bank_bytes_sent {0};
+int64_t bank_bytes_copied {0};
+
 } // namespace simulation
 
 //==============================================================================
@@ -82,11 +87,15 @@ void reset_timers()
   simulation::time_transport.reset();
   simulation::time_event_init.reset();
   simulation::time_event_calculate_xs.reset();
+  simulation::time_event_sort_xs.reset();
+  simulation::time_event_lookup_xs.reset();
   simulation::time_event_advance_particle.reset();
   simulation::time_event_surface_crossing.reset();
   simulation::time_event_collision.reset();
   simulation::time_event_death.reset();
   simulation::time_update_src.reset();
+  simulation::bank_bytes_sent = 0;
+  simulation::bank_bytes_copied = 0;
 }
 
 } // namespace openmc
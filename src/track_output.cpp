@@ -1,8 +1,11 @@
 #include "openmc/track_output.h"
 
 #include "openmc/constants.h"
+#include "openmc/error.h"
 #include "openmc/hdf5_interface.h"
+#include "openmc/memory.h"
 #include "openmc/message_passing.h"
+#include "openmc/openmp_interface.h"
 #include "openmc/position.h"
 #include "openmc/settings.h"
 #include "openmc/simulation.h"
@@ -12,8 +15,11 @@
 #include <fmt/core.h>
 #include <hdf5.h>
 
+#include <condition_variable>
 #include <cstddef> // for size_t
+#include <deque>
 #include <string>
+#include <thread>
 
 namespace openmc {
 
@@ -25,6 +31,222 @@ hid_t track_file;     //! HDF5 identifier for track file
 hid_t track_dtype;    //! HDF5 identifier for track datatype
 int n_tracks_written; //! Number of tracks written
 
+std::mutex track_hdf5_mutex;
+
+namespace {
+
+//==============================================================================
+// Buffered tracks
+//==============================================================================
+
+//! Number of states a thread buffers before handing them to the writer
+constexpr size_t TRACK_BUFFER_STATES {65536};
+
+//! Number of elements per chunk of the extensible track datasets
+constexpr hsize_t TRACK_CHUNK_SIZE {4096};
+
+//! Entry in the index of primary/secondary particle tracks
+struct TrackIndex {
+  int particle;   //!< Particle type
+  int64_t offset; //!< Index of the first state of the track
+};
+
+//! Entry in the index of source particle histories
+struct HistoryIndex {
+  int generation; //!< Generation within the batch
+  int64_t id;     //!< Particle number
+  int64_t offset; //!< Index of the first track of the history
+};
+
+//! Histories from one batch waiting to be written. Offsets are relative to the
+//! start of the buffer until the writer places them in the file.
+struct TrackBuffer {
+  int batch {0};
+  vector<TrackState> states;
+  vector<TrackIndex> tracks;
+  vector<HistoryIndex> histories;
+
+  void clear()
+  {
+    states.clear();
+    tracks.clear();
+    histories.clear();
+  }
+};
+
+//! Buffer that each OpenMP thread adds its finished histories to
+vector<unique_ptr<TrackBuffer>> thread_buffers;
+
+//==============================================================================
+// Background writer
+//==============================================================================
+
+//! Thread writing buffers to the file. It is detached rather than joined if
+//! the program exits without closing the track file, e.g. on a fatal error.
+struct WriterThread {
+  std::thread thread;
+  ~WriterThread()
+  {
+    if (thread.joinable())
+      thread.detach();
+  }
+} writer;
+
+std::mutex writer_mutex;              //!< Protects the variables below
+std::condition_variable writer_wake;  //!< Signals new buffers or stopping
+std::condition_variable writer_idle;  //!< Signals that all buffers are written
+std::deque<TrackBuffer> full_buffers; //!< Buffers waiting to be written
+vector<TrackBuffer> free_buffers;     //!< Written buffers kept for reuse
+bool writer_busy {false};             //!< Whether a buffer is being written
+bool writer_stop {false};             //!< Whether the writer should exit
+
+// HDF5 objects used only by the writer thread
+hid_t index_dtype;   //!< Datatype of TrackIndex
+hid_t history_dtype; //!< Datatype of HistoryIndex
+int batch_open {-1}; //!< Batch whose group is open
+hid_t batch_group;   //!< Group of the open batch
+hid_t dsets[3];      //!< States, tracks, and histories of the open batch
+hsize_t dset_sizes[3];
+
+//! Create an empty, extensible dataset that is written in chunks
+hid_t create_extensible_dataset(hid_t group, const char* name, hid_t dtype)
+{
+  hsize_t dims[] {0};
+  hsize_t maxdims[] {H5S_UNLIMITED};
+  hid_t dspace = H5Screate_simple(1, dims, maxdims);
+  hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+  hsize_t chunk[] {TRACK_CHUNK_SIZE};
+  H5Pset_chunk(dcpl, 1, chunk);
+  if (settings::track_compression > 0) {
+    H5Pset_deflate(dcpl, settings::track_compression);
+  }
+  hid_t dset =
+    H5Dcreate(group, name, dtype, dspace, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+  H5Pclose(dcpl);
+  H5Sclose(dspace);
+  return dset;
+}
+
+//! Append elements to the end of a one-dimensional extensible dataset
+void append_dataset(
+  hid_t dset, hid_t dtype, hsize_t& size, const void* data, hsize_t n)
+{
+  if (n == 0)
+    return;
+  hsize_t new_size[] {size + n};
+  H5Dset_extent(dset, new_size);
+  hid_t fspace = H5Dget_space(dset);
+  hsize_t start[] {size};
+  hsize_t count[] {n};
+  H5Sselect_hyperslab(fspace, H5S_SELECT_SET, start, nullptr, count, nullptr);
+  hid_t mspace = H5Screate_simple(1, count, nullptr);
+  H5Dwrite(dset, dtype, mspace, fspace, H5P_DEFAULT, data);
+  H5Sclose(mspace);
+  H5Sclose(fspace);
+  size = new_size[0];
+}
+
+void close_batch_group()
+{
+  if (batch_open < 0)
+    return;
+  for (hid_t dset : dsets) {
+    close_dataset(dset);
+  }
+  close_group(batch_group);
+  batch_open = -1;
+}
+
+//! Open the datasets of a batch, creating them if needed
+void open_batch_group(int batch)
+{
+  close_batch_group();
+  const char* names[] {"states", "tracks", "histories"};
+  hid_t dtypes[] {track_dtype, index_dtype, history_dtype};
+  std::string group_name = fmt::format("batch_{}", batch);
+  bool exists = object_exists(track_file, group_name.c_str());
+  batch_group = exists ? open_group(track_file, group_name.c_str())
+                       : create_group(track_file, group_name.c_str());
+  for (int i = 0; i < 3; ++i) {
+    if (exists) {
+      dsets[i] = open_dataset(batch_group, names[i]);
+      hid_t dspace = H5Dget_space(dsets[i]);
+      H5Sget_simple_extent_dims(dspace, &dset_sizes[i], nullptr);
+      H5Sclose(dspace);
+    } else {
+      dsets[i] = create_extensible_dataset(batch_group, names[i], dtypes[i]);
+      dset_sizes[i] = 0;
+    }
+  }
+  batch_open = batch;
+}
+
+//! Append a buffer to the datasets of its batch
+void write_buffer(TrackBuffer& buffer)
+{
+  std::lock_guard<std::mutex> lock(track_hdf5_mutex);
+  if (buffer.batch != batch_open) {
+    open_batch_group(buffer.batch);
+  }
+
+  // Make offsets refer to the data already in the file
+  for (auto& track : buffer.tracks) {
+    track.offset += dset_sizes[0];
+  }
+  for (auto& history : buffer.histories) {
+    history.offset += dset_sizes[1];
+  }
+
+  append_dataset(dsets[0], track_dtype, dset_sizes[0], buffer.states.data(),
+    buffer.states.size());
+  append_dataset(dsets[1], index_dtype, dset_sizes[1], buffer.tracks.data(),
+    buffer.tracks.size());
+  append_dataset(dsets[2], history_dtype, dset_sizes[2],
+    buffer.histories.data(), buffer.histories.size());
+}
+
+//! Write buffers as they arrive until asked to stop
+void run_writer()
+{
+  std::unique_lock<std::mutex> lock(writer_mutex);
+  while (true) {
+    writer_wake.wait(lock, [] { return !full_buffers.empty() || writer_stop; });
+    if (full_buffers.empty())
+      break;
+
+    TrackBuffer buffer = std::move(full_buffers.front());
+    full_buffers.pop_front();
+    writer_busy = true;
+    lock.unlock();
+
+    write_buffer(buffer);
+    buffer.clear();
+
+    lock.lock();
+    free_buffers.push_back(std::move(buffer));
+    writer_busy = false;
+    if (full_buffers.empty())
+      writer_idle.notify_all();
+  }
+}
+
+//! Pass a buffer to the writer and replace it with an empty one
+//
+//! The caller must hold writer_mutex.
+void submit_buffer(TrackBuffer& buffer)
+{
+  full_buffers.push_back(std::move(buffer));
+  if (free_buffers.empty()) {
+    buffer = TrackBuffer {};
+  } else {
+    buffer = std::move(free_buffers.back());
+    free_buffers.pop_back();
+  }
+  writer_wake.notify_one();
+}
+
+} // namespace
+
 //==============================================================================
 // Non-member functions
 //==============================================================================
@@ -78,10 +300,64 @@ void open_track_file()
   H5Tinsert(track_dtype, "material_id", HOFFSET(TrackState, material_id),
     H5T_NATIVE_INT);
   H5Tclose(postype);
+
+  // Create compound types for the indices of tracks and histories
+  index_dtype = H5Tcreate(H5T_COMPOUND, sizeof(struct TrackIndex));
+  H5Tinsert(
+    index_dtype, "particle", HOFFSET(TrackIndex, particle), H5T_NATIVE_INT);
+  H5Tinsert(
+    index_dtype, "offset", HOFFSET(TrackIndex, offset), H5T_NATIVE_INT64);
+  history_dtype = H5Tcreate(H5T_COMPOUND, sizeof(struct HistoryIndex));
+  H5Tinsert(history_dtype, "generation", HOFFSET(HistoryIndex, generation),
+    H5T_NATIVE_INT);
+  H5Tinsert(
+    history_dtype, "particle", HOFFSET(HistoryIndex, id), H5T_NATIVE_INT64);
+  H5Tinsert(
+    history_dtype, "offset", HOFFSET(HistoryIndex, offset), H5T_NATIVE_INT64);
+
+  // Check that the requested compression is available
+  if (settings::track_compression > 0 &&
+      H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0) {
+    warning("HDF5 was built without gzip compression; particle tracks will be "
+            "written uncompressed.");
+    settings::track_compression = 0;
+  }
+
+  // Create a buffer for each thread and start the writer
+  thread_buffers.clear();
+  for (int i = 0; i < num_threads(); ++i) {
+    thread_buffers.push_back(make_unique<TrackBuffer>());
+  }
+  writer_stop = false;
+  writer.thread = std::thread(run_writer);
+}
+
+void flush_particle_tracks()
+{
+  std::unique_lock<std::mutex> lock(writer_mutex);
+  for (auto& buffer : thread_buffers) {
+    if (!buffer->histories.empty())
+      submit_buffer(*buffer);
+  }
+  writer_idle.wait(lock, [] { return full_buffers.empty() && !writer_busy; });
 }
 
 void close_track_file()
 {
+  // Write remaining tracks and stop the writer
+  flush_particle_tracks();
+  {
+    std::lock_guard<std::mutex> lock(writer_mutex);
+    writer_stop = true;
+  }
+  writer_wake.notify_one();
+  writer.thread.join();
+  thread_buffers.clear();
+  free_buffers.clear();
+
+  close_batch_group();
+  H5Tclose(history_dtype);
+  H5Tclose(index_dtype);
   H5Tclose(track_dtype);
   file_close(track_file);
 
@@ -115,40 +391,28 @@ bool check_track_criteria(const Particle& p)
 
 void finalize_particle_track(Particle& p)
 {
-  // Determine number of coordinates for each particle
-  vector<int> offsets;
-  vector<int> particles;
-  vector<TrackState> tracks;
-  int offset = 0;
+  // Buffers only hold histories from a single batch
+  auto& buffer = *thread_buffers[thread_num()];
+  if (!buffer.histories.empty() && buffer.batch != simulation::current_batch) {
+    std::lock_guard<std::mutex> lock(writer_mutex);
+    submit_buffer(buffer);
+  }
+  buffer.batch = simulation::current_batch;
+
+  // Append the tracks of each primary/secondary particle
+  buffer.histories.push_back({simulation::current_gen, p.id(),
+    static_cast<int64_t>(buffer.tracks.size())});
   for (auto& track_i : p.tracks()) {
-    offsets.push_back(offset);
-    particles.push_back(static_cast<int>(track_i.particle));
-    offset += track_i.states.size();
-    tracks.insert(tracks.end(), track_i.states.begin(), track_i.states.end());
+    buffer.tracks.push_back({static_cast<int>(track_i.particle),
+      static_cast<int64_t>(buffer.states.size())});
+    buffer.states.insert(
+      buffer.states.end(), track_i.states.begin(), track_i.states.end());
   }
-  offsets.push_back(offset);
 
-#pragma omp critical(FinalizeParticleTrack)
-  {
-    // Create name for dataset
-    std::string dset_name = fmt::format("track_{}_{}_{}",
-      simulation::current_batch, simulation::current_gen, p.id());
-
-    // Write array of TrackState to file
-    hsize_t dims[] {static_cast<hsize_t>(tracks.size())};
-    hid_t dspace = H5Screate_simple(1, dims, nullptr);
-    hid_t dset = H5Dcreate(track_file, dset_name.c_str(), track_dtype, dspace,
-      H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
-    H5Dwrite(dset, track_dtype, H5S_ALL, H5S_ALL, H5P_DEFAULT, tracks.data());
-
-    // Write attributes
-    write_attribute(dset, "n_particles", p.tracks().size());
-    write_attribute(dset, "offsets", offsets);
-    write_attribute(dset, "particles", particles);
-
-    // Free resources
-    H5Dclose(dset);
-    H5Sclose(dspace);
+  // Hand the buffer to the writer once it is large enough
+  if (buffer.states.size() >= TRACK_BUFFER_STATES) {
+    std::lock_guard<std::mutex> lock(writer_mutex);
+    submit_buffer(buffer);
   }
 
   // Clear particle tracks
@@ -1,5 +1,7 @@
 #include "openmc/universe.h"
 
+#include <algorithm> // for max, min
+#include <cmath>     // for abs
 #include <set>
 
 #include "openmc/hdf5_interface.h"
@@ -74,10 +76,10 @@ BoundingBox Universe::bounding_box() const
 }
 
 //==============================================================================
-// UniversePartitioner implementation
+// ZPlanePartitioner implementation
 //==============================================================================
 
-UniversePartitioner::UniversePartitioner(const Universe& univ)
+ZPlanePartitioner::ZPlanePartitioner(const Universe& univ)
 {
   // Define an ordered set of surface indices that point to z-planes.  Use a
   // functor to to order the set by the z0_ values of the corresponding planes.
@@ -177,7 +179,7 @@ UniversePartitioner::UniversePartitioner(const Universe& univ)
   }
 }
 
-const vector<int32_t>& UniversePartitioner::get_cells(
+const vector<int32_t>& ZPlanePartitioner::get_cells(
   Position r, Direction u) const
 {
   // Perform a binary search for the partition containing the given coordinates.
@@ -214,4 +216,187 @@ const vector<int32_t>& UniversePartitioner::get_cells(
   }
 }
 
+double ZPlanePartitioner::average_candidates() const
+{
+  size_t n = 0;
+  for (const auto& partition : partitions_) {
+    n += partition.size();
+  }
+  return static_cast<double>(n) / partitions_.size();
+}
+
+//==============================================================================
+// OctreePartitioner implementation
+//==============================================================================
+
+OctreePartitioner::OctreePartitioner(const Universe& univ)
+{
+  // Determine the finite extent of the cells' bounding boxes along each axis
+  vector<BoundingBox> boxes;
+  Node root;
+  root.box = {INFTY, -INFTY, INFTY, -INFTY, INFTY, -INFTY};
+  double* root_min[3] {&root.box.xmin, &root.box.ymin, &root.box.zmin};
+  double* root_max[3] {&root.box.xmax, &root.box.ymax, &root.box.zmax};
+  for (auto i_cell : univ.cells_) {
+    boxes.push_back(model::cells[i_cell]->bounding_box());
+    const auto& b {boxes.back()};
+    double lower[3] {b.xmin, b.ymin, b.zmin};
+    double upper[3] {b.xmax, b.ymax, b.zmax};
+    for (int k = 0; k < 3; ++k) {
+      for (double v : {lower[k], upper[k]}) {
+        if (std::abs(v) < INFTY) {
+          *root_min[k] = std::min(*root_min[k], v);
+          *root_max[k] = std::max(*root_max[k], v);
+        }
+      }
+    }
+  }
+
+  // Only split axes with a finite, nonzero extent. Overlap tests are padded
+  // slightly so that particles on a surface, which may lie on either side of
+  // it within roundoff, still find the cell they are in.
+  double largest = 1.0;
+  for (int k = 0; k < 3; ++k) {
+    split_[k] = *root_min[k] < *root_max[k];
+    if (split_[k]) {
+      n_children_ *= 2;
+      largest = std::max(
+        {largest, std::abs(*root_min[k]), std::abs(*root_max[k])});
+    } else {
+      *root_min[k] = -INFTY;
+      *root_max[k] = INFTY;
+    }
+  }
+  padding_ = 1.0e3 * FP_COINCIDENT * largest;
+
+  vector<int> candidates(univ.cells_.size());
+  for (int i = 0; i < candidates.size(); ++i) {
+    candidates[i] = i;
+  }
+  nodes_.push_back(root);
+  this->build(0, candidates, 0, univ.cells_, boxes);
+}
+
+void OctreePartitioner::build(int i_node, const vector<int>& candidates,
+  int depth, const vector<int32_t>& cells, const vector<BoundingBox>& boxes)
+{
+  // Determine the extent of each child
+  const BoundingBox box = nodes_[i_node].box;
+  double lower[3] {box.xmin, box.ymin, box.zmin};
+  double upper[3] {box.xmax, box.ymax, box.zmax};
+  Position mid;
+  for (int k = 0; k < 3; ++k) {
+    mid[k] = split_[k] ? 0.5 * (lower[k] + upper[k]) : 0.0;
+  }
+  nodes_[i_node].mid = mid;
+
+  vector<BoundingBox> child_boxes(n_children_);
+  vector<vector<int>> child_candidates(n_children_);
+  bool progress = false;
+  for (int c = 0; c < n_children_; ++c) {
+    double child_lower[3];
+    double child_upper[3];
+    int bit = 1;
+    for (int k = 0; k < 3; ++k) {
+      child_lower[k] = lower[k];
+      child_upper[k] = upper[k];
+      if (split_[k]) {
+        if (c & bit) {
+          child_lower[k] = mid[k];
+        } else {
+          child_upper[k] = mid[k];
+        }
+        bit <<= 1;
+      }
+    }
+    child_boxes[c] = {child_lower[0], child_upper[0], child_lower[1],
+      child_upper[1], child_lower[2], child_upper[2]};
+
+    for (int i : candidates) {
+      if (this->overlaps(boxes[i], child_boxes[c]))
+        child_candidates[c].push_back(i);
+    }
+    if (child_candidates[c].size() < candidates.size())
+      progress = true;
+  }
+
+  // Make this node a leaf if it is small enough, too deep, or if splitting it
+  // would not separate any cells
+  if (candidates.size() <= OCTREE_MAX_LEAF_CELLS ||
+      depth == OCTREE_MAX_DEPTH || n_children_ == 1 || !progress) {
+    nodes_[i_node].leaf = leaves_.size();
+    leaves_.emplace_back();
+    for (int i : candidates) {
+      leaves_.back().push_back(cells[i]);
+    }
+    return;
+  }
+
+  int first_child = nodes_.size();
+  nodes_[i_node].first_child = first_child;
+  for (int c = 0; c < n_children_; ++c) {
+    Node child;
+    child.box = child_boxes[c];
+    nodes_.push_back(child);
+  }
+  for (int c = 0; c < n_children_; ++c) {
+    this->build(first_child + c, child_candidates[c], depth + 1, cells, boxes);
+  }
+}
+
+bool OctreePartitioner::overlaps(
+  const BoundingBox& cell_box, const BoundingBox& node_box) const
+{
+  return cell_box.xmin <= node_box.xmax + padding_ &&
+         cell_box.xmax >= node_box.xmin - padding_ &&
+         cell_box.ymin <= node_box.ymax + padding_ &&
+         cell_box.ymax >= node_box.ymin - padding_ &&
+         cell_box.zmin <= node_box.zmax + padding_ &&
+         cell_box.zmax >= node_box.zmin - padding_;
+}
+
+const vector<int32_t>& OctreePartitioner::get_cells(
+  Position r, Direction u) const
+{
+  // Descend to the leaf containing the coordinates. Coordinates outside the
+  // root node end up in a leaf on its boundary, which holds every cell whose
+  // bounding box extends past that boundary.
+  int i = 0;
+  while (nodes_[i].first_child >= 0) {
+    const auto& node {nodes_[i]};
+    int child = 0;
+    int bit = 1;
+    for (int k = 0; k < 3; ++k) {
+      if (split_[k]) {
+        if (r[k] >= node.mid[k])
+          child |= bit;
+        bit <<= 1;
+      }
+    }
+    i = node.first_child + child;
+  }
+  return leaves_[nodes_[i].leaf];
+}
+
+double OctreePartitioner::average_candidates() const
+{
+  // Weight the number of candidates in each leaf by its volume along the split
+  // axes relative to the root
+  const auto& root {nodes_[0].box};
+  double sum = 0.0;
+  for (const auto& node : nodes_) {
+    if (node.leaf < 0)
+      continue;
+    double fraction = 1.0;
+    if (split_[0])
+      fraction *= (node.box.xmax - node.box.xmin) / (root.xmax - root.xmin);
+    if (split_[1])
+      fraction *= (node.box.ymax - node.box.ymin) / (root.ymax - root.ymin);
+    if (split_[2])
+      fraction *= (node.box.zmax - node.box.zmin) / (root.zmax - root.zmin);
+    sum += fraction * leaves_[node.leaf].size();
+  }
+  return sum;
+}
+
 } // namespace openmc
@@ -66,6 +66,28 @@ UrrData::UrrData(hid_t group_id)
   }
 }
 
+UrrData::UrrData(CacheReader& cache)
+{
+  cache.read(interp_);
+  cache.read(inelastic_flag_);
+  cache.read(absorption_flag_);
+  cache.read(multiply_smooth_);
+  cache.read(energy_);
+  cache.read(cdf_values_);
+  cache.read(xs_values_);
+}
+
+void UrrData::serialize(CacheWriter& cache) const
+{
+  cache.write(interp_);
+  cache.write(inelastic_flag_);
+  cache.write(absorption_flag_);
+  cache.write(multiply_smooth_);
+  cache.write(energy_);
+  cache.write(cdf_values_);
+  cache.write(xs_values_);
+}
+
 bool UrrData::has_negative() const
 {
 
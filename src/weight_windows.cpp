@@ -361,8 +361,7 @@ WeightWindow WeightWindows::get_weight_window(const Particle& p) const
   }
 
   // Get mesh index for particle's position
-  const auto& mesh = this->mesh();
-  int mesh_bin = mesh->get_bin(p.r());
+  int mesh_bin = p.mesh_traversals().get_bin(mesh_idx_, p.r());
 
   // particle is outside the weight window mesh
   if (mesh_bin < 0)
@@ -654,6 +653,13 @@ void WeightWindows::update_magic(
 
 void WeightWindows::check_tally_update_compatibility(const Tally* tally)
 {
+  // the results of a decomposed tally are spread over the processes
+  if (tally->decompose_) {
+    fatal_error(fmt::format(
+      "Decomposed tally {} cannot be used to update weight windows",
+      tally->id()));
+  }
+
   // define the set of allowed filters for the tally
   const std::set<FilterType> allowed_filters = {
     FilterType::MESH, FilterType::ENERGY, FilterType::PARTICLE};
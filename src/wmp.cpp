@@ -7,6 +7,7 @@
 #include "openmc/math_functions.h"
 #include "openmc/nuclide.h"
 
+#include "xtensor/xbuilder.hpp"
 #include <fmt/core.h>
 
 #include <algorithm> // for min
@@ -14,6 +15,66 @@
 
 namespace openmc {
 
+//========================================================================
+// Faddeeva function
+//========================================================================
+
+template<bool DERIV>
+void faddeeva_cf(
+  int n, const double* x, const double* y, double* wr, double* wi)
+{
+  // Numerator q and denominator p of the innermost fraction z / 1
+  array<double, WMP_POLE_CHUNK> p_r;
+  array<double, WMP_POLE_CHUNK> p_i;
+  array<double, WMP_POLE_CHUNK> q_r;
+  array<double, WMP_POLE_CHUNK> q_i;
+#pragma omp simd
+  for (int j = 0; j < n; ++j) {
+    p_r[j] = x[j];
+    p_i[j] = y[j];
+    q_r[j] = 1.0;
+    q_i[j] = 0.0;
+  }
+
+  for (int k = WMP_CF_TERMS - 1; k > 0; --k) {
+    // Keep the numerator q_2 for the second derivative in the output arrays
+    if (DERIV && k == 2) {
+#pragma omp simd
+      for (int j = 0; j < n; ++j) {
+        wr[j] = 2.0 * q_r[j];
+        wi[j] = 2.0 * q_i[j];
+      }
+    }
+
+    // p <- z * p - k/2 * q, q <- p
+    double a = 0.5 * k;
+#pragma omp simd
+    for (int j = 0; j < n; ++j) {
+      double tr = x[j] * p_r[j] - y[j] * p_i[j] - a * q_r[j];
+      double ti = x[j] * p_i[j] + y[j] * p_r[j] - a * q_i[j];
+      q_r[j] = p_r[j];
+      q_i[j] = p_i[j];
+      p_r[j] = tr;
+      p_i[j] = ti;
+    }
+  }
+
+  // Multiply i * n / p with n = q_0 or 2 q_2
+#pragma omp simd
+  for (int j = 0; j < n; ++j) {
+    double nr = DERIV ? wr[j] : q_r[j];
+    double ni = DERIV ? wi[j] : q_i[j];
+    double inv_norm = 1.0 / (p_r[j] * p_r[j] + p_i[j] * p_i[j]);
+    wr[j] = -(ni * p_r[j] - nr * p_i[j]) * inv_norm;
+    wi[j] = (nr * p_r[j] + ni * p_i[j]) * inv_norm;
+  }
+}
+
+template void faddeeva_cf<false>(
+  int n, const double* x, const double* y, double* wr, double* wi);
+template void faddeeva_cf<true>(
+  int n, const double* x, const double* y, double* wr, double* wi);
+
 //========================================================================
 // WindowedeMultipole implementation
 //========================================================================
@@ -32,12 +93,23 @@ WindowedMultipole::WindowedMultipole(hid_t group)
 
   // Read the "data" array.  Use its shape to figure out the number of poles
   // and residue types in this data.
-  read_dataset(group, "data", data_);
-  int n_residues = data_.shape()[1] - 1;
+  xt::xtensor<std::complex<double>, 2> data;
+  read_dataset(group, "data", data);
+  size_t n_poles = data.shape()[0];
+  int n_residues = data.shape()[1] - 1;
 
   // Check to see if this data includes fission residues.
   fissionable_ = (n_residues == 3);
 
+  // Split the poles and residues into contiguous real and imaginary parts
+  poles_ = xt::zeros<double>({2 * (MP_RF + 1), n_poles});
+  for (size_t i = 0; i < n_poles; ++i) {
+    for (int j = 0; j <= n_residues; ++j) {
+      poles_(2 * j, i) = data(i, j).real();
+      poles_(2 * j + 1, i) = data(i, j).imag();
+    }
+  }
+
   // Read the "windows" array and use its shape to figure out the number of
   // windows.
   xt::xtensor<int, 2> windows;
@@ -82,88 +154,103 @@ WindowedMultipole::WindowedMultipole(hid_t group)
 std::tuple<double, double, double> WindowedMultipole::evaluate(
   double E, double sqrtkT) const
 {
-  using namespace std::complex_literals;
-
-  // ==========================================================================
-  // Bookkeeping
-
-  // Define some frequently used variables.
-  double sqrtE = std::sqrt(E);
-  double invE = 1.0 / E;
-
-  // Locate window containing energy
-  int i_window = std::min(window_info_.size() - 1,
-    static_cast<size_t>((sqrtE - std::sqrt(E_min_)) * inv_spacing_));
-  const auto& window {window_info_[i_window]};
-
-  // Initialize the ouptut cross sections
-  double sig_s = 0.0;
-  double sig_a = 0.0;
-  double sig_f = 0.0;
+  double sig_s, sig_a, sig_f;
+  this->evaluate(1, &E, &sqrtkT, &sig_s, &sig_a, &sig_f);
+  return std::make_tuple(sig_s, sig_a, sig_f);
+}
 
-  // ==========================================================================
-  // Add the contribution from the curvefit polynomial.
-
-  if (sqrtkT > 0.0 && window.broaden_poly) {
-    // Broaden the curvefit.
-    double dopp = sqrt_awr_ / sqrtkT;
-    array<double, MAX_POLY_COEFFICIENTS> broadened_polynomials;
-    broaden_wmp_polynomials(
-      E, dopp, fit_order_ + 1, broadened_polynomials.data());
-    for (int i_poly = 0; i_poly < fit_order_ + 1; ++i_poly) {
-      sig_s +=
-        curvefit_(i_window, i_poly, FIT_S) * broadened_polynomials[i_poly];
-      sig_a +=
-        curvefit_(i_window, i_poly, FIT_A) * broadened_polynomials[i_poly];
-      if (fissionable_) {
-        sig_f +=
-          curvefit_(i_window, i_poly, FIT_F) * broadened_polynomials[i_poly];
+void WindowedMultipole::evaluate(int n, const double* E, const double* sqrtkT,
+  double* sig_s, double* sig_a, double* sig_f) const
+{
+  for (int k = 0; k < n; ++k) {
+    // ========================================================================
+    // Bookkeeping
+
+    // Define some frequently used variables.
+    double sqrtE = std::sqrt(E[k]);
+    double invE = 1.0 / E[k];
+
+    // Locate window containing energy
+    int i_window = this->window_index(sqrtE);
+    const auto& window {window_info_[i_window]};
+
+    // Initialize the ouptut cross sections
+    double s = 0.0;
+    double a = 0.0;
+    double f = 0.0;
+
+    // ========================================================================
+    // Add the contribution from the curvefit polynomial.
+
+    if (sqrtkT[k] > 0.0 && window.broaden_poly) {
+      // Broaden the curvefit.
+      double dopp = sqrt_awr_ / sqrtkT[k];
+      array<double, MAX_POLY_COEFFICIENTS> broadened_polynomials;
+      broaden_wmp_polynomials(
+        E[k], dopp, fit_order_ + 1, broadened_polynomials.data());
+      for (int i_poly = 0; i_poly < fit_order_ + 1; ++i_poly) {
+        s += curvefit_(i_window, i_poly, FIT_S) * broadened_polynomials[i_poly];
+        a += curvefit_(i_window, i_poly, FIT_A) * broadened_polynomials[i_poly];
+        if (fissionable_) {
+          f +=
+            curvefit_(i_window, i_poly, FIT_F) * broadened_polynomials[i_poly];
+        }
       }
-    }
-  } else {
-    // Evaluate as if it were a polynomial
-    double temp = invE;
-    for (int i_poly = 0; i_poly < fit_order_ + 1; ++i_poly) {
-      sig_s += curvefit_(i_window, i_poly, FIT_S) * temp;
-      sig_a += curvefit_(i_window, i_poly, FIT_A) * temp;
-      if (fissionable_) {
-        sig_f += curvefit_(i_window, i_poly, FIT_F) * temp;
+    } else {
+      // Evaluate as if it were a polynomial
+      double temp = invE;
+      for (int i_poly = 0; i_poly < fit_order_ + 1; ++i_poly) {
+        s += curvefit_(i_window, i_poly, FIT_S) * temp;
+        a += curvefit_(i_window, i_poly, FIT_A) * temp;
+        if (fissionable_) {
+          f += curvefit_(i_window, i_poly, FIT_F) * temp;
+        }
+        temp *= sqrtE;
       }
-      temp *= sqrtE;
     }
-  }
-
-  // ==========================================================================
-  // Add the contribution from the poles in this window.
 
-  if (sqrtkT == 0.0) {
-    // If at 0K, use asymptotic form.
-    for (int i_pole = window.index_start; i_pole <= window.index_end;
-         ++i_pole) {
-      std::complex<double> psi_chi = -1.0i / (data_(i_pole, MP_EA) - sqrtE);
-      std::complex<double> c_temp = psi_chi * invE;
-      sig_s += (data_(i_pole, MP_RS) * c_temp).real();
-      sig_a += (data_(i_pole, MP_RA) * c_temp).real();
-      if (fissionable_) {
-        sig_f += (data_(i_pole, MP_RF) * c_temp).real();
-      }
-    }
-  } else {
-    // At temperature, use Faddeeva function-based form.
-    double dopp = sqrt_awr_ / sqrtkT;
-    for (int i_pole = window.index_start; i_pole <= window.index_end;
-         ++i_pole) {
-      std::complex<double> z = (sqrtE - data_(i_pole, MP_EA)) * dopp;
-      std::complex<double> w_val = faddeeva(z) * dopp * invE * SQRT_PI;
-      sig_s += (data_(i_pole, MP_RS) * w_val).real();
-      sig_a += (data_(i_pole, MP_RA) * w_val).real();
-      if (fissionable_) {
-        sig_f += (data_(i_pole, MP_RF) * w_val).real();
+    // ========================================================================
+    // Add the contribution from the poles in this window.
+
+    double sum_s = 0.0;
+    double sum_a = 0.0;
+    double sum_f = 0.0;
+    if (sqrtkT[k] == 0.0) {
+      // If at 0K, use asymptotic form, Re[r * -i / (pole - sqrt(E))]
+      const double* p_r = &poles_(2 * MP_EA, 0);
+      const double* p_i = &poles_(2 * MP_EA + 1, 0);
+      const double* rs_r = &poles_(2 * MP_RS, 0);
+      const double* rs_i = &poles_(2 * MP_RS + 1, 0);
+      const double* ra_r = &poles_(2 * MP_RA, 0);
+      const double* ra_i = &poles_(2 * MP_RA + 1, 0);
+      const double* rf_r = &poles_(2 * MP_RF, 0);
+      const double* rf_i = &poles_(2 * MP_RF + 1, 0);
+#pragma omp simd reduction(+ : sum_s, sum_a, sum_f)
+      for (int i = window.index_start; i <= window.index_end; ++i) {
+        double dr = p_r[i] - sqrtE;
+        double inv_norm = 1.0 / (dr * dr + p_i[i] * p_i[i]);
+        double psi_r = -p_i[i] * inv_norm;
+        double psi_i = -dr * inv_norm;
+        sum_s += rs_r[i] * psi_r - rs_i[i] * psi_i;
+        sum_a += ra_r[i] * psi_r - ra_i[i] * psi_i;
+        sum_f += rf_r[i] * psi_r - rf_i[i] * psi_i;
       }
+      sum_s *= invE;
+      sum_a *= invE;
+      sum_f *= invE;
+    } else {
+      // At temperature, use Faddeeva function-based form.
+      double dopp = sqrt_awr_ / sqrtkT[k];
+      this->sum_poles<false>(window, sqrtE, dopp, sum_s, sum_a, sum_f);
+      sum_s *= dopp * invE;
+      sum_a *= dopp * invE;
+      sum_f *= dopp * invE;
     }
-  }
 
-  return std::make_tuple(sig_s, sig_a, sig_f);
+    sig_s[k] = s + sum_s;
+    sig_a[k] = a + sum_a;
+    sig_f[k] = fissionable_ ? f + sum_f : 0.0;
+  }
 }
 
 std::tuple<double, double, double> WindowedMultipole::evaluate_deriv(
@@ -183,13 +270,7 @@ std::tuple<double, double, double> WindowedMultipole::evaluate_deriv(
   }
 
   // Locate us
-  int i_window = (sqrtE - std::sqrt(E_min_)) * inv_spacing_;
-  const auto& window {window_info_[i_window]};
-
-  // Initialize the ouptut cross sections.
-  double sig_s = 0.0;
-  double sig_a = 0.0;
-  double sig_f = 0.0;
+  const auto& window {window_info_[this->window_index(sqrtE)]};
 
   // TODO Polynomials: Some of the curvefit polynomials Doppler broaden so
   // rigorously we should be computing the derivative of those.  But in
@@ -200,23 +281,97 @@ std::tuple<double, double, double> WindowedMultipole::evaluate_deriv(
   // Add the contribution from the poles in this window.
 
   double dopp = sqrt_awr_ / sqrtkT;
-  for (int i_pole = window.index_start; i_pole <= window.index_end; ++i_pole) {
-    std::complex<double> z = (sqrtE - data_(i_pole, MP_EA)) * dopp;
-    std::complex<double> w_val = -invE * SQRT_PI * 0.5 * w_derivative(z, 2);
-    sig_s += (data_(i_pole, MP_RS) * w_val).real();
-    sig_a += (data_(i_pole, MP_RA) * w_val).real();
-    if (fissionable_) {
-      sig_f += (data_(i_pole, MP_RF) * w_val).real();
-    }
-  }
+  double sig_s, sig_a, sig_f;
+  this->sum_poles<true>(window, sqrtE, dopp, sig_s, sig_a, sig_f);
   double norm = -0.5 * sqrt_awr_ / std::sqrt(K_BOLTZMANN) * std::pow(T, -1.5);
+  norm *= -0.5 * invE;
   sig_s *= norm;
   sig_a *= norm;
-  sig_f *= norm;
+  sig_f = fissionable_ ? sig_f * norm : 0.0;
 
   return std::make_tuple(sig_s, sig_a, sig_f);
 }
 
+int WindowedMultipole::window_index(double sqrtE) const
+{
+  return std::min(window_info_.size() - 1,
+    static_cast<size_t>((sqrtE - std::sqrt(E_min_)) * inv_spacing_));
+}
+
+template<bool DERIV>
+void WindowedMultipole::sum_poles(const WindowInfo& window, double sqrtE,
+  double dopp, double& sum_s, double& sum_a, double& sum_f) const
+{
+  // The poles are processed in chunks. Within a chunk, the truncated
+  // continued fraction is evaluated for every pole with vectorized loops. The
+  // few poles that are too close to the evaluation point for the continued
+  // fraction to be accurate are then handled with the full Faddeeva function
+  // in a scalar loop.
+  const double* p_r = &poles_(2 * MP_EA, 0);
+  const double* p_i = &poles_(2 * MP_EA + 1, 0);
+  const double* rs_r = &poles_(2 * MP_RS, 0);
+  const double* rs_i = &poles_(2 * MP_RS + 1, 0);
+  const double* ra_r = &poles_(2 * MP_RA, 0);
+  const double* ra_i = &poles_(2 * MP_RA + 1, 0);
+  const double* rf_r = &poles_(2 * MP_RF, 0);
+  const double* rf_i = &poles_(2 * MP_RF + 1, 0);
+  const double radius2 = WMP_CF_RADIUS * WMP_CF_RADIUS;
+
+  double s = 0.0;
+  double a = 0.0;
+  double f = 0.0;
+  for (int start = window.index_start; start <= window.index_end;
+       start += WMP_POLE_CHUNK) {
+    int n = std::min(WMP_POLE_CHUNK, window.index_end + 1 - start);
+    array<double, WMP_POLE_CHUNK> z_r;
+    array<double, WMP_POLE_CHUNK> z_i;
+    array<double, WMP_POLE_CHUNK> w_r;
+    array<double, WMP_POLE_CHUNK> w_i;
+#pragma omp simd
+    for (int j = 0; j < n; ++j) {
+      z_r[j] = (sqrtE - p_r[start + j]) * dopp;
+      z_i[j] = -p_i[start + j] * dopp;
+    }
+    faddeeva_cf<DERIV>(n, z_r.data(), z_i.data(), w_r.data(), w_i.data());
+
+    // Exclude poles that are handled by the full Faddeeva function
+    array<int, WMP_POLE_CHUNK> near;
+    int n_near = 0;
+#pragma omp simd reduction(+ : s, a, f, n_near)
+    for (int j = 0; j < n; ++j) {
+      int i = start + j;
+      int is_near = (z_r[j] * z_r[j] + z_i[j] * z_i[j] < radius2);
+      double wr = is_near ? 0.0 : w_r[j];
+      double wi = is_near ? 0.0 : w_i[j];
+      s += rs_r[i] * wr - rs_i[i] * wi;
+      a += ra_r[i] * wr - ra_i[i] * wi;
+      f += rf_r[i] * wr - rf_i[i] * wi;
+      near[j] = is_near;
+      n_near += is_near;
+    }
+
+    if (n_near == 0)
+      continue;
+    for (int j = 0; j < n; ++j) {
+      if (!near[j])
+        continue;
+      int i = start + j;
+      std::complex<double> z {z_r[j], z_i[j]};
+      std::complex<double> w =
+        SQRT_PI * (DERIV ? w_derivative(z, 2) : faddeeva(z));
+      double wr = w.real();
+      double wi = w.imag();
+      s += rs_r[i] * wr - rs_i[i] * wi;
+      a += ra_r[i] * wr - ra_i[i] * wi;
+      f += rf_r[i] * wr - rf_i[i] * wi;
+    }
+  }
+
+  sum_s = s;
+  sum_a = a;
+  sum_f = f;
+}
+
 //========================================================================
 // Non-member functions
 //========================================================================
@@ -250,11 +405,12 @@ void read_multipole_data(int i_nuclide)
     return;
 
   // Check if WMP library exists
-  int idx = it->second;
-  std::string& filename = data::libraries[idx].path_;
+  auto& library = data::libraries[it->second];
+  const auto& filename = library.path_;
 
   // Display message
   write_message(6, "Reading {} WMP data from {}", nuc->name_, filename);
+  library.timer_.start();
 
   // Open file and make sure version is sufficient
   hid_t file = file_open(filename, 'r');
@@ -265,6 +421,7 @@ void read_multipole_data(int i_nuclide)
   nuc->multipole_ = make_unique<WindowedMultipole>(group);
   close_group(group);
   file_close(file);
+  library.timer_.stop();
 }
 
 void broaden_wmp_polynomials(double E, double dopp, int n, double factors[])
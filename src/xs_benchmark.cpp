@@ -0,0 +1,324 @@
+//! \file xs_benchmark.cpp
+//! \brief Benchmark of continuous-energy cross section lookups
+//!
+//! A material made up of nuclides with synthetic cross sections is created so
+//! that lookups can be timed without nuclear data or a model. Lookups are
+//! performed one particle at a time (history-based), over a queue of particles
+//! (event-based), and with the banked kernel used by the event-based mode for
+//! several sizes of the logarithmic grid and numbers of threads.
+
+#include <algorithm> // for min, replace, sort, unique
+#include <cmath>
+#include <cstdlib> // for exit, EXIT_FAILURE
+#include <string>
+
+#include "xtensor/xtensor.hpp"
+#include <fmt/core.h>
+
+#include "openmc/array.h"
+#include "openmc/constants.h"
+#include "openmc/error.h"
+#include "openmc/material.h"
+#include "openmc/memory.h"
+#include "openmc/nuclide.h"
+#include "openmc/openmp_interface.h"
+#include "openmc/particle.h"
+#include "openmc/random_lcg.h"
+#include "openmc/settings.h"
+#include "openmc/simulation.h"
+#include "openmc/string_utils.h"
+#include "openmc/timer.h"
+#include "openmc/vector.h"
+
+using namespace openmc;
+
+namespace {
+
+enum class LookupMode { HISTORY, EVENT, BANKED };
+
+struct Options {
+  int n_nuclides {50};                   //!< Number of nuclides in material
+  int n_grid {20000};                    //!< Energy points per temperature
+  int n_temperatures {3};                //!< Temperatures per nuclide
+  int64_t n_lookups {1000000};           //!< Lookups per thread
+  vector<int> log_bins {8000};           //!< Sizes of the logarithmic grid
+  std::string energy_grid {"logarithm"}; //!< Energy grid search method
+};
+
+void print_usage()
+{
+  fmt::print(
+    "Usage: openmc_xs_benchmark [options]\n\n"
+    "Options:\n"
+    "  -n <int>     Number of nuclides in the material (default: 50)\n"
+    "  -g <int>     Energy points per nuclide and temperature (default: "
+    "20000)\n"
+    "  -t <int>     Temperatures per nuclide (default: 3)\n"
+    "  -l <int>     Lookups per thread (default: 1000000)\n"
+    "  -b <int,...> Sizes of the logarithmic grid (default: 8000)\n"
+    "  -e <method>  Energy grid method: logarithm, material-union or hash\n"
+    "               (default: logarithm)\n"
+    "  -h           Show this message\n");
+}
+
+Options parse_options(int argc, char* argv[])
+{
+  Options opts;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg {argv[i]};
+    if (arg == "-h") {
+      print_usage();
+      std::exit(0);
+    }
+    if (i + 1 == argc) {
+      print_usage();
+      fatal_error("Missing value for option " + arg + ".");
+    }
+    std::string value {argv[++i]};
+    if (arg == "-n") {
+      opts.n_nuclides = std::stoi(value);
+    } else if (arg == "-g") {
+      opts.n_grid = std::stoi(value);
+    } else if (arg == "-t") {
+      opts.n_temperatures = std::stoi(value);
+    } else if (arg == "-l") {
+      opts.n_lookups = std::stoll(value);
+    } else if (arg == "-b") {
+      opts.log_bins.clear();
+      std::replace(value.begin(), value.end(), ',', ' ');
+      for (const auto& word : split(value)) {
+        opts.log_bins.push_back(std::stoi(word));
+      }
+    } else if (arg == "-e") {
+      opts.energy_grid = value;
+    } else {
+      print_usage();
+      fatal_error("Unrecognized option " + arg + ".");
+    }
+  }
+
+  if (opts.n_nuclides < 1 || opts.n_grid < 2 || opts.n_temperatures < 1 ||
+      opts.n_lookups < 1 || opts.log_bins.empty()) {
+    fatal_error("Benchmark options must be positive.");
+  }
+  return opts;
+}
+
+//! Create a nuclide with synthetic cross sections
+//
+//! The energy grid and the total, absorption, fission, and nu-fission cross
+//! sections are sampled randomly. The nuclide has no reactions and cannot be
+//! used for transport.
+//
+//! \param[in] name Name of the nuclide
+//! \param[in] temperature Temperatures in [K]
+//! \param[in] n_grid Number of energy points at each temperature
+//! \param[in] fissionable Whether the nuclide has fission cross sections
+//! \param[inout] seed Pseudorandom seed pointer
+//! \return Nuclide that is appended to data::nuclides
+unique_ptr<Nuclide> synthetic_nuclide(const std::string& name,
+  const vector<double>& temperature, int n_grid, bool fissionable,
+  uint64_t* seed)
+{
+  auto nuc = make_unique<Nuclide>();
+  nuc->index_ = data::nuclides.size();
+  nuc->name_ = name;
+  data::nuclide_map[name] = nuc->index_;
+  nuc->Z_ = 0;
+  nuc->A_ = 0;
+  nuc->metastable_ = 0;
+  nuc->awr_ = 1.0;
+  nuc->reaction_index_.fill(C_NONE);
+  nuc->fissionable_ = fissionable;
+
+  for (double T : temperature) {
+    nuc->kTs_.push_back(K_BOLTZMANN * T);
+
+    // Sample energies uniformly in lethargy between the bounds of typical
+    // continuous-energy data. Each temperature gets its own grid, as with
+    // Doppler-broadened data.
+    vector<double> energy;
+    constexpr double E_low {1.0e-5};
+    constexpr double E_high {2.0e7};
+    energy.push_back(E_low);
+    for (int i = 0; i < n_grid - 2; ++i) {
+      energy.push_back(E_low * std::pow(E_high / E_low, prn(seed)));
+    }
+    energy.push_back(E_high);
+    std::sort(energy.begin(), energy.end());
+    energy.erase(std::unique(energy.begin(), energy.end()), energy.end());
+
+    // Cross sections with a 1/v absorption component and random fluctuations
+    // standing in for resonances
+    int n = energy.size();
+    array<size_t, 2> shape {static_cast<size_t>(n), 5};
+    xt::xtensor<double, 2> xs(shape, 0.0);
+    for (int i = 0; i < n; ++i) {
+      double E = energy[i];
+      double absorption = (1.0 + 10.0 * prn(seed)) / std::sqrt(E);
+      double fission = fissionable ? 0.5 * absorption : 0.0;
+      xs(i, Nuclide::XS_TOTAL) = 5.0 + 10.0 * prn(seed) + absorption;
+      xs(i, Nuclide::XS_ABSORPTION) = absorption;
+      xs(i, Nuclide::XS_FISSION) = fission;
+      xs(i, Nuclide::XS_NU_FISSION) = 2.5 * fission;
+    }
+    Nuclide::EnergyGrid grid;
+    grid.energy = std::move(energy);
+    nuc->grid_.push_back(std::move(grid));
+    nuc->xs_.emplace_back(xs);
+  }
+  return nuc;
+}
+
+//! Sample the energy and temperature of a particle
+void sample_particle(Particle& p, const vector<double>& kTs, uint64_t* seed)
+{
+  int neutron = static_cast<int>(ParticleType::neutron);
+  double E_min = data::energy_min[neutron];
+  double E_max = data::energy_max[neutron];
+  p.E() = E_min * std::pow(E_max / E_min, prn(seed));
+  p.sqrtkT() = std::sqrt(kTs[static_cast<int>(prn(seed) * kTs.size())]);
+}
+
+//! Perform lookups on all threads
+//
+//! \param[in] mat Material to look up cross sections in
+//! \param[in] mode How lookups are grouped
+//! \param[in] n_threads Number of threads
+//! \param[in] n_lookups Number of lookups per thread
+//! \param[in] kTs Temperatures in [eV] that particles are sampled at
+//! \param[out] sum Sum of the macroscopic total cross sections
+//! \return Lookups per second
+double run(const Material& mat, LookupMode mode, int n_threads,
+  int64_t n_lookups, const vector<double>& kTs, double& sum)
+{
+  sum = 0.0;
+  Timer timer;
+  timer.start();
+#pragma omp parallel num_threads(n_threads) reduction(+ : sum)
+  {
+    // Each thread has its own particles, whose cross section caches are laid
+    // out for the material on the first lookup
+    vector<Particle> particles(XS_LOOKUP_BANK_SIZE);
+    array<Particle*, XS_LOOKUP_BANK_SIZE> bank;
+    for (int k = 0; k < XS_LOOKUP_BANK_SIZE; ++k) {
+      bank[k] = &particles[k];
+    }
+
+    // Every mode samples the same energies, so the sums can be compared
+    uint64_t seed = init_seed(thread_num(), STREAM_TRACKING);
+    for (int64_t i = 0; i < n_lookups; i += XS_LOOKUP_BANK_SIZE) {
+      int n = std::min<int64_t>(XS_LOOKUP_BANK_SIZE, n_lookups - i);
+      switch (mode) {
+      case LookupMode::HISTORY:
+        for (int k = 0; k < n; ++k) {
+          Particle& p = particles[0];
+          sample_particle(p, kTs, &seed);
+          mat.calculate_xs(p);
+          sum += p.macro_xs().total;
+        }
+        break;
+      case LookupMode::EVENT:
+        for (int k = 0; k < n; ++k) {
+          sample_particle(particles[k], kTs, &seed);
+        }
+        for (int k = 0; k < n; ++k) {
+          mat.calculate_xs(particles[k]);
+        }
+        for (int k = 0; k < n; ++k) {
+          sum += particles[k].macro_xs().total;
+        }
+        break;
+      case LookupMode::BANKED:
+        for (int k = 0; k < n; ++k) {
+          sample_particle(particles[k], kTs, &seed);
+        }
+        mat.calculate_neutron_xs_banked({bank.data(), bank.data() + n});
+        for (int k = 0; k < n; ++k) {
+          sum += particles[k].macro_xs().total;
+        }
+        break;
+      }
+    }
+  }
+  timer.stop();
+
+  return n_threads * n_lookups / timer.elapsed();
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  Options opts = parse_options(argc, argv);
+
+  settings::verbosity = 5;
+  if (opts.energy_grid == "logarithm") {
+    settings::energy_grid_method = EnergyGridMethod::LOGARITHM;
+  } else if (opts.energy_grid == "material-union") {
+    settings::energy_grid_method = EnergyGridMethod::MATERIAL_UNION;
+  } else if (opts.energy_grid == "hash") {
+    settings::energy_grid_method = EnergyGridMethod::HASH;
+  } else {
+    fatal_error("Unrecognized energy grid method: " + opts.energy_grid + ".");
+  }
+
+  // Create nuclides with synthetic data; only the first one is fissionable
+  vector<double> temperatures;
+  vector<double> kTs;
+  for (int t = 0; t < opts.n_temperatures; ++t) {
+    temperatures.push_back(294.0 + 300.0 * t);
+    kTs.push_back(K_BOLTZMANN * temperatures.back());
+  }
+  uint64_t seed = init_seed(0, STREAM_SOURCE);
+  vector<std::string> names;
+  vector<double> densities;
+  for (int i = 0; i < opts.n_nuclides; ++i) {
+    names.push_back(fmt::format("X{}", i));
+    densities.push_back(1.0e-3 * (1.0 + prn(&seed)));
+    data::nuclides.push_back(synthetic_nuclide(
+      names.back(), temperatures, opts.n_grid, i == 0, &seed));
+  }
+
+  model::materials.push_back(make_unique<Material>());
+  Material& mat {*model::materials.back()};
+  mat.set_densities(names, densities);
+  mat.init_nuclide_index();
+
+  fmt::print("Nuclides: {}, energy points: {}, temperatures: {}, energy grid: "
+             "{}, lookups per thread: {}\n\n",
+    opts.n_nuclides, opts.n_grid, opts.n_temperatures, opts.energy_grid,
+    opts.n_lookups);
+  fmt::print("{:>8} {:>10} {:>8} {:>16}\n", "Mode", "Log bins", "Threads",
+    "Lookups/s");
+
+  const char* mode_names[] {"history", "event", "banked"};
+  int status = 0;
+  for (int n_log_bins : opts.log_bins) {
+    // Rebuild the search data for this size of the logarithmic grid
+    settings::n_log_bins = n_log_bins;
+    initialize_data();
+
+    for (int n_threads = 1; n_threads <= num_threads(); n_threads *= 2) {
+      double sum[3];
+      for (auto mode :
+        {LookupMode::HISTORY, LookupMode::EVENT, LookupMode::BANKED}) {
+        int m = static_cast<int>(mode);
+        double rate = run(mat, mode, n_threads, opts.n_lookups, kTs, sum[m]);
+        fmt::print("{:>8} {:>10} {:>8} {:>16.4e}\n", mode_names[m],
+          n_log_bins, n_threads, rate);
+      }
+
+      // All modes must give the same cross sections up to roundoff
+      for (int m = 1; m < 3; ++m) {
+        if (std::abs(sum[m] - sum[0]) > 1.0e-10 * std::abs(sum[0])) {
+          fmt::print("Cross sections differ between {} and {} lookups\n",
+            mode_names[0], mode_names[m]);
+          status = EXIT_FAILURE;
+        }
+      }
+    }
+  }
+
+  return status;
+}
@@ -0,0 +1,175 @@
+#include "openmc/xs_cache.h"
+
+#include <cstdint> // for uint64_t
+#include <cstdio>  // for rename, remove
+#include <cstring> // for memcpy
+#include <fstream>
+#include <random> // for random_device
+
+#include <fmt/core.h>
+#include <sys/stat.h>
+
+#include "openmc/constants.h"
+#include "openmc/hdf5_interface.h"
+#include "openmc/settings.h"
+
+namespace openmc {
+
+namespace {
+
+//! Checksum of a byte sequence, processed in 64-bit words with the FNV-1a
+//! multiplier and an extra shift so that high bits also reach the low bits
+uint64_t checksum(gsl::span<const char> data)
+{
+  constexpr uint64_t prime {0x100000001b3};
+  uint64_t h {0xcbf29ce484222325};
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= data.size(); i += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, data.data() + i, sizeof(uint64_t));
+    h = (h ^ word) * prime;
+    h ^= h >> 29;
+  }
+  for (; i < data.size(); ++i) {
+    h = (h ^ static_cast<unsigned char>(data[i])) * prime;
+  }
+  return h;
+}
+
+//! Append the status of a file to a cache key. Besides the size and the
+//! modification time, the status change time and the inode are included since
+//! they change whenever a file is replaced or rewritten, even if its
+//! modification time is preserved. Times are given to the nanosecond so that
+//! a file that is rewritten within the same second is also detected.
+void write_file_status(CacheWriter& key, const std::string& filename)
+{
+  struct stat s;
+  if (stat(filename.c_str(), &s) != 0) {
+    throw std::runtime_error {"Could not determine the status of " + filename};
+  }
+#ifdef __APPLE__
+  const auto& mtime = s.st_mtimespec;
+  const auto& ctime = s.st_ctimespec;
+#else
+  const auto& mtime = s.st_mtim;
+  const auto& ctime = s.st_ctim;
+#endif
+  key.write(static_cast<int64_t>(s.st_size));
+  key.write(static_cast<uint64_t>(s.st_ino));
+  key.write(static_cast<int64_t>(mtime.tv_sec));
+  key.write(static_cast<int64_t>(mtime.tv_nsec));
+  key.write(static_cast<int64_t>(ctime.tv_sec));
+  key.write(static_cast<int64_t>(ctime.tv_nsec));
+}
+
+} // namespace
+
+//==============================================================================
+// CacheWriter implementation
+//==============================================================================
+
+void CacheWriter::write(const std::string& value)
+{
+  write(value.size());
+  write_bytes(value.data(), value.size());
+}
+
+void CacheWriter::write_bytes(const void* p, size_t n)
+{
+  const char* bytes = static_cast<const char*>(p);
+  data_.insert(data_.end(), bytes, bytes + n);
+}
+
+//==============================================================================
+// CacheReader implementation
+//==============================================================================
+
+void CacheReader::read(std::string& value)
+{
+  size_t n = read<size_t>();
+  check_remaining(n, 1);
+  value.assign(data_.data() + pos_, n);
+  pos_ += n;
+}
+
+void CacheReader::read_bytes(void* p, size_t n)
+{
+  check_remaining(n, 1);
+  std::memcpy(p, data_.data() + pos_, n);
+  pos_ += n;
+}
+
+void CacheReader::check_remaining(size_t n, size_t size) const
+{
+  if (n > (data_.size() - pos_) / size) {
+    throw std::runtime_error {"Unexpected end of cross section cache data."};
+  }
+}
+
+//==============================================================================
+// XsCacheEntry implementation
+//==============================================================================
+
+XsCacheEntry::XsCacheEntry(hid_t group, const vector<int>& temperatures)
+{
+  // Determine the nuclide and the library file it is read from
+  std::string name = object_name(group).substr(1);
+  vector<char> buffer(H5Fget_name(group, nullptr, 0) + 1);
+  H5Fget_name(group, buffer.data(), buffer.size());
+  std::string filename {buffer.data()};
+
+  // Changes to the library are detected through the status of the file,
+  // since hashing its contents would take as long as reading it
+  key_.write(std::string {"openmc-xs-cache"});
+  key_.write(VERSION_XS_CACHE);
+  key_.write(name);
+  key_.write(filename);
+  write_file_status(key_, filename);
+  key_.write(temperatures);
+
+  path_ = fmt::format(
+    "{}{}_{:016x}.cache", settings::path_xs_cache, name, checksum(key_.data()));
+}
+
+bool XsCacheEntry::load(CacheReader& cache) const
+{
+  // Read the whole file at once
+  std::ifstream file {path_, std::ios::binary | std::ios::ate};
+  if (!file)
+    return false;
+  std::streamsize size = file.tellg();
+  file.seekg(0);
+  vector<char> data(size);
+  if (!file.read(data.data(), size))
+    return false;
+  cache = CacheReader {std::move(data)};
+
+  // Make sure that the entry belongs to the same library and temperatures and
+  // that the data were written completely
+  try {
+    auto key = cache.read<vector<char>>();
+    auto sum = cache.read<uint64_t>();
+    return key == key_.data() && sum == checksum(cache.unread());
+  } catch (const std::runtime_error&) {
+    return false;
+  }
+}
+
+void XsCacheEntry::store(const CacheWriter& cache) const
+{
+  CacheWriter header;
+  header.write(key_.data());
+  header.write(checksum(cache.data()));
+
+  std::string tmp = fmt::format("{}.{:08x}", path_, std::random_device {}());
+  std::ofstream file {tmp, std::ios::binary};
+  file.write(header.data().data(), header.data().size());
+  file.write(cache.data().data(), cache.data().size());
+  file.close();
+  if (!file || std::rename(tmp.c_str(), path_.c_str()) != 0) {
+    std::remove(tmp.c_str());
+    throw std::runtime_error {"Could not write " + path_ + "."};
+  }
+}
+
+} // namespace openmc
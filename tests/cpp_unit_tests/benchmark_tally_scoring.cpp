@@ -0,0 +1,208 @@
+//! \file benchmark_tally_scoring.cpp
+//! \brief Microbenchmark of tally scoring with synthetic particles
+//!
+//! Tracklength and collision tallies over a regular mesh and an energy filter
+//! are scored for randomly placed particles, so no geometry or nuclear data
+//! is needed. For each thread count, the number of scoring events per second
+//! is reported with tally results accumulated both atomically and in
+//! thread-private buffers.
+//!
+//! Usage: benchmark_tally_scoring [events per thread] [mesh cells per side]
+
+#include <cmath>
+#include <cstdint> // for SIZE_MAX
+#include <cstdlib>
+#include <string>
+
+#include <fmt/core.h>
+#include <pugixml.hpp>
+
+#include "openmc/constants.h"
+#include "openmc/mesh.h"
+#include "openmc/openmp_interface.h"
+#include "openmc/particle.h"
+#include "openmc/random_lcg.h"
+#include "openmc/tallies/filter_energy.h"
+#include "openmc/tallies/filter_mesh.h"
+#include "openmc/tallies/tally.h"
+#include "openmc/tallies/tally_scoring.h"
+#include "openmc/timer.h"
+
+using namespace openmc;
+
+namespace {
+
+constexpr double HALF_WIDTH {50.0}; // Half width of the mesh in [cm]
+constexpr double E_MIN {1.0e-5};    // Lower energy bound in [eV]
+constexpr double E_MAX {2.0e7};     // Upper energy bound in [eV]
+
+enum class Benchmark { FILTER_BIN_ITER, TRACKLENGTH, COLLISION };
+
+//! Move a particle along a random track inside the mesh
+void sample_event(Particle& p, uint64_t* seed)
+{
+  double mu = 2.0 * prn(seed) - 1.0;
+  double phi = 2.0 * PI * prn(seed);
+  double s = std::sqrt(1.0 - mu * mu);
+  p.u() = {s * std::cos(phi), s * std::sin(phi), mu};
+
+  // Start anywhere in the inner half of the mesh and travel up to a quarter
+  // of its width so that the track stays inside
+  for (int i = 0; i < 3; ++i) {
+    p.r_last()[i] = HALF_WIDTH * (prn(seed) - 0.5);
+  }
+  double distance = 0.5 * HALF_WIDTH * prn(seed);
+  p.r() = p.r_last() + distance * p.u();
+
+  p.E_last() = E_MIN * std::pow(E_MAX / E_MIN, prn(seed));
+  p.E() = p.E_last();
+  p.wgt() = 1.0;
+  p.wgt_last() = 1.0;
+  p.macro_xs().total = 0.5 + prn(seed);
+}
+
+//! Run one benchmark on all threads and return the events per second
+double run(Benchmark benchmark, int n_threads, int64_t n_events)
+{
+  Timer timer;
+  timer.start();
+#pragma omp parallel num_threads(n_threads)
+  {
+    // The particle must be created after the filters so that it has room for
+    // all filter matches
+    Particle p;
+    uint64_t seed = init_seed(thread_num(), STREAM_TRACKING);
+    double weight_sum = 0.0;
+
+    for (int64_t i = 0; i < n_events; ++i) {
+      sample_event(p, &seed);
+      double distance = (p.r() - p.r_last()).norm();
+
+      switch (benchmark) {
+      case Benchmark::FILTER_BIN_ITER:
+        for (auto i_tally : model::active_tracklength_tallies) {
+          const Tally& tally {*model::tallies[i_tally]};
+          auto filter_iter = FilterBinIter(tally, p);
+          auto end = FilterBinIter(tally, true, &p.filter_matches());
+          for (; filter_iter != end; ++filter_iter) {
+            weight_sum += filter_iter.weight_;
+          }
+        }
+        for (auto& match : p.filter_matches())
+          match.bins_present_ = false;
+        reset_filter_match_arena();
+        break;
+      case Benchmark::TRACKLENGTH:
+        score_tracklength_tally(p, distance);
+        break;
+      case Benchmark::COLLISION:
+        score_collision_tally(p);
+        break;
+      }
+    }
+
+    // Keep the filter benchmark from being optimized away
+    if (weight_sum < 0.0)
+      fmt::print("{}\n", weight_sum);
+  }
+  reduce_tally_buffers();
+  timer.stop();
+
+  return n_threads * n_events / timer.elapsed();
+}
+
+//! Sum the values of all tallies for the current realization
+double sum_results()
+{
+  double sum = 0.0;
+  for (const auto& t : model::tallies) {
+    auto n = t->results_.shape();
+    for (int i = 0; i < n[0]; ++i) {
+      for (int j = 0; j < n[1]; ++j) {
+        sum += t->results_(i, j, TallyResult::VALUE);
+      }
+    }
+  }
+  return sum;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+  int64_t n_events = (argc > 1) ? std::stoll(argv[1]) : 100000;
+  int n_mesh = (argc > 2) ? std::stoi(argv[2]) : 40;
+
+  // Create a regular mesh
+  pugi::xml_document doc;
+  auto node = doc.append_child("mesh");
+  node.append_attribute("id") = 1;
+  node.append_child("dimension").text() =
+    fmt::format("{0} {0} {0}", n_mesh).c_str();
+  node.append_child("lower_left").text() =
+    fmt::format("{0} {0} {0}", -HALF_WIDTH).c_str();
+  node.append_child("upper_right").text() =
+    fmt::format("{0} {0} {0}", HALF_WIDTH).c_str();
+  model::meshes.push_back(make_unique<RegularMesh>(node));
+  model::mesh_map[1] = model::meshes.size() - 1;
+
+  // Create mesh and energy filters with equal-lethargy energy bins
+  auto mesh_filter = Filter::create<MeshFilter>();
+  mesh_filter->set_mesh(model::meshes.size() - 1);
+  auto energy_filter = Filter::create<EnergyFilter>();
+  vector<double> energies;
+  for (int i = 0; i <= 100; ++i) {
+    energies.push_back(E_MIN * std::pow(E_MAX / E_MIN, i / 100.0));
+  }
+  energy_filter->set_bins(energies);
+
+  // Create a tracklength and a collision tally with both filters
+  vector<Filter*> filters {mesh_filter, energy_filter};
+  for (auto estimator :
+    {TallyEstimator::TRACKLENGTH, TallyEstimator::COLLISION}) {
+    Tally* tally = Tally::create();
+    tally->set_filters(filters);
+    tally->set_scores(vector<std::string> {"flux", "total"});
+    tally->estimator_ = estimator;
+    tally->set_active(true);
+    tally->set_strides();
+    tally->init_results();
+  }
+  setup_active_tallies();
+
+  fmt::print("Mesh: {0}x{0}x{0}, energy bins: {1}, events per thread: {2}\n\n",
+    n_mesh, energies.size() - 1, n_events);
+  fmt::print("{:>16} {:>8} {:>8} {:>16}\n", "Benchmark", "Buffers", "Threads",
+    "Events/s");
+
+  const char* names[] {"FilterBinIter", "tracklength", "collision"};
+  int status = 0;
+  for (auto benchmark : {Benchmark::FILTER_BIN_ITER, Benchmark::TRACKLENGTH,
+         Benchmark::COLLISION}) {
+    for (int n_threads = 1; n_threads <= num_threads(); n_threads *= 2) {
+      double sum[2];
+      for (bool private_buffers : {false, true}) {
+        // Without a memory allowance, tallies fall back to atomic updates
+        for (auto& t : model::tallies) {
+          t->init_thread_buffers(private_buffers ? SIZE_MAX : 0);
+          t->reset();
+        }
+
+        double rate = run(benchmark, n_threads, n_events);
+        sum[private_buffers] = sum_results();
+        fmt::print("{:>16} {:>8} {:>8} {:>16.4e}\n",
+          names[static_cast<int>(benchmark)],
+          private_buffers ? "private" : "atomic", n_threads, rate);
+      }
+
+      // Both ways of accumulating must give the same results up to roundoff
+      if (std::abs(sum[1] - sum[0]) > 1.0e-8 * std::abs(sum[0])) {
+        fmt::print("Results differ between atomic and private buffers: {} {}\n",
+          sum[0], sum[1]);
+        status = 1;
+      }
+    }
+  }
+
+  return status;
+}
@@ -0,0 +1,92 @@
+#include "openmc/eigenvalue.h"
+#include "openmc/settings.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+using namespace openmc;
+
+namespace {
+
+vector<SourceSite> make_sites()
+{
+  vector<SourceSite> sites(3);
+  for (int i = 0; i < sites.size(); ++i) {
+    auto& site = sites[i];
+    site.r = {1.0 + i, -2.5 * i, 1.0e3 / 3.0};
+    site.u = {0.6, 0.0, 0.8};
+    site.E = 2.0e6 / (i + 1);
+    site.time = 1.0e-7 * i;
+    site.wgt = 0.5 + i;
+    site.delayed_group = i;
+    site.surf_id = 7;
+    site.particle = ParticleType::neutron;
+    site.parent_id = 11;
+    site.progeny_id = 13;
+  }
+  return sites;
+}
+
+vector<SourceSite> round_trip(const vector<SourceSite>& sites)
+{
+  vector<char> buffer(sites.size() * site_wire_size());
+  pack_sites(sites.data(), sites.size(), buffer.data());
+  vector<SourceSite> result(sites.size());
+  unpack_sites(buffer.data(), sites.size(), result.data());
+  return result;
+}
+
+} // namespace
+
+TEST_CASE("Test source site wire format")
+{
+  auto sites = make_sites();
+
+  SECTION("full sites")
+  {
+    settings::compact_source_sites = false;
+    auto result = round_trip(sites);
+    for (int i = 0; i < sites.size(); ++i) {
+      REQUIRE(result[i].r == sites[i].r);
+      REQUIRE(result[i].u == sites[i].u);
+      REQUIRE(result[i].E == sites[i].E);
+      REQUIRE(result[i].time == sites[i].time);
+      REQUIRE(result[i].wgt == sites[i].wgt);
+      REQUIRE(result[i].delayed_group == sites[i].delayed_group);
+      REQUIRE(result[i].particle == sites[i].particle);
+      REQUIRE(result[i].surf_id == 0);
+      REQUIRE(result[i].parent_id == 0);
+      REQUIRE(result[i].progeny_id == 0);
+    }
+  }
+
+  SECTION("compact sites")
+  {
+    settings::compact_source_sites = true;
+    REQUIRE(site_wire_size() < sizeof(SourceSite));
+    auto result = round_trip(sites);
+    for (int i = 0; i < sites.size(); ++i) {
+      // Positions, times and weights are sent exactly
+      REQUIRE(result[i].r == sites[i].r);
+      REQUIRE(result[i].time == sites[i].time);
+      REQUIRE(result[i].wgt == sites[i].wgt);
+
+      // Directions and energies are sent in single precision
+      REQUIRE_THAT(
+        result[i].u.x, Catch::Matchers::WithinAbs(sites[i].u.x, 1e-7));
+      REQUIRE_THAT(
+        result[i].u.y, Catch::Matchers::WithinAbs(sites[i].u.y, 1e-7));
+      REQUIRE_THAT(
+        result[i].u.z, Catch::Matchers::WithinAbs(sites[i].u.z, 1e-7));
+      REQUIRE_THAT(result[i].u.norm(), Catch::Matchers::WithinAbs(1.0, 1e-14));
+      REQUIRE_THAT(
+        result[i].E, Catch::Matchers::WithinRel(sites[i].E, 1e-7));
+
+      REQUIRE(result[i].delayed_group == sites[i].delayed_group);
+      REQUIRE(result[i].particle == sites[i].particle);
+      REQUIRE(result[i].surf_id == 0);
+      REQUIRE(result[i].parent_id == 0);
+      REQUIRE(result[i].progeny_id == 0);
+    }
+    settings::compact_source_sites = false;
+  }
+}
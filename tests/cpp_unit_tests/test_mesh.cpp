@@ -0,0 +1,167 @@
+#include "openmc/mesh.h"
+#include "openmc/mesh_traversal.h"
+#include "openmc/position.h"
+#include "openmc/tallies/filter_match.h"
+#include "openmc/tallies/filter_mesh.h"
+#include "openmc/tallies/filter_meshsurface.h"
+#include "openmc/tallies/tally.h"
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <random>
+
+using namespace openmc;
+
+namespace {
+
+template<typename T>
+void check_equal(const FilterMatchVector<T>& a, const FilterMatchVector<T>& b)
+{
+  REQUIRE(a.size() == b.size());
+  for (size_t j = 0; j < a.size(); ++j) {
+    REQUIRE(a[j] == b[j]);
+  }
+}
+
+// Compare the bins crossed by random tracks, including tracks that start
+// outside of the mesh, run parallel to grid planes, or start on a grid plane,
+// with those found by the generic structured mesh raytrace
+void check_tracks(const StructuredMesh& mesh)
+{
+  std::mt19937_64 engine(1);
+  std::uniform_real_distribution<double> position(-14.0, 14.0);
+  std::uniform_real_distribution<double> direction(-1.0, 1.0);
+
+  for (int i = 0; i < 10000; ++i) {
+    reset_filter_match_arena();
+
+    Position r0 {position(engine), position(engine), position(engine)};
+    Direction u {direction(engine), direction(engine), direction(engine)};
+    if (i % 3 == 0)
+      u[i % 2] = 0.0;
+    if (i % 5 == 0)
+      r0.x = std::round(r0.x);
+    u /= u.norm();
+    Position r1 = r0 + std::abs(position(engine)) * u;
+
+    FilterMatchVector<int> bins, expected_bins;
+    FilterMatchVector<double> lengths, expected_lengths;
+    mesh.bins_crossed(r0, r1, u, bins, lengths);
+    mesh.StructuredMesh::bins_crossed(
+      r0, r1, u, expected_bins, expected_lengths);
+    check_equal(bins, expected_bins);
+    check_equal(lengths, expected_lengths);
+
+    FilterMatchVector<int> surfaces, expected_surfaces;
+    mesh.surface_bins_crossed(r0, r1, u, surfaces);
+    mesh.StructuredMesh::surface_bins_crossed(r0, r1, u, expected_surfaces);
+    check_equal(surfaces, expected_surfaces);
+
+    // Tracing for both at once must give the same bins
+    FilterMatchVector<int> both_bins, both_surfaces;
+    FilterMatchVector<double> both_lengths;
+    mesh.bins_and_surfaces_crossed(
+      r0, r1, u, both_bins, both_lengths, both_surfaces);
+    check_equal(both_bins, expected_bins);
+    check_equal(both_lengths, expected_lengths);
+    check_equal(both_surfaces, expected_surfaces);
+  }
+}
+
+} // namespace
+
+TEST_CASE("Test regular mesh raytrace")
+{
+  for (int n = 1; n <= 3; ++n) {
+    RegularMesh mesh;
+    mesh.n_dimension_ = n;
+    mesh.shape_ = {7, 5, 3};
+    mesh.lower_left_ = {-10.0, -9.0, -8.0};
+    mesh.width_ = {20.0 / 7, 3.3, 5.1};
+    check_tracks(mesh);
+  }
+}
+
+TEST_CASE("Test rectilinear mesh raytrace")
+{
+  RectilinearMesh mesh;
+  mesh.n_dimension_ = 3;
+  mesh.grid_[0] = {-10.0, -7.0, -1.0, 0.0, 0.5, 3.0, 10.0};
+  mesh.grid_[1] = {-9.0, -2.0, 4.0, 8.0};
+  mesh.grid_[2] = {-8.0, -7.5, -7.0, 0.0, 1.0, 2.0, 9.0};
+  REQUIRE(mesh.set_grid() == 0);
+  check_tracks(mesh);
+}
+
+TEST_CASE("Test mesh traversal cache")
+{
+  auto mesh = make_unique<RegularMesh>();
+  mesh->n_dimension_ = 3;
+  mesh->shape_ = {7, 5, 3};
+  mesh->lower_left_ = {-10.0, -9.0, -8.0};
+  mesh->width_ = {20.0 / 7, 3.3, 5.1};
+  model::meshes.push_back(std::move(mesh));
+  const auto& regular = *model::meshes.back();
+
+  // A tracklength tally with a mesh filter and a tally with a mesh surface
+  // filter share the traversals of the mesh
+  auto mesh_filter = Filter::create<MeshFilter>();
+  mesh_filter->set_mesh(0);
+  auto surface_filter = Filter::create<MeshSurfaceFilter>();
+  surface_filter->set_mesh(0);
+  for (Filter* filter : vector<Filter*> {mesh_filter, surface_filter}) {
+    vector<Filter*> filters {filter};
+    Tally::create()->set_filters(filters);
+  }
+  prepare_mesh_traversal_caches();
+  REQUIRE(model::cached_meshes.size() == 1);
+  REQUIRE(model::cached_meshes[0].tracks);
+  REQUIRE(model::cached_meshes[0].surfaces);
+  REQUIRE(!model::cached_meshes[0].points);
+
+  std::mt19937_64 engine(1);
+  std::uniform_real_distribution<double> position(-14.0, 14.0);
+  std::uniform_real_distribution<double> direction(-1.0, 1.0);
+
+  MeshTraversalCache cache;
+  int n_tracks = 1000;
+  for (int i = 0; i < n_tracks; ++i) {
+    reset_filter_match_arena();
+
+    Position r0 {position(engine), position(engine), position(engine)};
+    Direction u {direction(engine), direction(engine), direction(engine)};
+    u /= u.norm();
+    Position r1 = r0 + std::abs(position(engine)) * u;
+
+    // The first lookup traces the mesh and the second one is a hit
+    FilterMatchVector<int> bins, expected_bins;
+    FilterMatchVector<double> lengths, expected_lengths;
+    cache.bins_crossed(0, r0, r1, u, bins, lengths);
+    regular.bins_crossed(r0, r1, u, expected_bins, expected_lengths);
+    check_equal(bins, expected_bins);
+    check_equal(lengths, expected_lengths);
+
+    FilterMatchVector<int> surfaces, expected_surfaces;
+    cache.surface_bins_crossed(0, r0, r1, u, surfaces);
+    regular.surface_bins_crossed(r0, r1, u, expected_surfaces);
+    check_equal(surfaces, expected_surfaces);
+
+    // Point lookups are not cached for this mesh
+    REQUIRE(cache.get_bin(0, r1) == regular.get_bin(r1));
+  }
+  REQUIRE(cache.n_hits() == n_tracks);
+  REQUIRE(cache.n_misses() == n_tracks);
+
+  // Invalidated entries are traced again
+  cache.clear();
+  FilterMatchVector<int> surfaces;
+  Position r0 {0.0, 0.0, 0.0};
+  Position r1 {1.0, 2.0, 3.0};
+  cache.surface_bins_crossed(0, r0, r1, r1 / r1.norm(), surfaces);
+  REQUIRE(cache.n_misses() == n_tracks + 1);
+
+  cache.accumulate();
+  REQUIRE(simulation::mesh_traversal_hits == n_tracks);
+  REQUIRE(simulation::mesh_traversal_misses == n_tracks + 1);
+  REQUIRE(cache.n_hits() == 0);
+}
@@ -0,0 +1,120 @@
+#include "openmc/outgoing_energy.h"
+#include "openmc/vector.h"
+#include <catch2/catch_test_macros.hpp>
+
+#include "xtensor/xbuilder.hpp"
+
+#include <cmath> // for nextafter
+
+using namespace openmc;
+
+namespace {
+
+//! Bin found by the linear search of the discrete lines and the continuous
+//! distribution that the guide tables replaced. The CDF value at the upper
+//! bound is only set if a continuous bin was searched.
+struct ScanBin {
+  int k;
+  double c_k;
+  double c_k1;
+  bool has_c_k1;
+};
+
+ScanBin linear_scan(const double* c, int n, int n_discrete, double xi)
+{
+  double c_k = c[0];
+  double c_k1 = 0.0;
+  bool has_c_k1 = false;
+  int k = 0;
+  int end = n - 2;
+
+  // Discrete portion
+  for (int j = 0; j < n_discrete; ++j) {
+    k = j;
+    c_k = c[k];
+    if (xi < c_k) {
+      end = j;
+      break;
+    }
+  }
+
+  // Continuous portion
+  for (int j = n_discrete; j < end; ++j) {
+    k = j;
+    c_k1 = c[k + 1];
+    has_c_k1 = true;
+    if (xi < c_k1)
+      break;
+    k = j + 1;
+    c_k = c_k1;
+  }
+  return {k, c_k, c_k1, has_c_k1};
+}
+
+} // namespace
+
+TEST_CASE("Test guide table search of outgoing energy tables")
+{
+  // CDF and number of discrete lines of each table. The outgoing energies and
+  // PDF are not used by the search.
+  vector<vector<double>> cdfs {
+    // Continuous only
+    {0.0, 0.1, 0.35, 0.5, 0.9, 1.0},
+    // Discrete lines followed by a continuous distribution
+    {0.1, 0.25, 0.25, 0.4, 0.4, 0.8, 1.0},
+    // Non-monotonic CDF, which some evaluations contain
+    {0.0, 0.3, 0.2, 0.6, 0.5, 0.5, 1.0},
+    {0.2, 0.5, 0.1, 0.7, 0.9, 0.8},
+    // CDF that ends below one
+    {0.0, 0.2, 0.6, 0.95},
+    // No continuous bin to search, with n_discrete >= n - 2
+    {0.3, 0.6, 0.8, 1.0},
+    {0.3, 0.6, 1.0},
+    {0.5, 1.0},
+    {0.0, 1.0},
+    {1.0}};
+  vector<int> n_discrete {0, 2, 0, 1, 0, 2, 3, 1, 0, 0};
+
+  int n_total = 0;
+  vector<int> offsets;
+  for (const auto& c : cdfs) {
+    offsets.push_back(n_total);
+    n_total += c.size();
+  }
+  xt::xarray<double> eout = xt::zeros<double>({3, n_total});
+  for (int i = 0; i < cdfs.size(); ++i) {
+    for (int j = 0; j < cdfs[i].size(); ++j) {
+      eout(0, offsets[i] + j) = j + 1.0;
+      eout(1, offsets[i] + j) = 1.0;
+      eout(2, offsets[i] + j) = cdfs[i][j];
+    }
+  }
+  vector<int> interpolation(cdfs.size(), 2);
+  OutgoingEnergyTables tables {eout, offsets, interpolation, n_discrete, 3};
+
+  for (int i = 0; i < cdfs.size(); ++i) {
+    const auto& c = cdfs[i];
+
+    // Values on a fine grid, at every CDF value and just below it, and at and
+    // beyond one
+    vector<double> values {1.0, 1.0 + 1e-12, 1.5};
+    for (int j = 0; j < 1000; ++j) {
+      values.push_back(j / 1000.0);
+    }
+    for (double x : c) {
+      values.push_back(x);
+      values.push_back(std::nextafter(x, 0.0));
+    }
+
+    for (double xi : values) {
+      INFO("table " << i << ", xi = " << xi);
+      auto bin = tables.find_bin(i, xi);
+      auto ref = linear_scan(c.data(), c.size(), n_discrete[i], xi);
+      REQUIRE(bin.k == ref.k);
+      REQUIRE(bin.c_k == ref.c_k);
+      if (ref.has_c_k1) {
+        REQUIRE(bin.c_k1 == ref.c_k1);
+      }
+    }
+  }
+}
@@ -0,0 +1,59 @@
+#include "openmc/constants.h"
+#include "openmc/particle_data.h"
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+
+using namespace openmc;
+
+TEST_CASE("Test microscopic cross section cache layout")
+{
+  ParticleData p;
+  const ParticleData& cp = p;
+
+  // Without a material, nuclides are cached in the extra entries
+  p.neutron_xs(5).total = 2.0;
+  p.neutron_xs(5).last_E = 1.0;
+  REQUIRE(p.neutron_xs(5).last_E == 1.0);
+  REQUIRE(cp.neutron_xs(5).total == 2.0);
+
+  // Nuclides that were never calculated have no cross sections
+  REQUIRE_THROWS_AS(cp.neutron_xs(7), std::out_of_range);
+
+  // Nuclides of the material get their own entries, which start out invalid
+  vector<int> index(21, C_NONE);
+  index[3] = 0;
+  index[5] = 1;
+  p.set_neutron_xs_material(0, 2, index.data());
+  REQUIRE(p.neutron_xs(5).last_E == 0.0);
+  p.neutron_xs(3).last_E = 3.0;
+  p.neutron_xs(5).last_E = 5.0;
+  REQUIRE(p.neutron_xs(3).last_E == 3.0);
+  REQUIRE(p.neutron_xs(5).last_E == 5.0);
+
+  // Other nuclides take turns in the extra entries
+  for (int i = 0; i < NEUTRON_XS_EXTRA_SLOTS; ++i) {
+    p.neutron_xs(10 + i).last_E = 1.0;
+  }
+  REQUIRE(cp.neutron_xs(10).last_E == 1.0);
+  p.neutron_xs(20).last_E = 1.0;
+  REQUIRE_THROWS_AS(cp.neutron_xs(10), std::out_of_range);
+  REQUIRE(cp.neutron_xs(11).last_E == 1.0);
+  REQUIRE(p.neutron_xs(3).last_E == 3.0);
+
+  // Switching materials invalidates entries that now hold another nuclide
+  vector<int> other(21, C_NONE);
+  other[3] = 1;
+  other[5] = 0;
+  p.set_neutron_xs_material(1, 2, other.data());
+  REQUIRE(p.neutron_xs(3).last_E == 0.0);
+  REQUIRE(p.neutron_xs(5).last_E == 0.0);
+
+  // Nuclides added to the material get entries even if its index array is
+  // not moved
+  other[7] = 2;
+  other[9] = 3;
+  p.set_neutron_xs_material(1, 4, other.data());
+  p.neutron_xs(9).last_E = 9.0;
+  REQUIRE(cp.neutron_xs(9).last_E == 9.0);
+}
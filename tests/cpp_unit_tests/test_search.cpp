@@ -0,0 +1,38 @@
+#include "openmc/search.h"
+#include "openmc/vector.h"
+#include <catch2/catch_test_macros.hpp>
+
+using namespace openmc;
+
+TEST_CASE("Test branchless binary search")
+{
+  // Grids with repeated points, as at discontinuities of cross sections
+  vector<vector<double>> grids {{1.0}, {1.0, 2.0}, {1.0, 1.0, 2.0},
+    {1.0, 2.0, 2.0, 3.0}, {1.0, 2.0, 3.0, 4.0, 5.0, 5.0}};
+
+  for (const auto& grid : grids) {
+    const double* first = grid.data();
+    const double* last = first + grid.size();
+
+    // Every grid point, the midpoints between them and values outside
+    vector<double> values {grid.front() - 1.0, grid.back() + 1.0};
+    for (int i = 0; i < grid.size(); ++i) {
+      values.push_back(grid[i]);
+      if (i + 1 < grid.size())
+        values.push_back(0.5 * (grid[i] + grid[i + 1]));
+    }
+
+    for (double value : values) {
+      INFO("grid size " << grid.size() << ", value " << value);
+      REQUIRE(lower_bound_index_branchless(first, last, value) ==
+              lower_bound_index(grid.begin(), grid.end(), value));
+    }
+
+    // Boundary values
+    REQUIRE(lower_bound_index_branchless(first, last, grid.front()) == 0);
+    REQUIRE(lower_bound_index_branchless(first, last, grid.front() - 1.0) ==
+            -1);
+    REQUIRE(lower_bound_index_branchless(first, last, grid.back() + 1.0) ==
+            last - first - 1);
+  }
+}
@@ -1,4 +1,6 @@
+#include "openmc/tallies/filter_match.h"
 #include "openmc/tallies/tally.h"
+#include "openmc/tallies/tally_buffer.h"
 #include <catch2/catch_test_macros.hpp>
 
 using namespace openmc;
@@ -52,4 +54,93 @@ TEST_CASE("Test add/set_filter")
   REQUIRE(tally->filters().size() == 1);
   REQUIRE(model::filter_map[cell_filter->id()] == tally->filters(0));
 
-}
\ No newline at end of file
+}
+
+TEST_CASE("Test filter match arena")
+{
+  reset_filter_match_arena();
+
+  // fill two matches one after the other, with enough bins to span chunks
+  FilterMatch a, b;
+  int n = FilterMatchArena<int>::CHUNK_SIZE + 10;
+  for (int i = 0; i < n; ++i) {
+    a.bins_.push_back(i);
+    a.weights_.push_back(0.5 * i);
+  }
+  for (int i = 0; i < 100; ++i) {
+    b.bins_.push_back(-i);
+    b.weights_.push_back(1.0);
+  }
+
+  // growing a match must not disturb the other
+  a.bins_.push_back(n);
+  REQUIRE(a.size() == n + 1);
+  REQUIRE(b.size() == 100);
+  for (int i = 0; i < n; ++i) {
+    REQUIRE(a.bin(i) == i);
+    REQUIRE(a.weight(i) == 0.5 * i);
+  }
+  for (int i = 0; i < 100; ++i) {
+    REQUIRE(b.bin(i) == -i);
+  }
+
+  // after a reset, storage is reused from the start of the arena
+  reset_filter_match_arena();
+  a.bins_.clear();
+  a.bins_.push_back(7);
+  REQUIRE(a.bins_.size() == 1);
+  REQUIRE(a.bins_[0] == 7);
+  b.bins_.clear();
+  b.bins_.push_back(3);
+  REQUIRE(b.bins_.begin() != a.bins_.begin());
+
+  // matching all bins requires no storage
+  FilterMatch all;
+  all.all_bins_ = true;
+  all.n_all_bins_ = 5;
+  REQUIRE(all.size() == 5);
+  REQUIRE(all.bin(3) == 3);
+  REQUIRE(all.weight(3) == 1.0);
+  REQUIRE(all.bins_.empty());
+}
+
+TEST_CASE("Test tally buffers")
+{
+  // dense buffers hold every value
+  TallyBuffer dense(100, true);
+  REQUIRE(dense.add(7, 1.0));
+  REQUIRE(dense.add(7, 2.0));
+  REQUIRE(dense.add(99, 0.5));
+  double sum = 0.0;
+  int n = 0;
+  dense.flush([&](int64_t i, double value) {
+    sum += i * value;
+    ++n;
+  });
+  REQUIRE(n == 2);
+  REQUIRE(sum == 7 * 3.0 + 99 * 0.5);
+
+  // sparse buffers report when they are full and are empty after a flush
+  int64_t n_values = 100 * TALLY_SPARSE_BUFFER_SLOTS;
+  TallyBuffer sparse(n_values, false);
+  int64_t n_added = 0;
+  while (sparse.add(n_added * 97, 1.0)) {
+    REQUIRE(sparse.add(n_added * 97, 1.0));
+    ++n_added;
+  }
+  REQUIRE(n_added == TALLY_SPARSE_BUFFER_SLOTS / 2);
+
+  n = 0;
+  bool all_doubled = true;
+  sparse.flush([&](int64_t i, double value) {
+    all_doubled = all_doubled && (i % 97 == 0) && (value == 2.0);
+    ++n;
+  });
+  REQUIRE(n == n_added);
+  REQUIRE(all_doubled);
+
+  n = 0;
+  sparse.flush([&](int64_t i, double value) { ++n; });
+  REQUIRE(n == 0);
+  REQUIRE(sparse.add(n_values - 1, 1.0));
+}
@@ -0,0 +1,166 @@
+#include "openmc/constants.h"
+#include "openmc/math_functions.h"
+#include "openmc/wmp.h"
+#include "openmc/vector.h"
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "xtensor/xbuilder.hpp"
+
+#include <algorithm> // for max, min
+#include <cmath>
+#include <complex>
+
+using namespace openmc;
+
+namespace {
+
+//! Points on a circle of the given radius in the complex plane, avoiding the
+//! real axis where the integral form of the Faddeeva function is discontinuous
+void circle_points(double radius, vector<double>& x, vector<double>& y)
+{
+  x.resize(WMP_POLE_CHUNK);
+  y.resize(WMP_POLE_CHUNK);
+  for (int j = 0; j < WMP_POLE_CHUNK; ++j) {
+    double theta = 2.0 * PI * (j + 0.5) / WMP_POLE_CHUNK;
+    x[j] = radius * std::cos(theta);
+    y[j] = radius * std::sin(theta);
+  }
+}
+
+} // namespace
+
+TEST_CASE("Test truncated continued fraction of the Faddeeva function")
+{
+  vector<double> x, y;
+  vector<double> wr(WMP_POLE_CHUNK);
+  vector<double> wi(WMP_POLE_CHUNK);
+
+  // Just inside, at and outside the radius where the continued fraction
+  // takes over from the full function
+  for (double radius :
+    {0.95 * WMP_CF_RADIUS, WMP_CF_RADIUS, 1.5 * WMP_CF_RADIUS}) {
+    circle_points(radius, x, y);
+
+    faddeeva_cf<false>(
+      WMP_POLE_CHUNK, x.data(), y.data(), wr.data(), wi.data());
+    for (int j = 0; j < WMP_POLE_CHUNK; ++j) {
+      auto w = SQRT_PI * faddeeva({x[j], y[j]});
+      INFO("z = " << x[j] << " + " << y[j] << "i");
+      REQUIRE_THAT(std::abs(std::complex<double>(wr[j], wi[j]) - w),
+        Catch::Matchers::WithinAbs(0.0, 1e-13 * std::abs(w)));
+    }
+
+    // The recurrence used by w_derivative loses about 1e-10 to cancellation
+    // at these radii, which dominates the difference
+    faddeeva_cf<true>(WMP_POLE_CHUNK, x.data(), y.data(), wr.data(), wi.data());
+    for (int j = 0; j < WMP_POLE_CHUNK; ++j) {
+      auto w = SQRT_PI * w_derivative({x[j], y[j]}, 2);
+      INFO("z = " << x[j] << " + " << y[j] << "i");
+      REQUIRE_THAT(std::abs(std::complex<double>(wr[j], wi[j]) - w),
+        Catch::Matchers::WithinAbs(0.0, 1e-9 * std::abs(w)));
+    }
+  }
+}
+
+TEST_CASE("Test batched windowed multipole evaluation")
+{
+  // Synthetic data with poles spread over sqrt(E) in [1, 10] and windows
+  // that each cover the poles within one unit of sqrt(E)
+  WindowedMultipole wmp;
+  wmp.E_min_ = 1.0;
+  wmp.E_max_ = 100.0;
+  wmp.sqrt_awr_ = std::sqrt(235.0);
+  wmp.inv_spacing_ = 1.0;
+  wmp.fit_order_ = 2;
+  wmp.fissionable_ = true;
+
+  int n_poles = 200;
+  wmp.poles_ = xt::zeros<double>({2 * (MP_RF + 1), n_poles});
+  for (int i = 0; i < n_poles; ++i) {
+    wmp.poles_(2 * MP_EA, i) = 1.0 + 9.0 * (i + 0.5) / n_poles;
+    wmp.poles_(2 * MP_EA + 1, i) = -1e-3 * (1 + i % 7);
+    for (int j = MP_RS; j <= MP_RF; ++j) {
+      wmp.poles_(2 * j, i) = 1e-2 * (j + 1) * std::cos(i);
+      wmp.poles_(2 * j + 1, i) = 1e-2 * std::sin(j * i);
+    }
+  }
+
+  int n_windows = 9;
+  wmp.curvefit_ = xt::zeros<double>({n_windows, wmp.fit_order_ + 1, 3});
+  for (int i = 0; i < n_windows; ++i) {
+    WindowedMultipole::WindowInfo window;
+    window.index_start = std::max(0, (i - 1) * n_poles / n_windows);
+    window.index_end = std::min(n_poles, (i + 2) * n_poles / n_windows) - 1;
+    window.broaden_poly = (i % 2 == 0);
+    wmp.window_info_.push_back(window);
+    for (int k = 0; k <= wmp.fit_order_; ++k) {
+      wmp.curvefit_(i, k, FIT_S) = 10.0 / (k + 1);
+      wmp.curvefit_(i, k, FIT_A) = 1.0 / (k + 1);
+      wmp.curvefit_(i, k, FIT_F) = 2.0 / (k + 1);
+    }
+  }
+
+  // Energies in every window at 0 K and at temperature, in no particular
+  // order
+  vector<double> E;
+  vector<double> sqrtkT;
+  for (int i = 0; i < 300; ++i) {
+    double sqrtE = 1.0 + 9.0 * std::fmod(0.618034 * i, 1.0);
+    E.push_back(sqrtE * sqrtE);
+    sqrtkT.push_back(i % 3 == 0 ? 0.0 : std::sqrt(K_BOLTZMANN * 300.0 * i));
+  }
+
+  int n = E.size();
+  vector<double> sig_s(n);
+  vector<double> sig_a(n);
+  vector<double> sig_f(n);
+  wmp.evaluate(n, E.data(), sqrtkT.data(), sig_s.data(), sig_a.data(),
+    sig_f.data());
+
+  // The same data without residues gives the curve fit alone
+  WindowedMultipole fit {wmp};
+  for (int i = 0; i < n_poles; ++i) {
+    for (int j = 2 * MP_RS; j < 2 * (MP_RF + 1); ++j) {
+      fit.poles_(j, i) = 0.0;
+    }
+  }
+
+  for (int i = 0; i < n; ++i) {
+    INFO("E = " << E[i] << ", sqrtkT = " << sqrtkT[i]);
+    double s, a, f;
+    std::tie(s, a, f) = wmp.evaluate(E[i], sqrtkT[i]);
+    REQUIRE(sig_s[i] == s);
+    REQUIRE(sig_a[i] == a);
+    REQUIRE(sig_f[i] == f);
+
+    // Sum the scattering contributions of the poles with the full Faddeeva
+    // function, or its asymptotic form at 0 K
+    double sqrtE = std::sqrt(E[i]);
+    const auto& window {wmp.window_info_[std::min(
+      n_windows - 1, static_cast<int>(sqrtE - 1.0))]};
+    double sum = 0.0;
+    double scale = 0.0;
+    for (int k = window.index_start; k <= window.index_end; ++k) {
+      std::complex<double> pole {
+        wmp.poles_(2 * MP_EA, k), wmp.poles_(2 * MP_EA + 1, k)};
+      std::complex<double> residue {
+        wmp.poles_(2 * MP_RS, k), wmp.poles_(2 * MP_RS + 1, k)};
+      std::complex<double> term;
+      if (sqrtkT[i] == 0.0) {
+        term = residue * std::complex<double>(0.0, -1.0) / (pole - sqrtE) /
+               E[i];
+      } else {
+        double dopp = wmp.sqrt_awr_ / sqrtkT[i];
+        term = residue * SQRT_PI * faddeeva((sqrtE - pole) * dopp) * dopp /
+               E[i];
+      }
+      sum += term.real();
+      scale += std::abs(term);
+    }
+    double s_fit, a_fit, f_fit;
+    std::tie(s_fit, a_fit, f_fit) = fit.evaluate(E[i], sqrtkT[i]);
+    REQUIRE_THAT(s - s_fit,
+      Catch::Matchers::WithinAbs(sum, 1e-12 * (scale + std::abs(s))));
+  }
+}
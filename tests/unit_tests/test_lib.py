@@ -398,6 +398,7 @@ def test_tally_writable(lib_simulation_init):
 def test_tally_results(lib_run):
     t = openmc.lib.tallies[1]
     assert t.num_realizations == 10  # t was made active in test_tally_active
+    assert t.reduce_time >= 0.0
     assert np.all(t.mean >= 0)
     nonzero = (t.mean > 0.0)
     assert np.all(t.std_dev[nonzero] >= 0)
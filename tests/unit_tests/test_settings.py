@@ -13,14 +13,18 @@ def test_export_to_xml(run_in_tmpdir):
     s.energy_mode = 'continuous-energy'
     s.max_order = 5
     s.max_tracks = 1234
+    s.track_compression = 4
+    s.neighbor_list_rays = 5000
+    s.universe_partitioners = {'default': 'octree', 10: 'none'}
     s.source = openmc.IndependentSource(space=openmc.stats.Point())
     s.output = {'summary': True, 'tallies': False, 'path': 'here'}
     s.verbosity = 7
     s.sourcepoint = {'batches': [50, 150, 500, 1000], 'separate': True,
                      'write': True, 'overwrite': True, 'mcpl': True}
-    s.statepoint = {'batches': [50, 150, 500, 1000]}
+    s.statepoint = {'batches': [50, 150, 500, 1000], 'async': True}
     s.surf_source_read = {'path': 'surface_source_1.h5'}
     s.surf_source_write = {'surface_ids': [2], 'max_particles': 200}
+    s.compact_source_sites = True
     s.confidence_intervals = True
     s.ptables = True
     s.plot_seed = 100
@@ -67,6 +71,13 @@ def test_export_to_xml(run_in_tmpdir):
     }
 
     s.max_particle_events = 100
+    s.sort_xs_queues = True
+    s.shared_nuclear_data = True
+    s.cross_section_cache = 'xs_cache'
+    s.banked_xs_lookup = True
+    s.energy_grid = 'hash'
+    s.private_tally_buffers = True
+    s.tally_buffer_memory = 256.0
 
     # Make sure exporting XML works
     s.export_to_xml()
@@ -84,15 +95,19 @@ def test_export_to_xml(run_in_tmpdir):
     assert s.energy_mode == 'continuous-energy'
     assert s.max_order == 5
     assert s.max_tracks == 1234
+    assert s.track_compression == 4
+    assert s.neighbor_list_rays == 5000
+    assert s.universe_partitioners == {'default': 'octree', 10: 'none'}
     assert isinstance(s.source[0], openmc.IndependentSource)
     assert isinstance(s.source[0].space, openmc.stats.Point)
     assert s.output == {'summary': True, 'tallies': False, 'path': 'here'}
     assert s.verbosity == 7
     assert s.sourcepoint == {'batches': [50, 150, 500, 1000], 'separate': True,
                              'write': True, 'overwrite': True, 'mcpl': True}
-    assert s.statepoint == {'batches': [50, 150, 500, 1000]}
+    assert s.statepoint == {'batches': [50, 150, 500, 1000], 'async': True}
     assert s.surf_source_read == {'path': 'surface_source_1.h5'}
     assert s.surf_source_write == {'surface_ids': [2], 'max_particles': 200}
+    assert s.compact_source_sites
     assert s.confidence_intervals
     assert s.ptables
     assert s.plot_seed == 100
@@ -138,6 +153,13 @@ def test_export_to_xml(run_in_tmpdir):
     assert vol.upper_right == (10., 10., 10.)
     assert s.weight_window_checkpoints == {'surface': True, 'collision': False}
     assert s.max_particle_events == 100
+    assert s.sort_xs_queues
+    assert s.shared_nuclear_data
+    assert s.cross_section_cache == 'xs_cache'
+    assert s.banked_xs_lookup
+    assert s.energy_grid == 'hash'
+    assert s.private_tally_buffers
+    assert s.tally_buffer_memory == 256.0
     assert s.random_ray['distance_inactive'] == 10.0
     assert s.random_ray['distance_active'] == 100.0
     assert s.random_ray['ray_source'].space.lower_left == [-1., -1., -1.]
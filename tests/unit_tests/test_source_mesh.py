@@ -316,6 +316,45 @@ def test_mesh_source_independent(run_in_tmpdir, void_model, mesh_type):
     assert mesh_source.strength == 1.0
 
 
+def test_mesh_source_scaled_spectra(run_in_tmpdir, void_model):
+    """Elements with spectra that differ by a constant factor share a source
+    in memory but must keep their own strengths"""
+    model = void_model
+    mesh = openmc.RegularMesh.from_domain(model.geometry, (3, 1, 1))
+
+    sources = [
+        openmc.IndependentSource(
+            energy=openmc.stats.Discrete([1.e6, 2.e6], [1.0, 3.0]),
+            strength=1.0),
+        openmc.IndependentSource(
+            energy=openmc.stats.Discrete([1.e6, 2.e6], [0.25, 0.75]),
+            strength=2.0),
+        openmc.IndependentSource(
+            energy=openmc.stats.Discrete([3.e6], [1.0]),
+            strength=1.0)
+    ]
+    model.settings.source = openmc.MeshSource(mesh, sources)
+    model.export_to_model_xml()
+
+    openmc.lib.init()
+    particles = openmc.lib.sample_external_source(4000, prn_seed=1)
+    openmc.lib.finalize()
+
+    x = np.array([p.r[0] for p in particles])
+    E = np.array([p.E for p in particles])
+    element = ((x - mesh.lower_left[0]) // mesh.width[0]).astype(int)
+
+    # Sites are distributed according to the strengths of the elements
+    counts = np.bincount(element, minlength=3)
+    assert counts == pytest.approx([1000, 2000, 1000], rel=0.1)
+
+    # Each element samples energies from its own spectrum
+    shared = element < 2
+    assert set(E[shared]) == {1.e6, 2.e6}
+    assert np.all(E[~shared] == 3.e6)
+    assert np.mean(E[shared] == 2.e6) == pytest.approx(0.75, abs=0.05)
+
+
 @pytest.mark.parametrize("library", ('moab', 'libmesh'))
 def test_umesh_source_independent(run_in_tmpdir, request, void_model, library):
     import openmc.lib
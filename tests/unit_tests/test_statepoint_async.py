@@ -0,0 +1,54 @@
+import numpy as np
+import openmc
+import pytest
+
+
+@pytest.fixture
+def model():
+    openmc.reset_auto_ids()
+    mat = openmc.Material()
+    mat.add_nuclide('U235', 1.0)
+    mat.set_density('g/cm3', 10.0)
+
+    model = openmc.Model()
+    sph = openmc.Sphere(r=10.0, boundary_type='vacuum')
+    cell = openmc.Cell(fill=mat, region=-sph)
+    model.geometry = openmc.Geometry([cell])
+
+    model.settings.batches = 5
+    model.settings.inactive = 2
+    model.settings.particles = 200
+    model.settings.statepoint = {'batches': [3, 5]}
+    model.settings.sourcepoint = {'batches': [4], 'separate': True}
+
+    mesh = openmc.RegularMesh()
+    mesh.lower_left = (-10., -10., -10.)
+    mesh.upper_right = (10., 10., 10.)
+    mesh.dimension = (5, 5, 5)
+    tally = openmc.Tally()
+    tally.filters = [openmc.MeshFilter(mesh)]
+    tally.scores = ['flux', 'fission']
+    model.tallies = [tally]
+
+    return model
+
+
+def test_statepoint_async(model, run_in_tmpdir):
+    # Write statepoints synchronously and keep results for comparison
+    model.run()
+    results = {}
+    for batch in (3, 5):
+        with openmc.StatePoint(f'statepoint.{batch}.h5') as sp:
+            results[batch] = (sp.keff, sp.tallies[1].mean)
+    source = openmc.read_source_file('source.4.h5')
+
+    # Writing statepoints in the background should give identical files
+    model.settings.statepoint['async'] = True
+    model.run()
+    for batch in (3, 5):
+        with openmc.StatePoint(f'statepoint.{batch}.h5') as sp:
+            keff, mean = results[batch]
+            assert sp.keff.n == pytest.approx(keff.n)
+            np.testing.assert_array_equal(sp.tallies[1].mean, mean)
+    source_async = openmc.read_source_file('source.4.h5')
+    assert [s.E for s in source_async] == [s.E for s in source]
@@ -1,4 +1,5 @@
 import numpy as np
+import pytest
 
 import openmc
 
@@ -41,4 +42,49 @@ def test_xml_roundtrip(run_in_tmpdir):
     assert len(new_tally.triggers) == 1
     assert new_tally.triggers[0].trigger_type == tally.triggers[0].trigger_type
     assert new_tally.triggers[0].threshold == tally.triggers[0].threshold
-    assert new_tally.triggers[0].scores == tally.triggers[0].scores
\ No newline at end of file
+    assert new_tally.triggers[0].scores == tally.triggers[0].scores
+
+
+def test_decompose_xml_roundtrip(run_in_tmpdir):
+    tally = openmc.Tally()
+    tally.scores = ['flux']
+    assert not tally.decompose
+    tally.decompose = True
+    openmc.Tallies([tally]).export_to_xml()
+    new_tally = openmc.Tallies.from_xml()[0]
+    assert new_tally.decompose
+
+
+def test_decompose_matches_undecomposed(run_in_tmpdir):
+    """A decomposed tally gives the same results as one that is not, including
+    after a restart that reads its results from a state point"""
+    model = openmc.examples.pwr_pin_cell()
+    model.settings.batches = 6
+    model.settings.inactive = 2
+    model.settings.particles = 500
+    model.settings.statepoint = {'batches': [4, 6]}
+
+    mesh = openmc.RegularMesh()
+    mesh.lower_left = (-0.63, -0.63, -100.)
+    mesh.upper_right = (0.63, 0.63, 100.)
+    mesh.dimension = (4, 4, 1)
+    filters = [openmc.MeshFilter(mesh), openmc.EnergyFilter([0., 0.625, 20.e6])]
+    for decompose in (False, True):
+        tally = openmc.Tally()
+        tally.filters = filters
+        tally.scores = ['flux', 'total', 'fission']
+        tally.decompose = decompose
+        model.tallies.append(tally)
+    ids = [t.id for t in model.tallies]
+
+    def check(sp_path):
+        with openmc.StatePoint(sp_path) as sp:
+            reference, decomposed = (sp.get_tally(id=i) for i in ids)
+            assert decomposed.num_realizations == reference.num_realizations
+            assert np.any(reference.mean > 0.)
+            assert decomposed.mean == pytest.approx(reference.mean, rel=1e-12)
+            assert decomposed.std_dev == pytest.approx(
+                reference.std_dev, rel=1e-12)
+
+    check(model.run())
+    check(model.run(restart_file='statepoint.4.h5'))
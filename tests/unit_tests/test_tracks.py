@@ -110,6 +110,23 @@ def test_max_tracks(sphere_model, run_in_tmpdir):
     assert len(tracks) == expected_num_tracks
 
 
+def test_track_compression(sphere_model, run_in_tmpdir):
+    sphere_model.settings.max_tracks = 25
+    sphere_model.settings.track_compression = 4
+
+    # Run OpenMC to generate tracks.h5 file
+    generate_track_file(sphere_model, tracks=True)
+
+    # Tracks from each batch should be in compressed datasets
+    with h5py.File('tracks.h5', 'r') as fh:
+        for name in ('states', 'tracks', 'histories'):
+            assert fh[f'batch_1/{name}'].compression == 'gzip'
+
+    tracks = openmc.Tracks('tracks.h5')
+    assert len(tracks) > 0
+    assert tracks == sorted(tracks, key=lambda t: t.identifier)
+
+
 def test_filter(sphere_model, run_in_tmpdir):
     # Set maximum number of tracks per process to write
     sphere_model.settings.max_tracks = 25
@@ -0,0 +1,107 @@
+import os
+from pathlib import Path
+import shutil
+
+import numpy as np
+import openmc
+import openmc.lib
+import pytest
+
+
+NUCLIDES = ['H1', 'O16', 'U235']
+
+
+@pytest.fixture
+def library(run_in_tmpdir):
+    """Copy of the libraries of a few nuclides, so that their files can be
+    changed, and an empty cache directory"""
+    data_lib = openmc.data.DataLibrary.from_xml()
+    copy = openmc.data.DataLibrary()
+    for name in NUCLIDES:
+        path = Path(data_lib.get_by_material(name)['path'])
+        shutil.copy(path, path.name)
+        copy.register_file(path.name)
+    copy.export_to_xml('cross_sections.xml')
+    Path('xs_cache').mkdir()
+    return Path('cross_sections.xml').resolve()
+
+
+def run(library, cache=False):
+    """Run a small eigenvalue problem and return keff and some reaction rates
+    of each nuclide"""
+    water = openmc.Material()
+    water.add_nuclide('H1', 2.0)
+    water.add_nuclide('O16', 1.0)
+    water.add_nuclide('U235', 0.01)
+    water.set_density('g/cm3', 1.0)
+    sphere = openmc.Sphere(r=50.0, boundary_type='vacuum')
+    model = openmc.Model()
+    model.geometry = openmc.Geometry([openmc.Cell(fill=water, region=-sphere)])
+    model.materials = openmc.Materials([water])
+    model.materials.cross_sections = str(library)
+    model.settings.batches = 3
+    model.settings.inactive = 1
+    model.settings.particles = 200
+    model.settings.source = openmc.IndependentSource(
+        space=openmc.stats.Point())
+    if cache:
+        model.settings.cross_section_cache = 'xs_cache'
+
+    energy = np.logspace(-5, 7, 501)
+    flux = np.ones(500)
+    model.init_lib(output=False)
+    try:
+        openmc.lib.run(output=False)
+        keff = openmc.lib.keff()
+        rates = {}
+        for name in NUCLIDES:
+            nuc = openmc.lib.nuclides[name]
+            for mt in (1, 2, 4, 16, 18, 102, 103, 107):
+                rates[name, mt] = nuc.collapse_rate(mt, 294.0, energy, flux)
+    finally:
+        model.finalize_lib()
+    return keff, rates
+
+
+def cache_files():
+    """Size and modification time of each entry in the cache"""
+    return {p.name: (p.stat().st_size, p.stat().st_mtime_ns)
+            for p in Path('xs_cache').glob('*.cache')}
+
+
+def test_xs_cache(library):
+    reference = run(library)
+    assert not cache_files()
+
+    # The first run with a cache reads HDF5 and writes an entry per nuclide
+    assert run(library, cache=True) == reference
+    written = cache_files()
+    assert sorted(name.split('_')[0] for name in written) == NUCLIDES
+
+    # The next run reads all data from the cache without rewriting it
+    assert run(library, cache=True) == reference
+    assert cache_files() == written
+
+
+def test_xs_cache_fallback(library):
+    reference = run(library, cache=True)
+    written = cache_files()
+    entry = {name.split('_')[0]: name for name in written}
+
+    # A truncated entry is detected and replaced by one read from HDF5
+    path = Path('xs_cache') / entry['U235']
+    size = path.stat().st_size
+    with path.open('r+b') as f:
+        f.truncate(size // 2)
+    assert run(library, cache=True) == reference
+    assert path.stat().st_size == size
+
+    # When a library file changes, its old entry is no longer used and a new
+    # one is written
+    os.utime('H1.h5')
+    assert run(library, cache=True) == reference
+    files = cache_files()
+    assert len(files) == len(NUCLIDES) + 1
+    assert entry['H1'] in files
+    new = [name for name in files if name not in written]
+    assert len(new) == 1 and new[0].startswith('H1_')